@@ -15,6 +15,7 @@
 #ifndef INCLUDE_DAWN_NATIVE_DAWNNATIVE_H_
 #define INCLUDE_DAWN_NATIVE_DAWNNATIVE_H_
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,25 @@ struct DAWN_NATIVE_EXPORT DawnDeviceDescriptor {
     const WGPURequiredLimits* requiredLimits = nullptr;
 };
 
+// Statistics about the loads and stores of an instance's blob cache, to measure how effective
+// caching is.
+struct DAWN_NATIVE_EXPORT BlobCacheStatistics {
+    static constexpr size_t kLoadLatencyBucketCount = 20;
+
+    // Number of loads served by the in-memory cache, served by the platform's CachingInterface,
+    // and that didn't find the key.
+    uint64_t memoryHitCount = 0;
+    uint64_t platformHitCount = 0;
+    uint64_t missCount = 0;
+
+    uint64_t loadedBytes = 0;
+    uint64_t storedBytes = 0;
+
+    // loadLatencyHistogram[0] counts the loads that took less than 1us and loadLatencyHistogram[i]
+    // the loads that took between 2^(i-1)us and 2^i us. The last bucket also counts slower loads.
+    std::array<uint64_t, kLoadLatencyBucketCount> loadLatencyHistogram = {};
+};
+
 // A struct to record the information of a toggle. A toggle is a code path in Dawn device that
 // can be manually configured to run or not outside Dawn, including workarounds, special
 // features and optimizations.
@@ -169,6 +189,13 @@ class DAWN_NATIVE_EXPORT Instance {
     // TODO(dawn:1374) Deprecate this once it is passed via the descriptor.
     void SetPlatform(dawn::platform::Platform* platform);
 
+    // Keeps up to |size| bytes of the blobs loaded from or stored to the platform's
+    // CachingInterface in memory, so that loading them again doesn't need to go through the
+    // CachingInterface. The least recently used blobs are evicted first. Defaults to 0, which
+    // disables the in-memory cache.
+    void SetBlobCacheMemorySize(size_t size);
+    BlobCacheStatistics GetBlobCacheStatistics() const;
+
     uint64_t GetDeviceCountForTesting() const;
 
     // Returns the underlying WGPUInstance object.
@@ -39,9 +39,10 @@ class DAWN_PLATFORM_EXPORT CachingInterface {
     // LoadData has two modes. The first mode is used to get a value which
     // corresponds to the |key|. The |valueOut| is a caller provided buffer
     // allocated to the size |valueSize| which is loaded with data of the
-    // size returned. The second mode is used to query for the existence of
-    // the |key| where |valueOut| is nullptr and |valueSize| must be 0.
-    // The return size is non-zero if the |key| exists.
+    // size returned. If the value is larger than |valueSize|, nothing is
+    // loaded and the size of the value is returned. The second mode is used
+    // to query for the existence of the |key| where |valueOut| is nullptr and
+    // |valueSize| must be 0. The return size is non-zero if the |key| exists.
     virtual size_t LoadData(const void* key, size_t keySize, void* valueOut, size_t valueSize) = 0;
 
     // StoreData puts a |value| in the cache which corresponds to the |key|.
@@ -55,6 +56,13 @@ class DAWN_PLATFORM_EXPORT CachingInterface {
     CachingInterface& operator=(const CachingInterface&) = delete;
 };
 
+// Creates a CachingInterface that persists its entries in a pack file at |path|. The size of the
+// file is kept under |maxSizeInBytes| by evicting the least recently used entries. Returns nullptr
+// if the file cannot be opened or created.
+DAWN_PLATFORM_EXPORT std::unique_ptr<CachingInterface> CreateFileCachingInterface(
+    const char* path,
+    uint64_t maxSizeInBytes);
+
 class DAWN_PLATFORM_EXPORT WaitableEvent {
   public:
     WaitableEvent() = default;
@@ -99,6 +107,10 @@ class DAWN_PLATFORM_EXPORT Platform {
 
     virtual std::unique_ptr<WorkerTaskPool> CreateWorkerTaskPool();
 
+    // The maximum number of threads used by the WorkerTaskPool returned by the default
+    // CreateWorkerTaskPool(). 0 uses the hardware concurrency of the system.
+    virtual uint32_t GetMaxWorkerThreadCount();
+
   private:
     Platform(const Platform&) = delete;
     Platform& operator=(const Platform&) = delete;
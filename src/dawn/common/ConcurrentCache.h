@@ -15,40 +15,73 @@
 #ifndef SRC_DAWN_COMMON_CONCURRENTCACHE_H_
 #define SRC_DAWN_COMMON_CONCURRENTCACHE_H_
 
+#include <array>
+#include <cstddef>
 #include <mutex>
 #include <unordered_set>
 #include <utility>
 
 #include "dawn/common/NonCopyable.h"
 
-template <typename T>
+// A thread-safe set of pointers to objects compared by their content. The set is split into
+// shards that each have their own lock, picked from the hash of the object, so that threads
+// accessing different objects rarely contend on the same mutex.
+template <typename T, size_t kShardCount = 16>
 class ConcurrentCache : public NonMovable {
   public:
     ConcurrentCache() = default;
 
     T* Find(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto iter = mCache.find(object);
-        if (iter == mCache.end()) {
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.cache.find(object);
+        if (iter == shard.cache.end()) {
             return nullptr;
         }
         return *iter;
     }
 
     std::pair<T*, bool> Insert(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto [value, inserted] = mCache.insert(object);
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto [value, inserted] = shard.cache.insert(object);
         return {*value, inserted};
     }
 
     size_t Erase(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mCache.erase(object);
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.erase(object);
+    }
+
+    bool Empty() {
+        for (Shard& shard : mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.cache.empty()) {
+                return false;
+            }
+        }
+        return true;
     }
 
   private:
-    std::mutex mMutex;
-    std::unordered_set<T*, typename T::HashFunc, typename T::EqualityFunc> mCache;
+    static_assert(kShardCount > 0);
+
+    // Shards are aligned to separate cache lines to avoid false sharing between their mutexes.
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_set<T*, typename T::HashFunc, typename T::EqualityFunc> cache;
+    };
+
+    Shard& GetShard(const T* object) {
+        size_t hash = typename T::HashFunc()(object);
+        // Mix the high bits in since the low bits of the hash also select the bucket inside
+        // the shard's set.
+        hash ^= hash >> (sizeof(size_t) * 4);
+        return mShards[hash % kShardCount];
+    }
+
+    std::array<Shard, kShardCount> mShards;
 };
 
 #endif  // SRC_DAWN_COMMON_CONCURRENTCACHE_H_
@@ -0,0 +1,28 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_COMMON_SHA256_H_
+#define SRC_DAWN_COMMON_SHA256_H_
+
+#include <cstddef>
+#include <cstdint>
+
+static constexpr size_t kSha256DigestSize = 32;
+
+// Computes the SHA-256 digest (FIPS 180-4) of the |size| bytes at |data|. Unlike Hash(), the
+// digest is stable across processes and platforms, and collisions are not a practical concern, so
+// it can stand in for large inputs in persistent cache keys.
+void ComputeSha256(const void* data, size_t size, uint8_t (&digest)[kSha256DigestSize]);
+
+#endif  // SRC_DAWN_COMMON_SHA256_H_
@@ -15,7 +15,9 @@
 #include "dawn/native/AsyncTask.h"
 
 #include <utility>
+#include <vector>
 
+#include "dawn/common/Assert.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::native {
@@ -23,11 +25,11 @@ namespace dawn::native {
 AsyncTaskManager::AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool)
     : mWorkerTaskPool(workerTaskPool) {}
 
-void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
+Ref<AsyncTaskManager::WaitableTask> AsyncTaskManager::PostTask(AsyncTask asyncTask,
+                                                               AsyncTask cancelTask) {
     // If these allocations becomes expensive, we can slab-allocate tasks.
-    Ref<WaitableTask> waitableTask = AcquireRef(new WaitableTask());
-    waitableTask->taskManager = this;
-    waitableTask->asyncTask = std::move(asyncTask);
+    Ref<WaitableTask> waitableTask =
+        AcquireRef(new WaitableTask(this, std::move(asyncTask), std::move(cancelTask)));
 
     {
         // We insert new waitableTask objects into mPendingTasks in main thread (PostTask()),
@@ -41,8 +43,10 @@ void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
     // Ref the task since it is accessed inside the worker function.
     // The worker function will acquire and release the task upon completion.
     waitableTask->Reference();
-    waitableTask->waitableEvent =
+    waitableTask->mWaitableEvent =
         mWorkerTaskPool->PostWorkerTask(DoWaitableTask, waitableTask.Get());
+
+    return waitableTask;
 }
 
 void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
@@ -53,6 +57,23 @@ void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
     }
 }
 
+void AsyncTaskManager::CancelAllPendingTasks() {
+    std::vector<Ref<WaitableTask>> allPendingTasks;
+
+    {
+        std::lock_guard<std::mutex> lock(mPendingTasksMutex);
+        allPendingTasks.reserve(mPendingTasks.size());
+        for (auto& [_, task] : mPendingTasks) {
+            allPendingTasks.push_back(task);
+        }
+    }
+
+    // Cancellation callbacks are run without holding the lock since they are arbitrary code.
+    for (Ref<WaitableTask>& task : allPendingTasks) {
+        task->Cancel();
+    }
+}
+
 void AsyncTaskManager::WaitAllPendingTasks() {
     std::unordered_map<WaitableTask*, Ref<WaitableTask>> allPendingTasks;
 
@@ -62,7 +83,7 @@ void AsyncTaskManager::WaitAllPendingTasks() {
     }
 
     for (auto& [_, task] : allPendingTasks) {
-        task->waitableEvent->Wait();
+        task->mWaitableEvent->Wait();
     }
 }
 
@@ -73,12 +94,66 @@ bool AsyncTaskManager::HasPendingTasks() {
 
 void AsyncTaskManager::DoWaitableTask(void* task) {
     Ref<WaitableTask> waitableTask = AcquireRef(static_cast<WaitableTask*>(task));
-    waitableTask->asyncTask();
-    waitableTask->taskManager->HandleTaskCompletion(waitableTask.Get());
+    // The body may already have been stolen by RunNow() or the task may have been cancelled, in
+    // which case there is nothing left to do on the worker thread.
+    if (waitableTask->TryStart()) {
+        waitableTask->RunBody();
+    }
+    waitableTask->mTaskManager->HandleTaskCompletion(waitableTask.Get());
 }
 
-AsyncTaskManager::WaitableTask::WaitableTask() = default;
+AsyncTaskManager::WaitableTask::WaitableTask(AsyncTaskManager* taskManager,
+                                             AsyncTask asyncTask,
+                                             AsyncTask cancelTask)
+    : mTaskManager(taskManager),
+      mAsyncTask(std::move(asyncTask)),
+      mCancelTask(std::move(cancelTask)) {}
 
 AsyncTaskManager::WaitableTask::~WaitableTask() = default;
 
+bool AsyncTaskManager::WaitableTask::TryStart() {
+    State expected = State::Pending;
+    return mState.compare_exchange_strong(expected, State::Running);
+}
+
+void AsyncTaskManager::WaitableTask::RunBody() {
+    ASSERT(mState.load() == State::Running);
+    mAsyncTask();
+    // Release the resources captured by the task as soon as possible.
+    mAsyncTask = nullptr;
+    mCancelTask = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mTaskManager->mPendingTasksMutex);
+        mState.store(State::Completed);
+    }
+    mTaskManager->mTaskBodyCompletedCondition.notify_all();
+}
+
+bool AsyncTaskManager::WaitableTask::RunNow() {
+    if (TryStart()) {
+        RunBody();
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mTaskManager->mPendingTasksMutex);
+    mTaskManager->mTaskBodyCompletedCondition.wait(
+        lock, [this] { return mState.load() != State::Running; });
+    return mState.load() == State::Completed;
+}
+
+bool AsyncTaskManager::WaitableTask::Cancel() {
+    State expected = State::Pending;
+    if (!mState.compare_exchange_strong(expected, State::Cancelled)) {
+        return false;
+    }
+
+    if (mCancelTask) {
+        mCancelTask();
+    }
+    mAsyncTask = nullptr;
+    mCancelTask = nullptr;
+    return true;
+}
+
 }  // namespace dawn::native
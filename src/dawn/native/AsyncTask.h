@@ -15,6 +15,8 @@
 #ifndef SRC_DAWN_NATIVE_ASYNCTASK_H_
 #define SRC_DAWN_NATIVE_ASYNCTASK_H_
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -29,37 +31,58 @@ class WorkerTaskPool;
 
 namespace dawn::native {
 
-// TODO(crbug.com/dawn/826): we'll add additional things to AsyncTask in the future, like
-// Cancel() and RunNow(). Cancelling helps avoid running the task's body when we are just
-// shutting down the device. RunNow() could be used for more advanced scenarios, for example
-// always doing ShaderModule initial compilation asynchronously, but being able to steal the
-// task if we need it for synchronous pipeline compilation.
 using AsyncTask = std::function<void()>;
 
 class AsyncTaskManager {
   public:
-    explicit AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool);
-
-    void PostTask(AsyncTask asyncTask);
-    void WaitAllPendingTasks();
-    bool HasPendingTasks();
-
-  private:
+    // A task posted to the AsyncTaskManager. Exactly one of the task's body and its cancellation
+    // callback is run: the body runs either on a worker thread or on the thread calling RunNow(),
+    // whichever starts it first, and the cancellation callback runs if Cancel() is called before
+    // the body started.
     class WaitableTask : public RefCounted {
       public:
-        WaitableTask();
+        WaitableTask(AsyncTaskManager* taskManager, AsyncTask asyncTask, AsyncTask cancelTask);
         ~WaitableTask() override;
 
-        AsyncTask asyncTask;
-        AsyncTaskManager* taskManager;
-        std::unique_ptr<dawn::platform::WaitableEvent> waitableEvent;
+        // Runs the body on the calling thread if it hasn't started yet, otherwise waits for it to
+        // complete. Returns false if the task was cancelled instead.
+        bool RunNow();
+
+        // Prevents the body from running if it hasn't started yet and runs the cancellation
+        // callback instead. Returns true if the task was cancelled.
+        bool Cancel();
+
+      private:
+        friend class AsyncTaskManager;
+
+        enum class State { Pending, Running, Completed, Cancelled };
+
+        bool TryStart();
+        void RunBody();
+
+        AsyncTaskManager* mTaskManager;
+        AsyncTask mAsyncTask;
+        AsyncTask mCancelTask;
+        std::atomic<State> mState{State::Pending};
+        std::unique_ptr<dawn::platform::WaitableEvent> mWaitableEvent;
     };
 
+    explicit AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool);
+
+    // |cancelTask| is optional and is run instead of |asyncTask| if the task gets cancelled.
+    Ref<WaitableTask> PostTask(AsyncTask asyncTask, AsyncTask cancelTask = nullptr);
+    void CancelAllPendingTasks();
+    void WaitAllPendingTasks();
+    bool HasPendingTasks();
+
+  private:
     static void DoWaitableTask(void* task);
     void HandleTaskCompletion(WaitableTask* task);
 
     std::mutex mPendingTasksMutex;
     std::unordered_map<WaitableTask*, Ref<WaitableTask>> mPendingTasks;
+    // Signaled, with mPendingTasksMutex held, when the body of a task completes.
+    std::condition_variable mTaskBodyCompletedCondition;
     dawn::platform::WorkerTaskPool* mWorkerTaskPool;
 };
 
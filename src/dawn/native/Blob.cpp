@@ -41,18 +41,25 @@ Blob CreateBlob(size_t size, size_t alignment) {
 
 // static
 Blob Blob::UnsafeCreateWithDeleter(uint8_t* data, size_t size, std::function<void()> deleter) {
-    return Blob(data, size, deleter);
+    return Blob(data, size, deleter, false);
 }
 
-Blob::Blob() : mData(nullptr), mSize(0), mDeleter({}) {}
+// static
+Blob Blob::UnsafeCreateSharedWithDeleter(const uint8_t* data,
+                                         size_t size,
+                                         std::function<void()> deleter) {
+    return Blob(const_cast<uint8_t*>(data), size, deleter, true);
+}
 
-Blob::Blob(uint8_t* data, size_t size, std::function<void()> deleter)
-    : mData(data), mSize(size), mDeleter(std::move(deleter)) {
+Blob::Blob() : mData(nullptr), mSize(0), mDeleter({}), mIsShared(false) {}
+
+Blob::Blob(uint8_t* data, size_t size, std::function<void()> deleter, bool isShared)
+    : mData(data), mSize(size), mDeleter(std::move(deleter)), mIsShared(isShared) {
     // It is invalid to make a blob that has null data unless its size is also zero.
     ASSERT(data != nullptr || size == 0);
 }
 
-Blob::Blob(Blob&& rhs) : mData(rhs.mData), mSize(rhs.mSize) {
+Blob::Blob(Blob&& rhs) : mData(rhs.mData), mSize(rhs.mSize), mIsShared(rhs.mIsShared) {
     mDeleter = std::move(rhs.mDeleter);
     rhs.mDeleter = nullptr;
 }
@@ -60,6 +67,7 @@ Blob::Blob(Blob&& rhs) : mData(rhs.mData), mSize(rhs.mSize) {
 Blob& Blob::operator=(Blob&& rhs) {
     mData = rhs.mData;
     mSize = rhs.mSize;
+    mIsShared = rhs.mIsShared;
     if (mDeleter) {
         mDeleter();
     }
@@ -82,7 +90,12 @@ const uint8_t* Blob::Data() const {
     return mData;
 }
 
-uint8_t* Blob::Data() {
+uint8_t* Blob::MutableData() {
+    if (mIsShared) {
+        Blob copy = CreateBlob(mSize);
+        memcpy(copy.mData, mData, mSize);
+        *this = std::move(copy);
+    }
     return mData;
 }
 
@@ -96,7 +109,7 @@ void Blob::AlignTo(size_t alignment) {
     }
 
     Blob blob = CreateBlob(mSize, alignment);
-    memcpy(blob.Data(), mData, mSize);
+    memcpy(blob.mData, mData, mSize);
     *this = std::move(blob);
 }
 
@@ -118,7 +131,7 @@ MaybeError stream::Stream<Blob>::Read(stream::Source* s, Blob* b) {
         const void* ptr;
         DAWN_TRY(s->Read(&ptr, size));
         *b = CreateBlob(size);
-        memcpy(b->Data(), ptr, size);
+        memcpy(b->MutableData(), ptr, size);
     } else {
         *b = Blob();
     }
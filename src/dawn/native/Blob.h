@@ -31,6 +31,11 @@ class Blob {
     // This function is used to create Blob with actual data.
     // Make sure the creation and deleter handles the data ownership and lifetime correctly.
     static Blob UnsafeCreateWithDeleter(uint8_t* data, size_t size, std::function<void()> deleter);
+    // Same as UnsafeCreateWithDeleter, for data that is shared with other owners and must not be
+    // modified. MutableData() copies the data before giving write access to it.
+    static Blob UnsafeCreateSharedWithDeleter(const uint8_t* data,
+                                              size_t size,
+                                              std::function<void()> deleter);
 
     Blob();
     ~Blob();
@@ -43,7 +48,8 @@ class Blob {
 
     bool Empty() const;
     const uint8_t* Data() const;
-    uint8_t* Data();
+    // Returns writable data, first copying it into storage owned by this blob if it is shared.
+    uint8_t* MutableData();
     size_t Size() const;
 
     // If the blob data is not aligned to |alignment|, copy it into a new backing store which
@@ -53,11 +59,12 @@ class Blob {
   private:
     // The constructor should be responsible to take ownership of |data| and releases ownership by
     // calling |deleter|. The deleter function is called at ~Blob() and during std::move.
-    explicit Blob(uint8_t* data, size_t size, std::function<void()> deleter);
+    explicit Blob(uint8_t* data, size_t size, std::function<void()> deleter, bool isShared);
 
     uint8_t* mData;
     size_t mSize;
     std::function<void()> mDeleter;
+    bool mIsShared;
 };
 
 Blob CreateBlob(size_t size, size_t alignment = 1);
@@ -15,8 +15,12 @@
 #include "dawn/native/BlobCache.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
 
 #include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/CacheKey.h"
 #include "dawn/native/Instance.h"
@@ -24,38 +28,189 @@
 
 namespace dawn::native {
 
-BlobCache::BlobCache(dawn::platform::CachingInterface* cachingInterface)
-    : mCache(cachingInterface) {}
+namespace {
+
+// Values that fit in this many bytes are loaded from the CachingInterface in a single call.
+// The load buffer grows up to kMaxLoadBufferSize to fit the largest value loaded so far.
+constexpr size_t kInitialLoadBufferSize = 64 * 1024;
+constexpr size_t kMaxLoadBufferSize = 4 * 1024 * 1024;
+
+// Returns a blob that shares the storage of |blob| and keeps it alive.
+Blob ShareBlob(std::shared_ptr<const Blob> blob) {
+    const uint8_t* data = blob->Data();
+    size_t size = blob->Size();
+    return Blob::UnsafeCreateSharedWithDeleter(data, size, [blob]() mutable { blob.reset(); });
+}
+
+}  // anonymous namespace
+
+BlobCache::BlobCache(dawn::platform::CachingInterface* cachingInterface, size_t memoryCacheSize)
+    : mCache(cachingInterface), mMemoryCacheSize(memoryCacheSize) {}
 
 Blob BlobCache::Load(const CacheKey& key) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    return LoadInternal(key);
+    const auto start = std::chrono::steady_clock::now();
+    auto recordLatency = [&]() {
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        RecordLoadLatency(static_cast<uint64_t>(latency.count()));
+    };
+
+    const bool useMemoryCache = mMemoryCacheSize.load(std::memory_order_relaxed) > 0;
+    std::string memoryCacheKey;
+    if (useMemoryCache) {
+        memoryCacheKey.assign(reinterpret_cast<const char*>(key.data()), key.size());
+        Blob result = LoadFromMemoryCache(memoryCacheKey);
+        if (!result.Empty()) {
+            mMemoryHitCount++;
+            mLoadedBytes += result.Size();
+            recordLatency();
+            return result;
+        }
+    }
+
+    Blob result;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        result = LoadInternal(key);
+    }
+
+    if (result.Empty()) {
+        mMissCount++;
+    } else {
+        mPlatformHitCount++;
+        mLoadedBytes += result.Size();
+        if (useMemoryCache) {
+            auto sharedResult = std::make_shared<Blob>(std::move(result));
+            StoreInMemoryCache(std::move(memoryCacheKey), sharedResult);
+            result = ShareBlob(std::move(sharedResult));
+        }
+    }
+    recordLatency();
+    return result;
 }
 
 void BlobCache::Store(const CacheKey& key, size_t valueSize, const void* value) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    StoreInternal(key, valueSize, value);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        StoreInternal(key, valueSize, value);
+    }
+    mStoredBytes += valueSize;
+
+    if (valueSize <= mMemoryCacheSize.load(std::memory_order_relaxed)) {
+        auto blob = std::make_shared<Blob>(CreateBlob(valueSize));
+        memcpy(blob->MutableData(), value, valueSize);
+        StoreInMemoryCache(std::string(reinterpret_cast<const char*>(key.data()), key.size()),
+                           std::move(blob));
+    }
 }
 
 void BlobCache::Store(const CacheKey& key, const Blob& value) {
     Store(key, value.Size(), value.Data());
 }
 
+void BlobCache::SetMemoryCacheSize(size_t size) {
+    std::lock_guard<std::mutex> lock(mMemoryCacheMutex);
+    mMemoryCacheSize = size;
+    EvictFromMemoryCacheUntilUsageIsAtMost(size);
+}
+
+BlobCacheStatistics BlobCache::GetStatistics() const {
+    BlobCacheStatistics statistics;
+    statistics.memoryHitCount = mMemoryHitCount.load();
+    statistics.platformHitCount = mPlatformHitCount.load();
+    statistics.missCount = mMissCount.load();
+    statistics.loadedBytes = mLoadedBytes.load();
+    statistics.storedBytes = mStoredBytes.load();
+    for (size_t i = 0; i < BlobCacheStatistics::kLoadLatencyBucketCount; ++i) {
+        statistics.loadLatencyHistogram[i] = mLoadLatencyHistogram[i].load();
+    }
+    return statistics;
+}
+
+Blob BlobCache::LoadFromMemoryCache(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mMemoryCacheMutex);
+    auto it = mMemoryCacheEntries.find(key);
+    if (it == mMemoryCacheEntries.end()) {
+        return Blob();
+    }
+    mMemoryCacheLRUList.splice(mMemoryCacheLRUList.end(), mMemoryCacheLRUList,
+                               it->second.lruIterator);
+    return ShareBlob(it->second.blob);
+}
+
+void BlobCache::StoreInMemoryCache(std::string key, std::shared_ptr<const Blob> blob) {
+    std::lock_guard<std::mutex> lock(mMemoryCacheMutex);
+    const size_t size = blob->Size();
+    if (size > mMemoryCacheSize) {
+        return;
+    }
+
+    auto existing = mMemoryCacheEntries.find(key);
+    if (existing != mMemoryCacheEntries.end()) {
+        mMemoryCacheUsage -= existing->second.blob->Size();
+        mMemoryCacheLRUList.erase(existing->second.lruIterator);
+        mMemoryCacheEntries.erase(existing);
+    }
+    EvictFromMemoryCacheUntilUsageIsAtMost(mMemoryCacheSize - size);
+
+    auto [it, inserted] = mMemoryCacheEntries.emplace(std::move(key), MemoryCacheEntry{});
+    ASSERT(inserted);
+    it->second.blob = std::move(blob);
+    it->second.lruIterator = mMemoryCacheLRUList.insert(mMemoryCacheLRUList.end(), &it->first);
+    mMemoryCacheUsage += size;
+}
+
+void BlobCache::EvictFromMemoryCacheUntilUsageIsAtMost(size_t size) {
+    while (mMemoryCacheUsage > size) {
+        ASSERT(!mMemoryCacheLRUList.empty());
+        auto it = mMemoryCacheEntries.find(*mMemoryCacheLRUList.front());
+        mMemoryCacheUsage -= it->second.blob->Size();
+        mMemoryCacheLRUList.pop_front();
+        mMemoryCacheEntries.erase(it);
+    }
+}
+
+void BlobCache::RecordLoadLatency(uint64_t latencyInMicroseconds) {
+    size_t bucket = 0;
+    if (latencyInMicroseconds > 0) {
+        bucket = std::min<size_t>(Log2(latencyInMicroseconds) + 1,
+                                  BlobCacheStatistics::kLoadLatencyBucketCount - 1);
+    }
+    mLoadLatencyHistogram[bucket]++;
+}
+
 Blob BlobCache::LoadInternal(const CacheKey& key) {
     ASSERT(ValidateCacheKey(key));
     if (mCache == nullptr) {
         return Blob();
     }
-    const size_t expectedSize = mCache->LoadData(key.data(), key.size(), nullptr, 0);
-    if (expectedSize > 0) {
-        // Need to put this inside to trigger copy elision.
-        Blob result = CreateBlob(expectedSize);
-        const size_t actualSize =
-            mCache->LoadData(key.data(), key.size(), result.Data(), expectedSize);
-        ASSERT(expectedSize == actualSize);
+
+    // Load into the reusable buffer without querying the size first, so that values that fit in
+    // it only take one call to the CachingInterface.
+    if (mLoadBuffer.empty()) {
+        mLoadBuffer.resize(kInitialLoadBufferSize);
+    }
+    const size_t size =
+        mCache->LoadData(key.data(), key.size(), mLoadBuffer.data(), mLoadBuffer.size());
+    if (size == 0) {
+        return Blob();
+    }
+    if (size <= mLoadBuffer.size()) {
+        Blob result = CreateBlob(size);
+        memcpy(result.MutableData(), mLoadBuffer.data(), size);
         return result;
     }
-    return Blob();
+
+    // The value didn't fit so only its size was returned. Load it again with the right size.
+    if (size <= kMaxLoadBufferSize) {
+        mLoadBuffer.resize(size);
+    }
+    Blob result = CreateBlob(size);
+    // The entry may have been evicted, or found to be corrupted, since the first call.
+    if (mCache->LoadData(key.data(), key.size(), result.MutableData(), size) != size) {
+        return Blob();
+    }
+    return result;
 }
 
 void BlobCache::StoreInternal(const CacheKey& key, size_t valueSize, const void* value) {
@@ -15,11 +15,19 @@
 #ifndef SRC_DAWN_NATIVE_BLOBCACHE_H_
 #define SRC_DAWN_NATIVE_BLOBCACHE_H_
 
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "dawn/common/Platform.h"
 #include "dawn/native/Blob.h"
 #include "dawn/native/CacheResult.h"
+#include "dawn/native/DawnNative.h"
 
 namespace dawn::platform {
 class CachingInterface;
@@ -34,9 +42,11 @@ class InstanceBase;
 // is to wrap the CachingInterface provided via a platform.
 class BlobCache {
   public:
-    explicit BlobCache(dawn::platform::CachingInterface* cachingInterface = nullptr);
+    explicit BlobCache(dawn::platform::CachingInterface* cachingInterface = nullptr,
+                       size_t memoryCacheSize = 0);
 
-    // Returns empty blob if the key is not found in the cache.
+    // Returns empty blob if the key is not found in the cache. Blobs served from the in-memory
+    // cache share their storage with it, so Blob::MutableData() copies them before writing.
     Blob Load(const CacheKey& key);
 
     // Value to store must be non-empty/non-null.
@@ -56,7 +66,26 @@ class BlobCache {
         }
     }
 
+    // Sets the maximum total size of the blobs kept in the in-memory cache in front of the
+    // CachingInterface, evicting the least recently used blobs if needed. 0 disables it.
+    void SetMemoryCacheSize(size_t size);
+
+    BlobCacheStatistics GetStatistics() const;
+
   private:
+    struct MemoryCacheEntry {
+        std::shared_ptr<const Blob> blob;
+        std::list<const std::string*>::iterator lruIterator;
+    };
+
+    // Returns a blob sharing the storage of the in-memory cache entry for |key|, or an empty blob
+    // if there is none. Thread-safe.
+    Blob LoadFromMemoryCache(const std::string& key);
+    // Adds |blob| to the in-memory cache if it is enabled and the blob fits. Thread-safe.
+    void StoreInMemoryCache(std::string key, std::shared_ptr<const Blob> blob);
+    void EvictFromMemoryCacheUntilUsageIsAtMost(size_t size);
+    void RecordLoadLatency(uint64_t latencyInMicroseconds);
+
     // Non-thread safe internal implementations of load and store. Exposed callers that use
     // these helpers need to make sure that these are entered with `mMutex` held.
     Blob LoadInternal(const CacheKey& key);
@@ -66,9 +95,29 @@ class BlobCache {
     // that the cache key contains the dawn version string in it.
     bool ValidateCacheKey(const CacheKey& key);
 
-    // Protects thread safety of access to mCache.
+    // Protects thread safety of access to mCache and mLoadBuffer.
     std::mutex mMutex;
     dawn::platform::CachingInterface* mCache;
+    // Values are loaded from mCache into this buffer, which avoids querying their size first.
+    std::vector<uint8_t> mLoadBuffer;
+
+    // The in-memory cache has its own lock so that hits don't wait on calls to mCache.
+    std::mutex mMemoryCacheMutex;
+    // Written with mMemoryCacheMutex held, but also read without it to skip the in-memory cache
+    // entirely when it is disabled.
+    std::atomic<size_t> mMemoryCacheSize;
+    size_t mMemoryCacheUsage = 0;
+    std::unordered_map<std::string, MemoryCacheEntry> mMemoryCacheEntries;
+    // Keys of mMemoryCacheEntries, from least to most recently used.
+    std::list<const std::string*> mMemoryCacheLRUList;
+
+    std::atomic<uint64_t> mMemoryHitCount{0};
+    std::atomic<uint64_t> mPlatformHitCount{0};
+    std::atomic<uint64_t> mMissCount{0};
+    std::atomic<uint64_t> mLoadedBytes{0};
+    std::atomic<uint64_t> mStoredBytes{0};
+    std::array<std::atomic<uint64_t>, BlobCacheStatistics::kLoadLatencyBucketCount>
+        mLoadLatencyHistogram = {};
 };
 
 }  // namespace dawn::native
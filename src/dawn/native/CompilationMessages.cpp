@@ -70,7 +70,7 @@ void OwnedCompilationMessages::AddMessage(const tint::diag::Diagnostic& diagnost
     uint64_t length = 0;
 
     if (lineNum && linePos && diagnostic.source.file) {
-        const auto& lines = diagnostic.source.file->content.lines;
+        const auto& lines = diagnostic.source.file->content.Lines();
         size_t i = 0;
         // To find the offset of the message position, loop through each of the first lineNum-1
         // lines and add it's length (+1 to account for the line break) to the offset.
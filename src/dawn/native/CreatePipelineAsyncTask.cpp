@@ -132,30 +132,54 @@ void CreateComputePipelineAsyncTask::Run() {
     if (maybeError.IsError()) {
         mComputePipeline = nullptr;
         errorMessage = maybeError.AcquireError()->GetMessage();
+    } else {
+        mCompilation->succeeded = true;
     }
+    device->RemovePendingComputePipelineCompilation(mCompilation.Get());
 
     device->AddComputePipelineAsyncCallbackTask(mComputePipeline, errorMessage, mCallback,
                                                 mUserdata);
 }
 
+void CreateComputePipelineAsyncTask::Cancel() {
+    DeviceBase* device = mComputePipeline->GetDevice();
+    device->RemovePendingComputePipelineCompilation(mCompilation.Get());
+    device->AddComputePipelineAsyncCallbackTask(nullptr, "Pipeline creation was cancelled.",
+                                                mCallback, mUserdata);
+}
+
 void CreateComputePipelineAsyncTask::RunAsync(
     std::unique_ptr<CreateComputePipelineAsyncTask> task) {
     DeviceBase* device = task->mComputePipeline->GetDevice();
 
     const char* eventLabel = utils::GetLabelForTrace(task->mComputePipeline->GetLabel().c_str());
 
+    // Track the compilation on the device until it completes so that a synchronous creation of
+    // the same pipeline can steal it.
+    Ref<PendingComputePipelineCompilation> compilation =
+        AcquireRef(new PendingComputePipelineCompilation(task->mComputePipeline));
+    task->mCompilation = compilation;
+    device->AddPendingComputePipelineCompilation(compilation);
+
     // Using "taskPtr = std::move(task)" causes compilation error while it should be supported
     // since C++14:
     // https://docs.microsoft.com/en-us/cpp/cpp/lambda-expressions-in-cpp?view=msvc-160
-    auto asyncTask = [taskPtr = task.release()] {
+    // Exactly one of asyncTask and cancelTask is run, and it takes ownership of the task.
+    CreateComputePipelineAsyncTask* taskPtr = task.release();
+    auto asyncTask = [taskPtr] {
         std::unique_ptr<CreateComputePipelineAsyncTask> innnerTaskPtr(taskPtr);
         innnerTaskPtr->Run();
     };
+    auto cancelTask = [taskPtr] {
+        std::unique_ptr<CreateComputePipelineAsyncTask> innnerTaskPtr(taskPtr);
+        innnerTaskPtr->Cancel();
+    };
 
     TRACE_EVENT_FLOW_BEGIN1(device->GetPlatform(), General,
-                            "CreateComputePipelineAsyncTask::RunAsync", task.get(), "label",
+                            "CreateComputePipelineAsyncTask::RunAsync", taskPtr, "label",
                             eventLabel);
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+    compilation->task =
+        device->GetAsyncTaskManager()->PostTask(std::move(asyncTask), std::move(cancelTask));
 }
 
 CreateRenderPipelineAsyncTask::CreateRenderPipelineAsyncTask(
@@ -184,27 +208,51 @@ void CreateRenderPipelineAsyncTask::Run() {
     if (maybeError.IsError()) {
         mRenderPipeline = nullptr;
         errorMessage = maybeError.AcquireError()->GetMessage();
+    } else {
+        mCompilation->succeeded = true;
     }
+    device->RemovePendingRenderPipelineCompilation(mCompilation.Get());
 
     device->AddRenderPipelineAsyncCallbackTask(mRenderPipeline, errorMessage, mCallback, mUserdata);
 }
 
+void CreateRenderPipelineAsyncTask::Cancel() {
+    DeviceBase* device = mRenderPipeline->GetDevice();
+    device->RemovePendingRenderPipelineCompilation(mCompilation.Get());
+    device->AddRenderPipelineAsyncCallbackTask(nullptr, "Pipeline creation was cancelled.",
+                                               mCallback, mUserdata);
+}
+
 void CreateRenderPipelineAsyncTask::RunAsync(std::unique_ptr<CreateRenderPipelineAsyncTask> task) {
     DeviceBase* device = task->mRenderPipeline->GetDevice();
 
     const char* eventLabel = utils::GetLabelForTrace(task->mRenderPipeline->GetLabel().c_str());
 
+    // Track the compilation on the device until it completes so that a synchronous creation of
+    // the same pipeline can steal it.
+    Ref<PendingRenderPipelineCompilation> compilation =
+        AcquireRef(new PendingRenderPipelineCompilation(task->mRenderPipeline));
+    task->mCompilation = compilation;
+    device->AddPendingRenderPipelineCompilation(compilation);
+
     // Using "taskPtr = std::move(task)" causes compilation error while it should be supported
     // since C++14:
     // https://docs.microsoft.com/en-us/cpp/cpp/lambda-expressions-in-cpp?view=msvc-160
-    auto asyncTask = [taskPtr = task.release()] {
+    // Exactly one of asyncTask and cancelTask is run, and it takes ownership of the task.
+    CreateRenderPipelineAsyncTask* taskPtr = task.release();
+    auto asyncTask = [taskPtr] {
         std::unique_ptr<CreateRenderPipelineAsyncTask> innerTaskPtr(taskPtr);
         innerTaskPtr->Run();
     };
+    auto cancelTask = [taskPtr] {
+        std::unique_ptr<CreateRenderPipelineAsyncTask> innerTaskPtr(taskPtr);
+        innerTaskPtr->Cancel();
+    };
 
     TRACE_EVENT_FLOW_BEGIN1(device->GetPlatform(), General,
-                            "CreateRenderPipelineAsyncTask::RunAsync", task.get(), "label",
+                            "CreateRenderPipelineAsyncTask::RunAsync", taskPtr, "label",
                             eventLabel);
-    device->GetAsyncTaskManager()->PostTask(std::move(asyncTask));
+    compilation->task =
+        device->GetAsyncTaskManager()->PostTask(std::move(asyncTask), std::move(cancelTask));
 }
 }  // namespace dawn::native
@@ -17,8 +17,10 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "dawn/common/RefCounted.h"
+#include "dawn/native/AsyncTask.h"
 #include "dawn/native/CallbackTaskManager.h"
 #include "dawn/native/Error.h"
 #include "dawn/webgpu.h"
@@ -73,6 +75,23 @@ struct CreateRenderPipelineAsyncCallbackTask : CreatePipelineAsyncCallbackTaskBa
     WGPUCreateRenderPipelineAsyncCallback mCreateRenderPipelineAsyncCallback;
 };
 
+// The compilation of a pipeline created with Create*PipelineAsync that is tracked by the device
+// until it completes, so that a synchronous creation of an identical pipeline can steal the
+// compilation instead of compiling the pipeline a second time.
+template <typename Pipeline>
+struct PendingPipelineCompilation : RefCounted {
+    explicit PendingPipelineCompilation(Ref<Pipeline> pipelineIn)
+        : pipeline(std::move(pipelineIn)) {}
+
+    Ref<Pipeline> pipeline;
+    Ref<AsyncTaskManager::WaitableTask> task;
+    // Only valid once the body of |task| completed.
+    bool succeeded = false;
+};
+
+using PendingComputePipelineCompilation = PendingPipelineCompilation<ComputePipelineBase>;
+using PendingRenderPipelineCompilation = PendingPipelineCompilation<RenderPipelineBase>;
+
 // CreateComputePipelineAsyncTask defines all the inputs and outputs of
 // CreateComputePipelineAsync() tasks, which are the same among all the backends.
 class CreateComputePipelineAsyncTask {
@@ -83,6 +102,7 @@ class CreateComputePipelineAsyncTask {
     ~CreateComputePipelineAsyncTask();
 
     void Run();
+    void Cancel();
 
     static void RunAsync(std::unique_ptr<CreateComputePipelineAsyncTask> task);
 
@@ -90,6 +110,7 @@ class CreateComputePipelineAsyncTask {
     Ref<ComputePipelineBase> mComputePipeline;
     WGPUCreateComputePipelineAsyncCallback mCallback;
     void* mUserdata;
+    Ref<PendingComputePipelineCompilation> mCompilation;
 };
 
 // CreateRenderPipelineAsyncTask defines all the inputs and outputs of
@@ -102,6 +123,7 @@ class CreateRenderPipelineAsyncTask {
     ~CreateRenderPipelineAsyncTask();
 
     void Run();
+    void Cancel();
 
     static void RunAsync(std::unique_ptr<CreateRenderPipelineAsyncTask> task);
 
@@ -109,6 +131,7 @@ class CreateRenderPipelineAsyncTask {
     Ref<RenderPipelineBase> mRenderPipeline;
     WGPUCreateRenderPipelineAsyncCallback mCallback;
     void* mUserdata;
+    Ref<PendingRenderPipelineCompilation> mCompilation;
 };
 
 }  // namespace dawn::native
@@ -18,6 +18,7 @@
 
 #include "dawn/common/Log.h"
 #include "dawn/native/BindGroupLayout.h"
+#include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/Instance.h"
@@ -240,6 +241,14 @@ void Instance::SetPlatform(dawn::platform::Platform* platform) {
     mImpl->SetPlatform(platform);
 }
 
+void Instance::SetBlobCacheMemorySize(size_t size) {
+    mImpl->SetBlobCacheMemorySize(size);
+}
+
+BlobCacheStatistics Instance::GetBlobCacheStatistics() const {
+    return mImpl->GetBlobCache()->GetStatistics();
+}
+
 uint64_t Instance::GetDeviceCountForTesting() const {
     return mImpl->GetDeviceCountForTesting();
 }
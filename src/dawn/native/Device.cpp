@@ -17,8 +17,10 @@
 #include <algorithm>
 #include <array>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "dawn/common/ConcurrentCache.h"
 #include "dawn/common/Log.h"
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/Adapter.h"
@@ -60,7 +62,9 @@ namespace dawn::native {
 // DeviceBase sub-structures
 
 // The caches are unordered_sets of pointers with special hash and compare functions
-// to compare the value of the objects, instead of the pointers.
+// to compare the value of the objects, instead of the pointers. Samplers and bind group layouts
+// are looked up for every pipeline and bind group creation, so they use a sharded
+// ConcurrentCache instead.
 template <typename Object>
 using ContentLessObjectCache =
     std::unordered_set<Object*, typename Object::HashFunc, typename Object::EqualityFunc>;
@@ -68,23 +72,43 @@ using ContentLessObjectCache =
 struct DeviceBase::Caches {
     ~Caches() {
         ASSERT(attachmentStates.empty());
-        ASSERT(bindGroupLayouts.empty());
+        ASSERT(bindGroupLayouts.Empty());
         ASSERT(computePipelines.empty());
         ASSERT(pipelineLayouts.empty());
         ASSERT(renderPipelines.empty());
-        ASSERT(samplers.empty());
+        ASSERT(samplers.Empty());
         ASSERT(shaderModules.empty());
     }
 
     ContentLessObjectCache<AttachmentStateBlueprint> attachmentStates;
-    ContentLessObjectCache<BindGroupLayoutBase> bindGroupLayouts;
+    ConcurrentCache<BindGroupLayoutBase> bindGroupLayouts;
     ContentLessObjectCache<ComputePipelineBase> computePipelines;
     ContentLessObjectCache<PipelineLayoutBase> pipelineLayouts;
     ContentLessObjectCache<RenderPipelineBase> renderPipelines;
-    ContentLessObjectCache<SamplerBase> samplers;
+    ConcurrentCache<SamplerBase> samplers;
     ContentLessObjectCache<ShaderModuleBase> shaderModules;
 };
 
+struct DeviceBase::PendingPipelineCompilations {
+    ~PendingPipelineCompilations() {
+        ASSERT(computePipelines.empty());
+        ASSERT(renderPipelines.empty());
+    }
+
+    // The compilations complete on worker threads so the maps are protected by a mutex.
+    std::mutex mutex;
+    std::unordered_map<ComputePipelineBase*,
+                       Ref<PendingComputePipelineCompilation>,
+                       ComputePipelineBase::HashFunc,
+                       ComputePipelineBase::EqualityFunc>
+        computePipelines;
+    std::unordered_map<RenderPipelineBase*,
+                       Ref<PendingRenderPipelineCompilation>,
+                       RenderPipelineBase::HashFunc,
+                       RenderPipelineBase::EqualityFunc>
+        renderPipelines;
+};
+
 struct DeviceBase::DeprecationWarnings {
     std::unordered_set<std::string> emitted;
     size_t count = 0;
@@ -215,6 +239,7 @@ DeviceBase::DeviceBase(AdapterBase* adapter, const DeviceDescriptor* descriptor)
 
 DeviceBase::DeviceBase() : mState(State::Alive) {
     mCaches = std::make_unique<DeviceBase::Caches>();
+    mPendingPipelineCompilations = std::make_unique<DeviceBase::PendingPipelineCompilations>();
 }
 
 DeviceBase::~DeviceBase() {
@@ -255,6 +280,7 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
 #endif  // DAWN_ENABLE_ASSERTS
 
     mCaches = std::make_unique<DeviceBase::Caches>();
+    mPendingPipelineCompilations = std::make_unique<DeviceBase::PendingPipelineCompilations>();
     mErrorScopeStack = std::make_unique<ErrorScopeStack>();
     mDynamicUploader = std::make_unique<DynamicUploader>(this);
     mCallbackTaskManager = std::make_unique<CallbackTaskManager>();
@@ -401,8 +427,9 @@ void DeviceBase::Destroy() {
             mDeviceLostCallback = nullptr;
         }
 
-        // Call all the callbacks immediately as the device is about to shut down.
-        // TODO(crbug.com/dawn/826): Cancel the tasks that are in flight if possible.
+        // Call all the callbacks immediately as the device is about to shut down. Tasks that
+        // haven't started yet are cancelled since their results would be discarded anyway.
+        mAsyncTaskManager->CancelAllPendingTasks();
         mAsyncTaskManager->WaitAllPendingTasks();
         auto callbackTasks = mCallbackTaskManager->AcquireCallbackTasks();
         for (std::unique_ptr<CallbackTask>& callbackTask : callbackTasks) {
@@ -525,7 +552,7 @@ void DeviceBase::HandleError(InternalErrorType type, const char* message) {
 
         mQueue->HandleDeviceLoss();
 
-        // TODO(crbug.com/dawn/826): Cancel the tasks that are in flight if possible.
+        mAsyncTaskManager->CancelAllPendingTasks();
         mAsyncTaskManager->WaitAllPendingTasks();
         auto callbackTasks = mCallbackTaskManager->AcquireCallbackTasks();
         for (std::unique_ptr<CallbackTask>& callbackTask : callbackTasks) {
@@ -623,14 +650,9 @@ bool DeviceBase::APIPopErrorScope(wgpu::ErrorCallback callback, void* userdata)
 }
 
 BlobCache* DeviceBase::GetBlobCache() {
-#if TINT_BUILD_WGSL_WRITER
-    // TODO(crbug.com/dawn/1481): Shader caching currently has a dependency on the WGSL writer to
-    // generate cache keys. We can lift the dependency once we also cache frontend parsing,
-    // transformations, and reflection.
     if (IsToggleEnabled(Toggle::EnableBlobCache)) {
         return mInstance->GetBlobCache();
     }
-#endif
     return nullptr;
 }
 
@@ -800,23 +822,25 @@ ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::GetOrCreateBindGroupLayout(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<BindGroupLayoutBase> result;
-    auto iter = mCaches->bindGroupLayouts.find(&blueprint);
-    if (iter != mCaches->bindGroupLayouts.end()) {
-        result = *iter;
-    } else {
-        DAWN_TRY_ASSIGN(result, CreateBindGroupLayoutImpl(descriptor, pipelineCompatibilityToken));
-        result->SetIsCachedReference();
-        result->SetContentHash(blueprintHash);
-        mCaches->bindGroupLayouts.insert(result.Get());
+    Ref<BindGroupLayoutBase> result = mCaches->bindGroupLayouts.Find(&blueprint);
+    if (result != nullptr) {
+        return std::move(result);
     }
 
+    DAWN_TRY_ASSIGN(result, CreateBindGroupLayoutImpl(descriptor, pipelineCompatibilityToken));
+    result->SetContentHash(blueprintHash);
+    auto [cachedObject, inserted] = mCaches->bindGroupLayouts.Insert(result.Get());
+    if (!inserted) {
+        // Another thread cached an equal object first.
+        return Ref<BindGroupLayoutBase>(cachedObject);
+    }
+    result->SetIsCachedReference();
     return std::move(result);
 }
 
 void DeviceBase::UncacheBindGroupLayout(BindGroupLayoutBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->bindGroupLayouts.erase(obj);
+    size_t removedCount = mCaches->bindGroupLayouts.Erase(obj);
     ASSERT(removedCount == 1);
 }
 
@@ -855,6 +879,64 @@ Ref<RenderPipelineBase> DeviceBase::GetCachedRenderPipeline(
     return cachedPipeline;
 }
 
+Ref<PendingComputePipelineCompilation> DeviceBase::GetPendingComputePipelineCompilation(
+    ComputePipelineBase* uninitializedComputePipeline) {
+    std::lock_guard<std::mutex> lock(mPendingPipelineCompilations->mutex);
+    Ref<PendingComputePipelineCompilation> compilation;
+    auto iter = mPendingPipelineCompilations->computePipelines.find(uninitializedComputePipeline);
+    if (iter != mPendingPipelineCompilations->computePipelines.end()) {
+        compilation = iter->second;
+    }
+    return compilation;
+}
+
+Ref<PendingRenderPipelineCompilation> DeviceBase::GetPendingRenderPipelineCompilation(
+    RenderPipelineBase* uninitializedRenderPipeline) {
+    std::lock_guard<std::mutex> lock(mPendingPipelineCompilations->mutex);
+    Ref<PendingRenderPipelineCompilation> compilation;
+    auto iter = mPendingPipelineCompilations->renderPipelines.find(uninitializedRenderPipeline);
+    if (iter != mPendingPipelineCompilations->renderPipelines.end()) {
+        compilation = iter->second;
+    }
+    return compilation;
+}
+
+void DeviceBase::AddPendingComputePipelineCompilation(
+    Ref<PendingComputePipelineCompilation> compilation) {
+    std::lock_guard<std::mutex> lock(mPendingPipelineCompilations->mutex);
+    // If an identical pipeline is already being compiled, keep tracking the first compilation.
+    ComputePipelineBase* pipeline = compilation->pipeline.Get();
+    mPendingPipelineCompilations->computePipelines.emplace(pipeline, std::move(compilation));
+}
+
+void DeviceBase::RemovePendingComputePipelineCompilation(
+    PendingComputePipelineCompilation* compilation) {
+    std::lock_guard<std::mutex> lock(mPendingPipelineCompilations->mutex);
+    auto iter = mPendingPipelineCompilations->computePipelines.find(compilation->pipeline.Get());
+    if (iter != mPendingPipelineCompilations->computePipelines.end() &&
+        iter->second.Get() == compilation) {
+        mPendingPipelineCompilations->computePipelines.erase(iter);
+    }
+}
+
+void DeviceBase::AddPendingRenderPipelineCompilation(
+    Ref<PendingRenderPipelineCompilation> compilation) {
+    std::lock_guard<std::mutex> lock(mPendingPipelineCompilations->mutex);
+    // If an identical pipeline is already being compiled, keep tracking the first compilation.
+    RenderPipelineBase* pipeline = compilation->pipeline.Get();
+    mPendingPipelineCompilations->renderPipelines.emplace(pipeline, std::move(compilation));
+}
+
+void DeviceBase::RemovePendingRenderPipelineCompilation(
+    PendingRenderPipelineCompilation* compilation) {
+    std::lock_guard<std::mutex> lock(mPendingPipelineCompilations->mutex);
+    auto iter = mPendingPipelineCompilations->renderPipelines.find(compilation->pipeline.Get());
+    if (iter != mPendingPipelineCompilations->renderPipelines.end() &&
+        iter->second.Get() == compilation) {
+        mPendingPipelineCompilations->renderPipelines.erase(iter);
+    }
+}
+
 Ref<ComputePipelineBase> DeviceBase::AddOrGetCachedComputePipeline(
     Ref<ComputePipelineBase> computePipeline) {
     auto [cachedPipeline, inserted] = mCaches->computePipelines.insert(computePipeline.Get());
@@ -952,23 +1034,25 @@ ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<SamplerBase> result;
-    auto iter = mCaches->samplers.find(&blueprint);
-    if (iter != mCaches->samplers.end()) {
-        result = *iter;
-    } else {
-        DAWN_TRY_ASSIGN(result, CreateSamplerImpl(descriptor));
-        result->SetIsCachedReference();
-        result->SetContentHash(blueprintHash);
-        mCaches->samplers.insert(result.Get());
+    Ref<SamplerBase> result = mCaches->samplers.Find(&blueprint);
+    if (result != nullptr) {
+        return std::move(result);
     }
 
+    DAWN_TRY_ASSIGN(result, CreateSamplerImpl(descriptor));
+    result->SetContentHash(blueprintHash);
+    auto [cachedObject, inserted] = mCaches->samplers.Insert(result.Get());
+    if (!inserted) {
+        // Another thread cached an equal object first.
+        return Ref<SamplerBase>(cachedObject);
+    }
+    result->SetIsCachedReference();
     return std::move(result);
 }
 
 void DeviceBase::UncacheSampler(SamplerBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->samplers.erase(obj);
+    size_t removedCount = mCaches->samplers.Erase(obj);
     ASSERT(removedCount == 1);
 }
 
@@ -978,7 +1062,7 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
     OwnedCompilationMessages* compilationMessages) {
     ASSERT(parseResult != nullptr);
 
-    ShaderModuleBase blueprint(this, descriptor, ApiObjectBase::kUntrackedByDevice);
+    ShaderModuleBase blueprint(this, descriptor, parseResult, ApiObjectBase::kUntrackedByDevice);
 
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
@@ -1470,6 +1554,18 @@ ResultOrError<Ref<ComputePipelineBase>> DeviceBase::CreateComputePipeline(
         return cachedComputePipeline;
     }
 
+    // If an identical pipeline is being created asynchronously, steal its compilation (or wait
+    // for it if it is already running) instead of compiling the pipeline a second time. On
+    // failure the pipeline is compiled again to produce the error on the synchronous path.
+    Ref<PendingComputePipelineCompilation> pendingCompilation =
+        GetPendingComputePipelineCompilation(uninitializedComputePipeline.Get());
+    if (pendingCompilation != nullptr) {
+        ASSERT(pendingCompilation->task != nullptr);
+        if (pendingCompilation->task->RunNow() && pendingCompilation->succeeded) {
+            return AddOrGetCachedComputePipeline(pendingCompilation->pipeline);
+        }
+    }
+
     DAWN_TRY(uninitializedComputePipeline->Initialize());
     return AddOrGetCachedComputePipeline(std::move(uninitializedComputePipeline));
 }
@@ -1631,6 +1727,18 @@ ResultOrError<Ref<RenderPipelineBase>> DeviceBase::CreateRenderPipeline(
         return cachedRenderPipeline;
     }
 
+    // If an identical pipeline is being created asynchronously, steal its compilation (or wait
+    // for it if it is already running) instead of compiling the pipeline a second time. On
+    // failure the pipeline is compiled again to produce the error on the synchronous path.
+    Ref<PendingRenderPipelineCompilation> pendingCompilation =
+        GetPendingRenderPipelineCompilation(uninitializedRenderPipeline.Get());
+    if (pendingCompilation != nullptr) {
+        ASSERT(pendingCompilation->task != nullptr);
+        if (pendingCompilation->task->RunNow() && pendingCompilation->succeeded) {
+            return AddOrGetCachedRenderPipeline(pendingCompilation->pipeline);
+        }
+    }
+
     DAWN_TRY(uninitializedRenderPipeline->Initialize());
     return AddOrGetCachedRenderPipeline(std::move(uninitializedRenderPipeline));
 }
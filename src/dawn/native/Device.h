@@ -57,6 +57,8 @@ class OwnedCompilationMessages;
 struct CallbackTask;
 struct InternalPipelineStore;
 struct ShaderModuleParseResult;
+template <typename Pipeline>
+struct PendingPipelineCompilation;
 
 using WGSLExtensionSet = std::unordered_set<std::string>;
 
@@ -393,6 +395,18 @@ class DeviceBase : public RefCountedWithExternalCount {
                                             WGPUCreateRenderPipelineAsyncCallback callback,
                                             void* userdata);
 
+    // Track the compilations of pipelines created asynchronously until they complete, so that a
+    // synchronous creation of an identical pipeline can steal them. The removal can happen on any
+    // thread.
+    void AddPendingComputePipelineCompilation(
+        Ref<PendingPipelineCompilation<ComputePipelineBase>> compilation);
+    void RemovePendingComputePipelineCompilation(
+        PendingPipelineCompilation<ComputePipelineBase>* compilation);
+    void AddPendingRenderPipelineCompilation(
+        Ref<PendingPipelineCompilation<RenderPipelineBase>> compilation);
+    void RemovePendingRenderPipelineCompilation(
+        PendingPipelineCompilation<RenderPipelineBase>* compilation);
+
     PipelineCompatibilityToken GetNextPipelineCompatibilityToken();
 
     const CacheKey& GetCacheKey() const;
@@ -467,6 +481,10 @@ class DeviceBase : public RefCountedWithExternalCount {
     Ref<ComputePipelineBase> AddOrGetCachedComputePipeline(
         Ref<ComputePipelineBase> computePipeline);
     Ref<RenderPipelineBase> AddOrGetCachedRenderPipeline(Ref<RenderPipelineBase> renderPipeline);
+    Ref<PendingPipelineCompilation<ComputePipelineBase>> GetPendingComputePipelineCompilation(
+        ComputePipelineBase* uninitializedComputePipeline);
+    Ref<PendingPipelineCompilation<RenderPipelineBase>> GetPendingRenderPipelineCompilation(
+        RenderPipelineBase* uninitializedRenderPipeline);
     virtual Ref<PipelineCacheBase> GetOrCreatePipelineCacheImpl(const CacheKey& key);
     virtual void InitializeComputePipelineAsyncImpl(Ref<ComputePipelineBase> computePipeline,
                                                     WGPUCreateComputePipelineAsyncCallback callback,
@@ -538,6 +556,9 @@ class DeviceBase : public RefCountedWithExternalCount {
     struct Caches;
     std::unique_ptr<Caches> mCaches;
 
+    struct PendingPipelineCompilations;
+    std::unique_ptr<PendingPipelineCompilations> mPendingPipelineCompilations;
+
     Ref<BindGroupLayoutBase> mEmptyBindGroupLayout;
 
     Ref<TextureViewBase> mExternalTexturePlaceholderView;
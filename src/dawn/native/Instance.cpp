@@ -434,7 +434,7 @@ void InstanceBase::SetPlatform(dawn::platform::Platform* platform) {
     } else {
         mPlatform = platform;
     }
-    mBlobCache = std::make_unique<BlobCache>(GetCachingInterface(platform));
+    mBlobCache = std::make_unique<BlobCache>(GetCachingInterface(platform), mBlobCacheMemorySize);
 }
 
 void InstanceBase::SetPlatformForTesting(dawn::platform::Platform* platform) {
@@ -449,6 +449,11 @@ BlobCache* InstanceBase::GetBlobCache() {
     return mBlobCache.get();
 }
 
+void InstanceBase::SetBlobCacheMemorySize(size_t size) {
+    mBlobCacheMemorySize = size;
+    mBlobCache->SetMemoryCacheSize(size);
+}
+
 uint64_t InstanceBase::GetDeviceCountForTesting() const {
     return mDeviceCountForTesting.load();
 }
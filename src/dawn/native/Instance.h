@@ -93,6 +93,7 @@ class InstanceBase final : public RefCounted {
     void SetPlatformForTesting(dawn::platform::Platform* platform);
     dawn::platform::Platform* GetPlatform();
     BlobCache* GetBlobCache();
+    void SetBlobCacheMemorySize(size_t size);
 
     uint64_t GetDeviceCountForTesting() const;
     void IncrementDeviceCountForTesting();
@@ -136,6 +137,7 @@ class InstanceBase final : public RefCounted {
     dawn::platform::Platform* mPlatform = nullptr;
     std::unique_ptr<dawn::platform::Platform> mDefaultPlatform;
     std::unique_ptr<BlobCache> mBlobCache;
+    size_t mBlobCacheMemorySize = 0;
 
     std::vector<std::unique_ptr<BackendConnection>> mBackends;
     std::vector<Ref<AdapterBase>> mAdapters;
@@ -21,6 +21,7 @@
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/Constants.h"
 #include "dawn/common/HashUtils.h"
+#include "dawn/common/Sha256.h"
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/ChainUtils_autogen.h"
 #include "dawn/native/CompilationMessages.h"
@@ -883,6 +884,16 @@ MaybeError ReflectShaderUsingTint(const DeviceBase* device,
     }
     return {};
 }
+
+// Returns the WGSL source of `wgslDesc` that is shared through `parseResult`, copying it from the
+// descriptor on first use.
+std::shared_ptr<const std::string> GetOrCreateWgsl(const ShaderModuleWGSLDescriptor* wgslDesc,
+                                                   ShaderModuleParseResult* parseResult) {
+    if (parseResult->wgsl == nullptr) {
+        parseResult->wgsl = std::make_shared<const std::string>(wgslDesc->source);
+    }
+    return parseResult->wgsl;
+}
 }  // anonymous namespace
 
 ShaderModuleParseResult::ShaderModuleParseResult() = default;
@@ -962,11 +973,17 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
         DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages));
         parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
     } else if (wgslDesc) {
-        auto tintSource = std::make_unique<TintSource>("", wgslDesc->source);
+        std::shared_ptr<const std::string> wgsl;
+        if (wgslDesc == &newWgslDesc) {
+            wgsl = std::make_shared<const std::string>(std::move(newWgslCode));
+        } else {
+            wgsl = GetOrCreateWgsl(wgslDesc, parseResult);
+        }
+        auto tintSource = std::make_unique<TintSource>("", wgsl);
 
         if (device->IsToggleEnabled(Toggle::DumpShaders)) {
             std::ostringstream dumpedMsg;
-            dumpedMsg << "// Dumped WGSL:" << std::endl << wgslDesc->source;
+            dumpedMsg << "// Dumped WGSL:" << std::endl << *wgsl;
             device->EmitLog(WGPULoggingType_Info, dumpedMsg.str().c_str());
         }
 
@@ -1070,6 +1087,7 @@ MaybeError ValidateCompatibilityWithPipelineLayout(DeviceBase* device,
 
 ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
                                    const ShaderModuleDescriptor* descriptor,
+                                   ShaderModuleParseResult* parseResult,
                                    ApiObjectBase::UntrackedByDeviceTag tag)
     : ApiObjectBase(device, descriptor->label), mType(Type::Undefined) {
     ASSERT(descriptor->nextInChain != nullptr);
@@ -1079,17 +1097,29 @@ ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
     FindInChain(descriptor->nextInChain, &wgslDesc);
     ASSERT(spirvDesc || wgslDesc);
 
+    // The cache key is built from the original source so that the backend compilation requests
+    // can be keyed by the shader module without running Tint to serialize its program. The
+    // source is hashed once here, so that each request streams its digest instead of the whole
+    // source.
+    uint8_t sourceDigest[kSha256DigestSize];
     if (spirvDesc) {
         mType = Type::Spirv;
         mOriginalSpirv.assign(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
+        ComputeSha256(mOriginalSpirv.data(), mOriginalSpirv.size() * sizeof(uint32_t),
+                      sourceDigest);
+        StreamIn(&mCacheKey, mType, sourceDigest);
     } else if (wgslDesc) {
         mType = Type::Wgsl;
-        mWgsl = std::string(wgslDesc->source);
+        mWgsl = GetOrCreateWgsl(wgslDesc, parseResult);
+        ComputeSha256(mWgsl->data(), mWgsl->size(), sourceDigest);
+        StreamIn(&mCacheKey, mType, sourceDigest);
     }
 }
 
-ShaderModuleBase::ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor)
-    : ShaderModuleBase(device, descriptor, kUntrackedByDevice) {
+ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
+                                   const ShaderModuleDescriptor* descriptor,
+                                   ShaderModuleParseResult* parseResult)
+    : ShaderModuleBase(device, descriptor, parseResult, kUntrackedByDevice) {
     TrackInDevice();
 }
 
@@ -1132,13 +1162,18 @@ size_t ShaderModuleBase::ComputeContentHash() {
     ObjectContentHasher recorder;
     recorder.Record(mType);
     recorder.Record(mOriginalSpirv);
-    recorder.Record(mWgsl);
+    if (mType == Type::Wgsl) {
+        recorder.Record(*mWgsl);
+    }
     return recorder.GetContentHash();
 }
 
 bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
                                                 const ShaderModuleBase* b) const {
-    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv && a->mWgsl == b->mWgsl;
+    if (a->mType != b->mType || a->mOriginalSpirv != b->mOriginalSpirv) {
+        return false;
+    }
+    return a->mType != Type::Wgsl || a->mWgsl == b->mWgsl || *a->mWgsl == *b->mWgsl;
 }
 
 const tint::Program* ShaderModuleBase::GetTintProgram() const {
@@ -1202,6 +1237,12 @@ MaybeError ShaderModuleBase::InitializeBase(ShaderModuleParseResult* parseResult
     return {};
 }
 
+// static
+template <>
+void stream::Stream<ShaderModuleBase>::Write(stream::Sink* sink, const ShaderModuleBase& module) {
+    StreamIn(sink, module.GetCacheKey());
+}
+
 size_t PipelineLayoutEntryPointPairHashFunc::operator()(
     const PipelineLayoutEntryPointPair& pair) const {
     size_t hash = 0;
@@ -98,6 +98,10 @@ struct ShaderModuleParseResult {
 
     std::unique_ptr<tint::Program> tintProgram;
     std::unique_ptr<TintSource> tintSource;
+    // The WGSL source of the descriptor. It is shared by the tint::Source::File that the program
+    // was parsed from and by the shader modules created with this parse result, so that the
+    // source is only copied once.
+    std::shared_ptr<const std::string> wgsl;
 };
 
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
@@ -251,8 +255,11 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
   public:
     ShaderModuleBase(DeviceBase* device,
                      const ShaderModuleDescriptor* descriptor,
+                     ShaderModuleParseResult* parseResult,
                      ApiObjectBase::UntrackedByDeviceTag tag);
-    ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor);
+    ShaderModuleBase(DeviceBase* device,
+                     const ShaderModuleDescriptor* descriptor,
+                     ShaderModuleParseResult* parseResult);
     ~ShaderModuleBase() override;
 
     static Ref<ShaderModuleBase> MakeError(DeviceBase* device);
@@ -296,7 +303,7 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
     enum class Type { Undefined, Spirv, Wgsl };
     Type mType;
     std::vector<uint32_t> mOriginalSpirv;
-    std::string mWgsl;
+    std::shared_ptr<const std::string> mWgsl;
 
     EntryPointMetadataTable mEntryPoints;
     WGSLExtensionSet mEnabledWGSLExtensions;
@@ -19,20 +19,6 @@
 
 namespace dawn::native {
 
-// static
-template <>
-void stream::Stream<tint::Program>::Write(stream::Sink* sink, const tint::Program& p) {
-#if TINT_BUILD_WGSL_WRITER
-    tint::writer::wgsl::Options options{};
-    StreamIn(sink, tint::writer::wgsl::Generate(&p, options).wgsl);
-#else
-    // TODO(crbug.com/dawn/1481): We shouldn't need to write back to WGSL if we have a CacheKey
-    // built from the initial shader module input. Then, we would never need to parse the program
-    // and write back out to WGSL.
-    UNREACHABLE();
-#endif
-}
-
 // static
 template <>
 void stream::Stream<tint::sem::BindingPoint>::Write(stream::Sink* sink,
@@ -134,7 +134,8 @@ DefineStrings GetOverridableConstantsDefines(
 enum class Compiler { FXC, DXC };
 
 #define HLSL_COMPILATION_REQUEST_MEMBERS(X)                                     \
-    X(const tint::Program*, inputProgram)                                       \
+    X(const ShaderModuleBase*, shaderModule)                                    \
+    X(CacheKey::UnsafeUnkeyedValue<const tint::Program*>, inputProgram)         \
     X(std::string_view, entryPointName)                                         \
     X(SingleShaderStage, stage)                                                 \
     X(uint32_t, shaderModel)                                                    \
@@ -442,8 +443,8 @@ ResultOrError<std::string> TranslateToHLSL(
     {
         TRACE_EVENT0(tracePlatform.UnsafeGetValue(), General, "RunTransforms");
         DAWN_TRY_ASSIGN(transformedProgram,
-                        RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                      &transformOutputs, nullptr));
+                        RunTransforms(&transformManager, r.inputProgram.UnsafeGetValue(),
+                                      transformInputs, &transformOutputs, nullptr));
     }
 
     if (auto* data = transformOutputs.Get<tint::transform::Renamer::Data>()) {
@@ -531,13 +532,15 @@ ResultOrError<Ref<ShaderModule>> ShaderModule::Create(
     const ShaderModuleDescriptor* descriptor,
     ShaderModuleParseResult* parseResult,
     OwnedCompilationMessages* compilationMessages) {
-    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor));
+    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor, parseResult));
     DAWN_TRY(module->Initialize(parseResult, compilationMessages));
     return module;
 }
 
-ShaderModule::ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor)
-    : ShaderModuleBase(device, descriptor) {}
+ShaderModule::ShaderModule(Device* device,
+                           const ShaderModuleDescriptor* descriptor,
+                           ShaderModuleParseResult* parseResult)
+    : ShaderModuleBase(device, descriptor, parseResult) {}
 
 MaybeError ShaderModule::Initialize(ShaderModuleParseResult* parseResult,
                                     OwnedCompilationMessages* compilationMessages) {
@@ -656,7 +659,8 @@ ResultOrError<CompiledShader> ShaderModule::Compile(const ProgrammableStage& pro
         }
     }
 
-    req.hlsl.inputProgram = GetTintProgram();
+    req.hlsl.shaderModule = this;
+    req.hlsl.inputProgram = UnsafeUnkeyedValue(GetTintProgram());
     req.hlsl.entryPointName = programmableStage.entryPoint.c_str();
     req.hlsl.stage = stage;
     req.hlsl.firstIndexOffsetShaderRegister = layout->GetFirstIndexOffsetShaderRegister();
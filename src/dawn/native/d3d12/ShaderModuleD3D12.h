@@ -62,7 +62,9 @@ class ShaderModule final : public ShaderModuleBase {
                                           uint32_t compileFlags);
 
   private:
-    ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor);
+    ShaderModule(Device* device,
+                 const ShaderModuleDescriptor* descriptor,
+                 ShaderModuleParseResult* parseResult);
     ~ShaderModule() override = default;
     MaybeError Initialize(ShaderModuleParseResult* parseResult,
                           OwnedCompilationMessages* compilationMessages);
@@ -55,7 +55,9 @@ class ShaderModule final : public ShaderModuleBase {
                               const RenderPipeline* renderPipeline = nullptr);
 
   private:
-    ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor);
+    ShaderModule(Device* device,
+                 const ShaderModuleDescriptor* descriptor,
+                 ShaderModuleParseResult* parseResult);
     ~ShaderModule() override;
     MaybeError Initialize(ShaderModuleParseResult* parseResult,
                           OwnedCompilationMessages* compilationMessages);
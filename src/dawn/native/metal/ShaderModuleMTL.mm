@@ -36,7 +36,8 @@ namespace {
 using OptionalVertexPullingTransformConfig = std::optional<tint::transform::VertexPulling::Config>;
 
 #define MSL_COMPILATION_REQUEST_MEMBERS(X)                                               \
-    X(const tint::Program*, inputProgram)                                                \
+    X(const ShaderModuleBase*, shaderModule)                                             \
+    X(CacheKey::UnsafeUnkeyedValue<const tint::Program*>, inputProgram)                  \
     X(tint::transform::BindingRemapper::BindingPoints, bindingPoints)                    \
     X(tint::transform::MultiplanarExternalTexture::BindingsMap, externalTextureBindings) \
     X(OptionalVertexPullingTransformConfig, vertexPullingTransformConfig)                \
@@ -99,13 +100,15 @@ ResultOrError<Ref<ShaderModule>> ShaderModule::Create(
     const ShaderModuleDescriptor* descriptor,
     ShaderModuleParseResult* parseResult,
     OwnedCompilationMessages* compilationMessages) {
-    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor));
+    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor, parseResult));
     DAWN_TRY(module->Initialize(parseResult, compilationMessages));
     return module;
 }
 
-ShaderModule::ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor)
-    : ShaderModuleBase(device, descriptor) {}
+ShaderModule::ShaderModule(Device* device,
+                           const ShaderModuleDescriptor* descriptor,
+                           ShaderModuleParseResult* parseResult)
+    : ShaderModuleBase(device, descriptor, parseResult) {}
 
 ShaderModule::~ShaderModule() = default;
 
@@ -118,7 +121,7 @@ MaybeError ShaderModule::Initialize(ShaderModuleParseResult* parseResult,
 namespace {
 
 ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(DeviceBase* device,
-                                                          const tint::Program* inputProgram,
+                                                          const ShaderModule* shaderModule,
                                                           const char* entryPointName,
                                                           SingleShaderStage stage,
                                                           const PipelineLayout* layout,
@@ -178,7 +181,8 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(DeviceBase* device,
     }
 
     MslCompilationRequest req = {};
-    req.inputProgram = inputProgram;
+    req.shaderModule = shaderModule;
+    req.inputProgram = UnsafeUnkeyedValue(shaderModule->GetTintProgram());
     req.bindingPoints = std::move(bindingPoints);
     req.externalTextureBindings = std::move(externalTextureBindings);
     req.vertexPullingTransformConfig = std::move(vertexPullingTransformConfig);
@@ -236,8 +240,8 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(DeviceBase* device,
             {
                 TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "RunTransforms");
                 DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
+                                RunTransforms(&transformManager, r.inputProgram.UnsafeGetValue(),
+                                              transformInputs, &transformOutputs, nullptr));
             }
 
             std::string remappedEntryPointName;
@@ -315,8 +319,8 @@ MaybeError ShaderModule::CreateFunction(const char* entryPointName,
     }
 
     CacheResult<MslCompilation> mslCompilation;
-    DAWN_TRY_ASSIGN(mslCompilation, TranslateToMSL(GetDevice(), GetTintProgram(), entryPointName,
-                                                   stage, layout, sampleMask, renderPipeline));
+    DAWN_TRY_ASSIGN(mslCompilation, TranslateToMSL(GetDevice(), this, entryPointName, stage, layout,
+                                                   sampleMask, renderPipeline));
     out->needsStorageBufferLength = mslCompilation->needsStorageBufferLength;
     out->workgroupAllocations = std::move(mslCompilation->workgroupAllocations);
 
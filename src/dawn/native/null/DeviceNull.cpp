@@ -157,7 +157,7 @@ ResultOrError<Ref<ShaderModuleBase>> Device::CreateShaderModuleImpl(
     const ShaderModuleDescriptor* descriptor,
     ShaderModuleParseResult* parseResult,
     OwnedCompilationMessages* compilationMessages) {
-    Ref<ShaderModule> module = AcquireRef(new ShaderModule(this, descriptor));
+    Ref<ShaderModule> module = AcquireRef(new ShaderModule(this, descriptor, parseResult));
     DAWN_TRY(module->Initialize(parseResult, compilationMessages));
     return module;
 }
@@ -58,7 +58,8 @@ tint::writer::glsl::Version::Standard ToTintGLStandard(opengl::OpenGLVersion::St
 using BindingMap = std::unordered_map<tint::sem::BindingPoint, tint::sem::BindingPoint>;
 
 #define GLSL_COMPILATION_REQUEST_MEMBERS(X)                                              \
-    X(const tint::Program*, inputProgram)                                                \
+    X(const ShaderModuleBase*, shaderModule)                                             \
+    X(CacheKey::UnsafeUnkeyedValue<const tint::Program*>, inputProgram)                  \
     X(std::string, entryPointName)                                                       \
     X(tint::transform::MultiplanarExternalTexture::BindingsMap, externalTextureBindings) \
     X(BindingMap, glBindings)                                                            \
@@ -160,13 +161,15 @@ ResultOrError<Ref<ShaderModule>> ShaderModule::Create(
     const ShaderModuleDescriptor* descriptor,
     ShaderModuleParseResult* parseResult,
     OwnedCompilationMessages* compilationMessages) {
-    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor));
+    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor, parseResult));
     DAWN_TRY(module->Initialize(parseResult, compilationMessages));
     return module;
 }
 
-ShaderModule::ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor)
-    : ShaderModuleBase(device, descriptor) {}
+ShaderModule::ShaderModule(Device* device,
+                           const ShaderModuleDescriptor* descriptor,
+                           ShaderModuleParseResult* parseResult)
+    : ShaderModuleBase(device, descriptor, parseResult) {}
 
 MaybeError ShaderModule::Initialize(ShaderModuleParseResult* parseResult,
                                     OwnedCompilationMessages* compilationMessages) {
@@ -211,7 +214,8 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
     }
 
     GLSLCompilationRequest req = {};
-    req.inputProgram = GetTintProgram();
+    req.shaderModule = this;
+    req.inputProgram = UnsafeUnkeyedValue(GetTintProgram());
     req.entryPointName = programmableStage.entryPoint;
     req.externalTextureBindings = BuildExternalTextureTransformBindings(layout);
     req.glBindings = std::move(glBindings);
@@ -233,8 +237,9 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
             }
 
             tint::Program program;
-            DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram,
-                                                   transformInputs, nullptr, nullptr));
+            DAWN_TRY_ASSIGN(program,
+                            RunTransforms(&transformManager, r.inputProgram.UnsafeGetValue(),
+                                          transformInputs, nullptr, nullptr));
 
             tint::writer::glsl::Options tintOptions;
             tintOptions.version = tint::writer::glsl::Version(ToTintGLStandard(r.glVersionStandard),
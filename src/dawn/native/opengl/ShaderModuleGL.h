@@ -83,7 +83,9 @@ class ShaderModule final : public ShaderModuleBase {
                                         bool* needsPlaceholderSampler) const;
 
   private:
-    ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor);
+    ShaderModule(Device* device,
+                 const ShaderModuleDescriptor* descriptor,
+                 ShaderModuleParseResult* parseResult);
     ~ShaderModule() override = default;
     MaybeError Initialize(ShaderModuleParseResult* parseResult,
                           OwnedCompilationMessages* compilationMessages);
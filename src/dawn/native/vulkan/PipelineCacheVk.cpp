@@ -65,9 +65,9 @@ MaybeError PipelineCache::SerializeToBlobImpl(Blob* blob) {
         return {};
     }
     *blob = CreateBlob(bufferSize);
-    DAWN_TRY(CheckVkSuccess(
-        device->fn.GetPipelineCacheData(device->GetVkDevice(), mHandle, &bufferSize, blob->Data()),
-        "GetPipelineCacheData"));
+    DAWN_TRY(CheckVkSuccess(device->fn.GetPipelineCacheData(device->GetVkDevice(), mHandle,
+                                                            &bufferSize, blob->MutableData()),
+                            "GetPipelineCacheData"));
     return {};
 }
 
@@ -141,13 +141,15 @@ ResultOrError<Ref<ShaderModule>> ShaderModule::Create(
     const ShaderModuleDescriptor* descriptor,
     ShaderModuleParseResult* parseResult,
     OwnedCompilationMessages* compilationMessages) {
-    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor));
+    Ref<ShaderModule> module = AcquireRef(new ShaderModule(device, descriptor, parseResult));
     DAWN_TRY(module->Initialize(parseResult, compilationMessages));
     return module;
 }
 
-ShaderModule::ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor)
-    : ShaderModuleBase(device, descriptor),
+ShaderModule::ShaderModule(Device* device,
+                           const ShaderModuleDescriptor* descriptor,
+                           ShaderModuleParseResult* parseResult)
+    : ShaderModuleBase(device, descriptor, parseResult),
       mTransformedShaderModuleCache(
           std::make_unique<ConcurrentTransformedShaderModuleCache>(device)) {}
 
@@ -178,7 +180,8 @@ void ShaderModule::DestroyImpl() {
 ShaderModule::~ShaderModule() = default;
 
 #define SPIRV_COMPILATION_REQUEST_MEMBERS(X)                                    \
-    X(const tint::Program*, inputProgram)                                       \
+    X(const ShaderModuleBase*, shaderModule)                                    \
+    X(CacheKey::UnsafeUnkeyedValue<const tint::Program*>, inputProgram)         \
     X(tint::transform::BindingRemapper::BindingPoints, bindingPoints)           \
     X(tint::transform::MultiplanarExternalTexture::BindingsMap, newBindingsMap) \
     X(std::string_view, entryPointName)                                         \
@@ -249,7 +252,8 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 
 #if TINT_BUILD_SPV_WRITER
     SpirvCompilationRequest req = {};
-    req.inputProgram = GetTintProgram();
+    req.shaderModule = this;
+    req.inputProgram = UnsafeUnkeyedValue(GetTintProgram());
     req.bindingPoints = std::move(bindingPoints);
     req.newBindingsMap = std::move(newBindingsMap);
     req.entryPointName = entryPointName;
@@ -282,8 +286,9 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
             tint::Program program;
             {
                 TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram,
-                                                       transformInputs, nullptr, nullptr));
+                DAWN_TRY_ASSIGN(program,
+                                RunTransforms(&transformManager, r.inputProgram.UnsafeGetValue(),
+                                              transformInputs, nullptr, nullptr));
             }
             tint::writer::spirv::Options options;
             options.emit_vertex_point_size = true;
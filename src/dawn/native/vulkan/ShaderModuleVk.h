@@ -48,7 +48,9 @@ class ShaderModule final : public ShaderModuleBase {
                                                     const PipelineLayout* layout);
 
   private:
-    ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor);
+    ShaderModule(Device* device,
+                 const ShaderModuleDescriptor* descriptor,
+                 ShaderModuleParseResult* parseResult);
     ~ShaderModule() override;
     MaybeError Initialize(ShaderModuleParseResult* parseResult,
                           OwnedCompilationMessages* compilationMessages);
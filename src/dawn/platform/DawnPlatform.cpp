@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "dawn/common/Assert.h"
+#include "dawn/platform/FileCachingInterface.h"
 #include "dawn/platform/WorkerThread.h"
 
 namespace dawn::platform {
@@ -25,6 +26,11 @@ CachingInterface::CachingInterface() = default;
 
 CachingInterface::~CachingInterface() = default;
 
+std::unique_ptr<CachingInterface> CreateFileCachingInterface(const char* path,
+                                                             uint64_t maxSizeInBytes) {
+    return FileCachingInterface::Create(path, maxSizeInBytes);
+}
+
 Platform::Platform() = default;
 
 Platform::~Platform() = default;
@@ -58,7 +64,11 @@ dawn::platform::CachingInterface* Platform::GetCachingInterface() {
 }
 
 std::unique_ptr<dawn::platform::WorkerTaskPool> Platform::CreateWorkerTaskPool() {
-    return std::make_unique<AsyncWorkerThreadPool>();
+    return std::make_unique<AsyncWorkerThreadPool>(GetMaxWorkerThreadCount());
+}
+
+uint32_t Platform::GetMaxWorkerThreadCount() {
+    return 0;
 }
 
 }  // namespace dawn::platform
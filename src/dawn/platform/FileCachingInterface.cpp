@@ -0,0 +1,421 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/platform/FileCachingInterface.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(WINDOWS)
+#include <io.h>
+
+#include "dawn/common/windows_with_undefs.h"
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace dawn::platform {
+
+namespace {
+
+constexpr char kFileMagic[8] = {'D', 'A', 'W', 'N', 'P', 'A', 'C', 'K'};
+constexpr uint32_t kFileVersion = 1;
+constexpr uint32_t kRecordMagic = 0x44524543;  // "DREC"
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t padding;
+};
+
+// Each record is a RecordHeader immediately followed by the key and the value.
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t keySize;
+    uint64_t valueSize;
+    uint64_t checksum;
+};
+
+uint64_t RecordSize(uint64_t keySize, uint64_t valueSize) {
+    return sizeof(RecordHeader) + keySize + valueSize;
+}
+
+// 64-bit FNV-1a, which is enough to detect truncated or corrupted records.
+constexpr uint64_t kChecksumSeed = 14695981039346656037ull;
+
+uint64_t UpdateChecksum(uint64_t checksum, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        checksum ^= bytes[i];
+        checksum *= 1099511628211ull;
+    }
+    return checksum;
+}
+
+uint64_t ComputeChecksum(const void* key, size_t keySize, const void* value, size_t valueSize) {
+    return UpdateChecksum(UpdateChecksum(kChecksumSeed, key, keySize), value, valueSize);
+}
+
+bool Seek(FILE* file, uint64_t offset) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    return _fseeki64(file, static_cast<int64_t>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+bool GetFileSize(FILE* file, uint64_t* size) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    if (_fseeki64(file, 0, SEEK_END) != 0) {
+        return false;
+    }
+    int64_t position = _ftelli64(file);
+#else
+    if (fseeko(file, 0, SEEK_END) != 0) {
+        return false;
+    }
+    off_t position = ftello(file);
+#endif
+    if (position < 0) {
+        return false;
+    }
+    *size = static_cast<uint64_t>(position);
+    return true;
+}
+
+bool Read(FILE* file, void* data, size_t size) {
+    return fread(data, 1, size, file) == size;
+}
+
+bool Write(FILE* file, const void* data, size_t size) {
+    return fwrite(data, 1, size, file) == size;
+}
+
+// Flushes the buffered writes to |file| and waits for them to reach the disk.
+bool SyncFile(FILE* file) {
+    if (fflush(file) != 0) {
+        return false;
+    }
+#if DAWN_PLATFORM_IS(WINDOWS)
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+// Atomically replaces the file at |to| with the file at |from|. |from| must be synced to the disk
+// first, otherwise a crash right after the rename can leave |to| truncated.
+bool AtomicReplaceFile(const std::string& from, const std::string& to) {
+#if DAWN_PLATFORM_IS(WINDOWS)
+    return MoveFileExA(from.c_str(), to.c_str(),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+}  // anonymous namespace
+
+// static
+std::unique_ptr<FileCachingInterface> FileCachingInterface::Create(const std::string& path,
+                                                                   uint64_t maxSizeInBytes) {
+    std::unique_ptr<FileCachingInterface> cache(new FileCachingInterface(path, maxSizeInBytes));
+    if (!cache->Initialize()) {
+        return nullptr;
+    }
+    return cache;
+}
+
+FileCachingInterface::FileCachingInterface(std::string path, uint64_t maxSizeInBytes)
+    : mPath(std::move(path)), mMaxSize(std::max<uint64_t>(maxSizeInBytes, sizeof(FileHeader))) {}
+
+FileCachingInterface::~FileCachingInterface() {
+    if (mFile != nullptr) {
+        fclose(mFile);
+    }
+}
+
+size_t FileCachingInterface::LoadData(const void* key,
+                                      size_t keySize,
+                                      void* valueOut,
+                                      size_t valueSize) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mFile == nullptr) {
+        return 0;
+    }
+
+    auto it = mEntries.find(std::string(static_cast<const char*>(key), keySize));
+    if (it == mEntries.end()) {
+        return 0;
+    }
+    const Entry& entry = it->second;
+
+    // Only query for the existence of the key, or the value doesn't fit in |valueOut|.
+    if (valueOut == nullptr || valueSize < entry.valueSize) {
+        ASSERT(valueOut != nullptr || valueSize == 0);
+        return entry.valueSize;
+    }
+
+    if (!ReadValue(it->first, entry, valueOut)) {
+        RemoveEntry(it);
+        return 0;
+    }
+    mLRUList.splice(mLRUList.end(), mLRUList, entry.lruIterator);
+    return entry.valueSize;
+}
+
+void FileCachingInterface::StoreData(const void* key,
+                                     size_t keySize,
+                                     const void* value,
+                                     size_t valueSize) {
+    ASSERT(keySize > 0 && valueSize > 0);
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mFile == nullptr) {
+        return;
+    }
+
+    const uint64_t recordSize = RecordSize(keySize, valueSize);
+    const uint64_t maxLiveSize = mMaxSize - sizeof(FileHeader);
+    if (keySize > UINT32_MAX || recordSize > maxLiveSize) {
+        return;
+    }
+
+    std::string keyString(static_cast<const char*>(key), keySize);
+    auto it = mEntries.find(keyString);
+    if (it != mEntries.end()) {
+        RemoveEntry(it);
+    }
+
+    // Make room for the record by evicting entries and compacting the file. Evict down to half of
+    // the cap so that compaction, which rewrites all the live entries, doesn't happen on every
+    // store once the cache is full.
+    if (mFileSize + recordSize > mMaxSize) {
+        EvictUntilLiveSizeIsAtMost(std::min(maxLiveSize - recordSize, maxLiveSize / 2));
+        Compact();
+        if (mFile == nullptr) {
+            return;
+        }
+    }
+
+    RecordHeader header;
+    header.magic = kRecordMagic;
+    header.keySize = static_cast<uint32_t>(keySize);
+    header.valueSize = valueSize;
+    header.checksum = ComputeChecksum(key, keySize, value, valueSize);
+
+    if (!Seek(mFile, mFileSize) || !Write(mFile, &header, sizeof(header)) ||
+        !Write(mFile, key, keySize) || !Write(mFile, value, valueSize) || fflush(mFile) != 0) {
+        // The tail of the file may now contain a partial record. Rewrite the file so that it only
+        // contains valid records.
+        Compact();
+        return;
+    }
+
+    Entry entry;
+    entry.offset = mFileSize;
+    entry.valueSize = valueSize;
+    entry.checksum = header.checksum;
+    AddEntry(std::move(keyString), entry);
+    mFileSize += recordSize;
+}
+
+uint64_t FileCachingInterface::GetFileSizeForTesting() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mFileSize;
+}
+
+size_t FileCachingInterface::GetEntryCountForTesting() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+bool FileCachingInterface::Initialize() {
+    mFile = fopen(mPath.c_str(), "r+b");
+    if (mFile == nullptr) {
+        return CreateEmptyFile();
+    }
+
+    // Discard files written by other versions of this implementation.
+    FileHeader header;
+    if (!Read(mFile, &header, sizeof(header)) ||
+        memcmp(header.magic, kFileMagic, sizeof(kFileMagic)) != 0 ||
+        header.version != kFileVersion) {
+        fclose(mFile);
+        mFile = nullptr;
+        return CreateEmptyFile();
+    }
+
+    bool isIntact = ReadAllRecords();
+    EvictUntilLiveSizeIsAtMost(mMaxSize - sizeof(FileHeader));
+    if (!isIntact || mFileSize > mMaxSize) {
+        Compact();
+    }
+    return mFile != nullptr;
+}
+
+bool FileCachingInterface::CreateEmptyFile() {
+    ASSERT(mFile == nullptr);
+    ASSERT(mEntries.empty());
+
+    mFile = fopen(mPath.c_str(), "w+b");
+    if (mFile == nullptr) {
+        return false;
+    }
+
+    FileHeader header;
+    memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+    header.version = kFileVersion;
+    header.padding = 0;
+    if (!Write(mFile, &header, sizeof(header)) || fflush(mFile) != 0) {
+        fclose(mFile);
+        mFile = nullptr;
+        return false;
+    }
+    mFileSize = sizeof(header);
+    return true;
+}
+
+bool FileCachingInterface::ReadAllRecords() {
+    uint64_t fileSize;
+    if (!GetFileSize(mFile, &fileSize)) {
+        return false;
+    }
+
+    mFileSize = sizeof(FileHeader);
+    if (!Seek(mFile, mFileSize)) {
+        return false;
+    }
+
+    std::string key;
+    std::vector<uint8_t> value;
+    while (mFileSize < fileSize) {
+        uint64_t remainingSize = fileSize - mFileSize;
+
+        RecordHeader header;
+        if (remainingSize < sizeof(header) || !Read(mFile, &header, sizeof(header))) {
+            return false;
+        }
+        remainingSize -= sizeof(header);
+        if (header.magic != kRecordMagic || header.keySize == 0 || header.valueSize == 0 ||
+            header.valueSize > remainingSize || header.keySize > remainingSize - header.valueSize) {
+            return false;
+        }
+
+        key.resize(header.keySize);
+        value.resize(header.valueSize);
+        if (!Read(mFile, key.data(), key.size()) || !Read(mFile, value.data(), value.size()) ||
+            ComputeChecksum(key.data(), key.size(), value.data(), value.size()) !=
+                header.checksum) {
+            return false;
+        }
+
+        // Records appended later override the previous records for the same key.
+        Entry entry;
+        entry.offset = mFileSize;
+        entry.valueSize = header.valueSize;
+        entry.checksum = header.checksum;
+        AddEntry(key, entry);
+        mFileSize += RecordSize(header.keySize, header.valueSize);
+    }
+    return true;
+}
+
+bool FileCachingInterface::ReadValue(const std::string& key, const Entry& entry, void* valueOut) {
+    if (!Seek(mFile, entry.offset + sizeof(RecordHeader) + key.size()) ||
+        !Read(mFile, valueOut, entry.valueSize)) {
+        return false;
+    }
+    return ComputeChecksum(key.data(), key.size(), valueOut, entry.valueSize) == entry.checksum;
+}
+
+void FileCachingInterface::AddEntry(std::string key, const Entry& entry) {
+    auto existing = mEntries.find(key);
+    if (existing != mEntries.end()) {
+        RemoveEntry(existing);
+    }
+
+    auto [it, inserted] = mEntries.emplace(std::move(key), entry);
+    ASSERT(inserted);
+    it->second.lruIterator = mLRUList.insert(mLRUList.end(), &it->first);
+    mLiveSize += RecordSize(it->first.size(), entry.valueSize);
+}
+
+void FileCachingInterface::RemoveEntry(EntryMap::iterator it) {
+    mLiveSize -= RecordSize(it->first.size(), it->second.valueSize);
+    mLRUList.erase(it->second.lruIterator);
+    mEntries.erase(it);
+}
+
+void FileCachingInterface::EvictUntilLiveSizeIsAtMost(uint64_t size) {
+    while (mLiveSize > size) {
+        ASSERT(!mLRUList.empty());
+        RemoveEntry(mEntries.find(*mLRUList.front()));
+    }
+}
+
+void FileCachingInterface::Compact() {
+    const std::string tempPath = mPath + ".tmp";
+    FILE* newFile = fopen(tempPath.c_str(), "wb");
+
+    bool success = newFile != nullptr;
+    if (success) {
+        FileHeader header;
+        memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+        header.version = kFileVersion;
+        header.padding = 0;
+        success = Write(newFile, &header, sizeof(header));
+    }
+
+    // Copy the records verbatim. They are validated again with their checksum when loaded.
+    uint64_t newFileSize = sizeof(FileHeader);
+    std::vector<uint8_t> record;
+    for (auto lruIt = mLRUList.begin(); success && lruIt != mLRUList.end(); ++lruIt) {
+        Entry& entry = mEntries.find(**lruIt)->second;
+        record.resize(RecordSize((*lruIt)->size(), entry.valueSize));
+        success = Seek(mFile, entry.offset) && Read(mFile, record.data(), record.size()) &&
+                  Write(newFile, record.data(), record.size());
+        entry.offset = newFileSize;
+        newFileSize += record.size();
+    }
+
+    if (newFile != nullptr) {
+        success = success && SyncFile(newFile);
+        success = (fclose(newFile) == 0) && success;
+    }
+    fclose(mFile);
+    mFile = nullptr;
+
+    if (success && AtomicReplaceFile(tempPath, mPath)) {
+        mFile = fopen(mPath.c_str(), "r+b");
+        if (mFile != nullptr) {
+            mFileSize = newFileSize;
+            return;
+        }
+    }
+
+    // Start over from an empty file if the live entries couldn't be preserved.
+    std::remove(tempPath.c_str());
+    mEntries.clear();
+    mLRUList.clear();
+    mLiveSize = 0;
+    CreateEmptyFile();
+}
+
+}  // namespace dawn::platform
@@ -0,0 +1,97 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_PLATFORM_FILECACHINGINTERFACE_H_
+#define SRC_DAWN_PLATFORM_FILECACHINGINTERFACE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "dawn/common/NonCopyable.h"
+#include "dawn/platform/DawnPlatform.h"
+
+namespace dawn::platform {
+
+// A CachingInterface that persists entries in a single append-only pack file. Each record is
+// stored with a checksum of its key and value so that truncated or corrupted records are detected
+// and dropped, both when the pack file is opened and when an entry is loaded.
+//
+// The total size of the pack file is capped: when appending a record would exceed the cap, the
+// least recently used entries are evicted and the live entries are rewritten to a temporary file
+// that atomically replaces the pack file. The file must not be shared by multiple processes at the
+// same time.
+class DAWN_PLATFORM_EXPORT FileCachingInterface : public CachingInterface, public NonCopyable {
+  public:
+    // Returns nullptr if the pack file at |path| cannot be opened or created.
+    static std::unique_ptr<FileCachingInterface> Create(const std::string& path,
+                                                        uint64_t maxSizeInBytes);
+    ~FileCachingInterface() override;
+
+    size_t LoadData(const void* key, size_t keySize, void* valueOut, size_t valueSize) override;
+    void StoreData(const void* key, size_t keySize, const void* value, size_t valueSize) override;
+
+    // Size of the pack file, including the space used by records that were evicted or
+    // overwritten and haven't been compacted away yet.
+    uint64_t GetFileSizeForTesting();
+    size_t GetEntryCountForTesting();
+
+  private:
+    struct Entry {
+        // Offset of the record header in the pack file.
+        uint64_t offset;
+        uint64_t valueSize;
+        uint64_t checksum;
+        std::list<const std::string*>::iterator lruIterator;
+    };
+    using EntryMap = std::unordered_map<std::string, Entry>;
+
+    FileCachingInterface(std::string path, uint64_t maxSizeInBytes);
+
+    bool Initialize();
+    bool CreateEmptyFile();
+    // Reads all the valid records of the pack file into mEntries. Returns false if a corrupted or
+    // truncated record was found, in which case the records after it are ignored.
+    bool ReadAllRecords();
+    bool ReadValue(const std::string& key, const Entry& entry, void* valueOut);
+    void AddEntry(std::string key, const Entry& entry);
+    void RemoveEntry(EntryMap::iterator it);
+    void EvictUntilLiveSizeIsAtMost(uint64_t size);
+    // Rewrites the live entries, least recently used first, to a new pack file that replaces the
+    // current one. On failure the cache is left empty.
+    void Compact();
+
+    const std::string mPath;
+    const uint64_t mMaxSize;
+
+    // mMutex protects everything below, since the CachingInterface may be shared by several
+    // instances and devices.
+    std::mutex mMutex;
+    FILE* mFile = nullptr;
+    uint64_t mFileSize = 0;
+    // Size of the records of the entries in mEntries, which is what the file shrinks to when
+    // compacted.
+    uint64_t mLiveSize = 0;
+    EntryMap mEntries;
+    // Keys of mEntries, from least to most recently used.
+    std::list<const std::string*> mLRUList;
+};
+
+}  // namespace dawn::platform
+
+#endif  // SRC_DAWN_PLATFORM_FILECACHINGINTERFACE_H_
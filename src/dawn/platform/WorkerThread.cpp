@@ -14,77 +14,126 @@
 
 #include "dawn/platform/WorkerThread.h"
 
-#include <condition_variable>
-#include <functional>
-#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <utility>
 
 #include "dawn/common/Assert.h"
 
-namespace {
+namespace dawn::platform {
 
-class AsyncWaitableEventImpl {
+class AsyncWorkerThreadPool::Task : public RefCounted {
   public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
-
-    void Wait() {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return mIsComplete; });
-    }
+    Task(PostWorkerTaskCallback callback, void* userdata)
+        : mCallback(callback), mUserdata(userdata) {}
 
-    bool IsComplete() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mIsComplete;
-    }
+    void Run() { mCallback(mUserdata); }
 
-    void MarkAsComplete() {
-        {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mIsComplete = true;
-        }
-        mCondition.notify_all();
-    }
+    bool IsComplete() const { return mIsComplete.load(std::memory_order_acquire); }
+    void MarkAsComplete() { mIsComplete.store(true, std::memory_order_release); }
 
   private:
-    std::mutex mMutex;
-    std::condition_variable mCondition;
-    bool mIsComplete;
+    PostWorkerTaskCallback mCallback;
+    void* mUserdata;
+    std::atomic<bool> mIsComplete{false};
 };
 
-class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
+class AsyncWorkerThreadPool::Event final : public dawn::platform::WaitableEvent {
   public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
-
-    void Wait() override { mWaitableEventImpl->Wait(); }
+    Event(AsyncWorkerThreadPool* pool, Ref<Task> task) : mPool(pool), mTask(std::move(task)) {}
 
-    bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
-
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
+    void Wait() override {
+        // Check the completion without touching the pool first: all the tasks are complete once
+        // the pool is destroyed, so this also makes it valid to call Wait() after that point.
+        if (mTask->IsComplete()) {
+            return;
+        }
+        mPool->WaitForTask(mTask.Get());
     }
 
+    bool IsComplete() override { return mTask->IsComplete(); }
+
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    AsyncWorkerThreadPool* mPool;
+    Ref<Task> mTask;
 };
 
-}  // anonymous namespace
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t maxThreadCount)
+    : mMaxThreadCount(maxThreadCount != 0
+                          ? maxThreadCount
+                          : std::max(1u, std::thread::hardware_concurrency())) {}
 
-namespace dawn::platform {
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsShuttingDown = true;
+    }
+    mTaskAvailableCondition.notify_all();
+
+    for (std::thread& thread : mThreads) {
+        thread.join();
+    }
+    ASSERT(mPendingTasks.empty());
+}
 
 std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
-
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()]() {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+    Ref<Task> task = AcquireRef(new Task(callback, userdata));
+    std::unique_ptr<Event> waitableEvent = std::make_unique<Event>(this, task);
 
-    std::thread thread(doTask);
-    thread.detach();
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ASSERT(!mIsShuttingDown);
+        mPendingTasks.push_back(std::move(task));
+
+        // Only grow the pool when there are more pending tasks than idle workers, so that devices
+        // that never post tasks, or only post a few, don't pay for a full set of threads. A worker
+        // that was notified but hasn't woken up yet still counts as idle, so checking for an idle
+        // worker instead would hand a whole burst of tasks to that one worker.
+        if (mPendingTasks.size() > mIdleThreadCount && mThreads.size() < mMaxThreadCount) {
+            mThreads.emplace_back(&AsyncWorkerThreadPool::ThreadLoop, this);
+        }
+    }
+    mTaskAvailableCondition.notify_one();
 
     return waitableEvent;
 }
 
+void AsyncWorkerThreadPool::ThreadLoop() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mIdleThreadCount++;
+        mTaskAvailableCondition.wait(lock,
+                                     [this] { return mIsShuttingDown || !mPendingTasks.empty(); });
+        mIdleThreadCount--;
+
+        // Drain the remaining tasks before exiting so that no WaitableEvent is left pending.
+        if (mPendingTasks.empty()) {
+            ASSERT(mIsShuttingDown);
+            return;
+        }
+
+        Ref<Task> task = std::move(mPendingTasks.front());
+        mPendingTasks.pop_front();
+
+        lock.unlock();
+        task->Run();
+        lock.lock();
+
+        // Completion is published under mMutex so that WaitForTask cannot miss the notification.
+        task->MarkAsComplete();
+        if (mWaiterCount > 0) {
+            mTaskCompletedCondition.notify_all();
+        }
+    }
+}
+
+void AsyncWorkerThreadPool::WaitForTask(Task* task) {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mWaiterCount++;
+    mTaskCompletedCondition.wait(lock, [task] { return task->IsComplete(); });
+    mWaiterCount--;
+}
+
 }  // namespace dawn::platform
@@ -15,18 +15,54 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/RefCounted.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::platform {
 
+// A WorkerTaskPool backed by a bounded set of long-lived worker threads. Threads are spawned
+// lazily when a task is posted and there are more pending tasks than idle workers, up to the
+// maximum thread count, and are joined when the pool is destroyed. Tasks still queued at
+// destruction are run before the workers exit so that every returned WaitableEvent eventually
+// completes.
 class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
   public:
+    // A |maxThreadCount| of 0 uses the hardware concurrency of the system.
+    explicit AsyncWorkerThreadPool(uint32_t maxThreadCount = 0);
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+
+  private:
+    class Task;
+    class Event;
+
+    void ThreadLoop();
+    void WaitForTask(Task* task);
+
+    const uint32_t mMaxThreadCount;
+
+    // mMutex protects everything below. A single mutex and pair of condition variables are
+    // shared by all the tasks so that posting a task only costs one allocation.
+    std::mutex mMutex;
+    std::condition_variable mTaskAvailableCondition;
+    std::condition_variable mTaskCompletedCondition;
+    std::deque<Ref<Task>> mPendingTasks;
+    std::vector<std::thread> mThreads;
+    uint32_t mIdleThreadCount = 0;
+    uint32_t mWaiterCount = 0;
+    bool mIsShuttingDown = false;
 };
 
 }  // namespace dawn::platform
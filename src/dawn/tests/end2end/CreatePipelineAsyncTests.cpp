@@ -572,6 +572,46 @@ TEST_P(CreatePipelineAsyncTest, CreateSameComputePipelineTwiceAtSameTime) {
     }
 }
 
+// Verify creating a compute pipeline synchronously while the creation of a compute pipeline with
+// the same descriptor with CreateComputePipelineAsync() is still pending works correctly, and that
+// both calls return the same pipeline object.
+TEST_P(CreatePipelineAsyncTest, CreateSameComputePipelineSyncWhileAsyncIsPending) {
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = utils::CreateShaderModule(device, R"(
+        struct SSBO {
+            value : u32
+        }
+        @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+        @compute @workgroup_size(1) fn main() {
+            ssbo.value = 1u;
+        })");
+    csDesc.compute.entryPoint = "main";
+
+    device.CreateComputePipelineAsync(
+        &csDesc,
+        [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline returnPipeline,
+           const char* message, void* userdata) {
+            EXPECT_EQ(WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success, status);
+
+            CreatePipelineAsyncTask* task = static_cast<CreatePipelineAsyncTask*>(userdata);
+            task->computePipeline = wgpu::ComputePipeline::Acquire(returnPipeline);
+            task->isCompleted = true;
+            task->message = message;
+        },
+        &task);
+
+    // The synchronous creation may steal the compilation of the pending asynchronous one.
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&csDesc);
+    ASSERT_NE(nullptr, pipeline.Get());
+
+    ValidateCreateComputePipelineAsync();
+
+    if (!UsesWire()) {
+        EXPECT_EQ(pipeline.Get(), task.computePipeline.Get());
+    }
+}
+
 // Verify the basic use of CreateRenderPipelineAsync() works on all backends.
 TEST_P(CreatePipelineAsyncTest, CreateSameRenderPipelineTwiceAtSameTime) {
     constexpr wgpu::TextureFormat kRenderAttachmentFormat = wgpu::TextureFormat::RGBA8Unorm;
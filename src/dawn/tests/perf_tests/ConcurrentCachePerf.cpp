@@ -0,0 +1,168 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/common/ConcurrentCache.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace {
+
+constexpr unsigned int kOperationsPerThread = 10000;
+constexpr size_t kObjectCount = 1024;
+
+class CachedObject {
+  public:
+    explicit CachedObject(size_t value) : mValue(value) {}
+
+    struct EqualityFunc {
+        bool operator()(const CachedObject* a, const CachedObject* b) const {
+            return a->mValue == b->mValue;
+        }
+    };
+
+    struct HashFunc {
+        size_t operator()(const CachedObject* obj) const { return obj->mValue * 0x9E3779B1u; }
+    };
+
+  private:
+    size_t mValue;
+};
+
+struct ConcurrentCacheParams : AdapterTestParam {
+    ConcurrentCacheParams(const AdapterTestParam& param, unsigned int threadCountIn)
+        : AdapterTestParam(param), threadCount(threadCountIn) {}
+    unsigned int threadCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ConcurrentCacheParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_threads_" << param.threadCount;
+    return ostream;
+}
+
+}  // anonymous namespace
+
+// Test the contention on ConcurrentCache when several threads look up, insert and erase objects at
+// the same time, mimicking the pattern of device object deduplication during concurrent pipeline
+// creation: most operations are lookups of objects that are already cached.
+// The worker threads are created once in SetUp() and released at the start of each step, so that
+// the time of a step is the time of the cache operations and not the time to create threads.
+class ConcurrentCachePerf : public DawnPerfTestWithParams<ConcurrentCacheParams> {
+  public:
+    ConcurrentCachePerf()
+        : DawnPerfTestWithParams(GetParam().threadCount * kOperationsPerThread, 1) {}
+    ~ConcurrentCachePerf() override = default;
+
+    void SetUp() override {
+        DawnPerfTestWithParams<ConcurrentCacheParams>::SetUp();
+
+        for (size_t i = 0; i < kObjectCount; ++i) {
+            mObjects.emplace_back(i);
+        }
+        for (size_t i = 0; i < kObjectCount; i += 2) {
+            mCache.Insert(&mObjects[i]);
+        }
+
+        for (unsigned int t = 0; t < GetParam().threadCount; ++t) {
+            mThreads.emplace_back([this, t] { WorkerLoop(t); });
+        }
+    }
+
+    void TearDown() override {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+        mCondition.notify_all();
+        for (std::thread& thread : mThreads) {
+            thread.join();
+        }
+        mThreads.clear();
+
+        DawnPerfTestWithParams<ConcurrentCacheParams>::TearDown();
+    }
+
+  private:
+    void Step() override;
+
+    // Waits for each step to start, and then runs the cache operations of thread |threadIndex|.
+    void WorkerLoop(unsigned int threadIndex);
+    void DoCacheOperations(unsigned int threadIndex);
+
+    std::vector<CachedObject> mObjects;
+    ConcurrentCache<CachedObject> mCache;
+
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    // Incremented by Step() to release the worker threads.
+    uint64_t mStep = 0;
+    // The number of worker threads that have not finished the current step.
+    unsigned int mPendingThreads = 0;
+    bool mStopping = false;
+};
+
+void ConcurrentCachePerf::Step() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mPendingThreads = GetParam().threadCount;
+    mStep++;
+    mCondition.notify_all();
+    mCondition.wait(lock, [this] { return mPendingThreads == 0; });
+}
+
+void ConcurrentCachePerf::WorkerLoop(unsigned int threadIndex) {
+    uint64_t lastStep = 0;
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mCondition.wait(lock, [&] { return mStopping || mStep != lastStep; });
+        if (mStopping) {
+            return;
+        }
+        lastStep = mStep;
+
+        lock.unlock();
+        DoCacheOperations(threadIndex);
+        lock.lock();
+
+        if (--mPendingThreads == 0) {
+            mCondition.notify_all();
+        }
+    }
+}
+
+void ConcurrentCachePerf::DoCacheOperations(unsigned int threadIndex) {
+    size_t index = threadIndex * 7919;
+    for (unsigned int i = 0; i < kOperationsPerThread; ++i) {
+        index = (index + 31) % kObjectCount;
+        CachedObject* object = &mObjects[index];
+        // One in eight operations modifies the cache, and always restores its state.
+        if (i % 8 == 0) {
+            if (mCache.Insert(object).second) {
+                mCache.Erase(object);
+            }
+        } else {
+            mCache.Find(object);
+        }
+    }
+}
+
+TEST_P(ConcurrentCachePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ConcurrentCachePerf, {NullBackend()}, {1u, 2u, 4u, 8u});
@@ -0,0 +1,96 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr unsigned int kNumPipelinesPerStep = 64;
+
+}  // anonymous namespace
+
+// Test the throughput of bursts of CreateComputePipelineAsync calls, as is typical when an
+// application creates all of its pipelines at startup. Every pipeline uses a different value for
+// an overridable constant so that none of them are deduplicated by the device's pipeline cache and
+// each of them posts a task to the worker task pool.
+class CreatePipelineAsyncPerf : public DawnPerfTest {
+  public:
+    CreatePipelineAsyncPerf() : DawnPerfTest(kNumPipelinesPerStep, 1) {}
+    ~CreatePipelineAsyncPerf() override = default;
+
+    void SetUp() override {
+        DawnPerfTest::SetUp();
+
+        mShaderModule = utils::CreateShaderModule(device, R"(
+            override kValue : u32;
+
+            @group(0) @binding(0) var<storage, read_write> ssbo : array<u32>;
+
+            @compute @workgroup_size(64) fn main(@builtin(global_invocation_id) id : vec3<u32>) {
+                ssbo[id.x] = ssbo[id.x] * kValue + id.x;
+            })");
+    }
+
+  private:
+    void Step() override;
+
+    wgpu::ShaderModule mShaderModule;
+    uint32_t mNextConstantValue = 0;
+    unsigned int mPendingPipelineCount = 0;
+};
+
+void CreatePipelineAsyncPerf::Step() {
+    mPendingPipelineCount = kNumPipelinesPerStep;
+
+    for (unsigned int i = 0; i < kNumPipelinesPerStep; ++i) {
+        wgpu::ConstantEntry constant = {nullptr, "kValue",
+                                        static_cast<double>(mNextConstantValue++)};
+
+        wgpu::ComputePipelineDescriptor csDesc;
+        csDesc.compute.module = mShaderModule;
+        csDesc.compute.entryPoint = "main";
+        csDesc.compute.constants = &constant;
+        csDesc.compute.constantCount = 1;
+
+        device.CreateComputePipelineAsync(
+            &csDesc,
+            [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline returnPipeline,
+               const char* message, void* userdata) {
+                EXPECT_EQ(WGPUCreatePipelineAsyncStatus::WGPUCreatePipelineAsyncStatus_Success,
+                          status);
+                wgpu::ComputePipeline::Acquire(returnPipeline);
+
+                unsigned int* pendingPipelineCount = static_cast<unsigned int*>(userdata);
+                --(*pendingPipelineCount);
+            },
+            &mPendingPipelineCount);
+    }
+
+    while (mPendingPipelineCount != 0) {
+        WaitABit();
+    }
+}
+
+TEST_P(CreatePipelineAsyncPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST(CreatePipelineAsyncPerf,
+                      D3D12Backend(),
+                      MetalBackend(),
+                      NullBackend(),
+                      OpenGLBackend(),
+                      VulkanBackend());
@@ -120,9 +120,12 @@ class DawnPerfTestWithParams : public DawnTestWithParams<Params>, public DawnPer
     void SetUp() override {
         DawnTestWithParams<Params>::SetUp();
 
+        // Software adapters aren't representative of GPU performance. The null backend is still
+        // allowed so that tests can measure the CPU overhead of Dawn itself.
         wgpu::AdapterProperties properties;
         this->GetAdapter().GetProperties(&properties);
-        DAWN_TEST_UNSUPPORTED_IF(properties.adapterType == wgpu::AdapterType::CPU);
+        DAWN_TEST_UNSUPPORTED_IF(properties.adapterType == wgpu::AdapterType::CPU &&
+                                 !this->IsNull());
     }
     ~DawnPerfTestWithParams() override = default;
 };
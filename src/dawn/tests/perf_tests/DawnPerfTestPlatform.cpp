@@ -15,6 +15,8 @@
 #include "dawn/tests/perf_tests/DawnPerfTestPlatform.h"
 
 #include <algorithm>
+#include <cstring>
+#include <string>
 #include <utility>
 
 #include "dawn/common/Assert.h"
@@ -41,10 +43,37 @@ static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::Validation) =
 static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::Recording) == 2);
 static_assert(static_cast<uint32_t>(dawn::platform::TraceCategory::GPUWork) == 3);
 
+class InMemoryCachingInterface : public dawn::platform::CachingInterface {
+  public:
+    size_t LoadData(const void* key, size_t keySize, void* value, size_t valueSize) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mEntries.find(std::string(static_cast<const char*>(key), keySize));
+        if (it == mEntries.end()) {
+            return 0;
+        }
+        if (value != nullptr && valueSize >= it->second.size()) {
+            memcpy(value, it->second.data(), it->second.size());
+        }
+        return it->second.size();
+    }
+
+    void StoreData(const void* key, size_t keySize, const void* value, size_t valueSize) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries[std::string(static_cast<const char*>(key), keySize)] =
+            std::string(static_cast<const char*>(value), valueSize);
+    }
+
+  private:
+    std::mutex mMutex;
+    std::unordered_map<std::string, std::string> mEntries;
+};
+
 }  // anonymous namespace
 
 DawnPerfTestPlatform::DawnPerfTestPlatform()
-    : dawn::platform::Platform(), mTimer(utils::CreateTimer()) {}
+    : dawn::platform::Platform(),
+      mTimer(utils::CreateTimer()),
+      mCachingInterface(std::make_unique<InMemoryCachingInterface>()) {}
 
 DawnPerfTestPlatform::~DawnPerfTestPlatform() = default;
 
@@ -117,6 +146,10 @@ uint64_t DawnPerfTestPlatform::AddTraceEvent(char phase,
     return static_cast<uint64_t>(hash);
 }
 
+dawn::platform::CachingInterface* DawnPerfTestPlatform::GetCachingInterface() {
+    return mCachingInterface.get();
+}
+
 void DawnPerfTestPlatform::EnableTraceEventRecording(bool enable) {
     mRecordTraceEvents = enable;
 }
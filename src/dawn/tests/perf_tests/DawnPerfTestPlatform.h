@@ -79,6 +79,8 @@ class DawnPerfTestPlatform : public dawn::platform::Platform {
                            const uint64_t* argValues,
                            unsigned char flags) override;
 
+    dawn::platform::CachingInterface* GetCachingInterface() override;
+
     bool mRecordTraceEvents = false;
     std::unique_ptr<utils::Timer> mTimer;
 
@@ -89,6 +91,9 @@ class DawnPerfTestPlatform : public dawn::platform::Platform {
     std::unordered_map<std::thread::id, std::unique_ptr<std::vector<TraceEvent>>>
         mTraceEventBuffers;
     std::mutex mTraceEventBufferMapMutex;
+
+    // In-memory cache used by the devices that enable the "enable_blob_cache" toggle.
+    std::unique_ptr<dawn::platform::CachingInterface> mCachingInterface;
 };
 
 #endif  // SRC_DAWN_TESTS_PERF_TESTS_DAWNPERFTESTPLATFORM_H_
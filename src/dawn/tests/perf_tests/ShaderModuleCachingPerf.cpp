@@ -0,0 +1,144 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr unsigned int kNumPipelinesPerStep = 16;
+
+constexpr char kShader[] = R"(
+    struct Particle {
+        pos : vec2<f32>,
+        vel : vec2<f32>,
+    }
+    struct SimParams {
+        deltaT : f32,
+        rule1Distance : f32,
+        rule2Distance : f32,
+        rule3Distance : f32,
+        rule1Scale : f32,
+        rule2Scale : f32,
+        rule3Scale : f32,
+        particleCount : u32,
+    }
+    struct Particles {
+        particles : array<Particle>,
+    }
+    @binding(0) @group(0) var<uniform> params : SimParams;
+    @binding(1) @group(0) var<storage, read> particlesA : Particles;
+    @binding(2) @group(0) var<storage, read_write> particlesB : Particles;
+
+    @compute @workgroup_size(64)
+    fn main(@builtin(global_invocation_id) GlobalInvocationID : vec3<u32>) {
+        var index : u32 = GlobalInvocationID.x;
+        if (index >= params.particleCount) {
+            return;
+        }
+        var vPos : vec2<f32> = particlesA.particles[index].pos;
+        var vVel : vec2<f32> = particlesA.particles[index].vel;
+        var cMass : vec2<f32> = vec2<f32>(0.0, 0.0);
+        var cVel : vec2<f32> = vec2<f32>(0.0, 0.0);
+        var colVel : vec2<f32> = vec2<f32>(0.0, 0.0);
+        var cMassCount : u32 = 0u;
+        var cVelCount : u32 = 0u;
+
+        for (var i : u32 = 0u; i < params.particleCount; i = i + 1u) {
+            if (i == index) {
+                continue;
+            }
+            let pos = particlesA.particles[i].pos;
+            let vel = particlesA.particles[i].vel;
+            if (distance(pos, vPos) < params.rule1Distance) {
+                cMass = cMass + pos;
+                cMassCount = cMassCount + 1u;
+            }
+            if (distance(pos, vPos) < params.rule2Distance) {
+                colVel = colVel - (pos - vPos);
+            }
+            if (distance(pos, vPos) < params.rule3Distance) {
+                cVel = cVel + vel;
+                cVelCount = cVelCount + 1u;
+            }
+        }
+
+        if (cMassCount > 0u) {
+            cMass = (cMass / vec2<f32>(f32(cMassCount), f32(cMassCount))) - vPos;
+        }
+        if (cVelCount > 0u) {
+            cVel = cVel / vec2<f32>(f32(cVelCount), f32(cVelCount));
+        }
+
+        vVel = vVel + (cMass * params.rule1Scale) + (colVel * params.rule2Scale) +
+            (cVel * params.rule3Scale);
+        vVel = normalize(vVel) * clamp(length(vVel), 0.0, 0.1);
+        vPos = vPos + (vVel * params.deltaT);
+
+        if (vPos.x < -1.0) {
+            vPos.x = 1.0;
+        }
+        if (vPos.x > 1.0) {
+            vPos.x = -1.0;
+        }
+        if (vPos.y < -1.0) {
+            vPos.y = 1.0;
+        }
+        if (vPos.y > 1.0) {
+            vPos.y = -1.0;
+        }
+
+        particlesB.particles[index].pos = vPos;
+        particlesB.particles[index].vel = vVel;
+    })";
+
+}  // anonymous namespace
+
+// Test the cost of creating the same compute pipeline from a new shader module again and again,
+// as is typical when an application is restarted. The shader module and pipeline are released at
+// each iteration so that they are not deduplicated by the device's object caches. When the
+// "enable_blob_cache" toggle is set, the backend compilation of the shader is served from the
+// blob cache after the first iteration.
+class ShaderModuleCachingPerf : public DawnPerfTest {
+  public:
+    ShaderModuleCachingPerf() : DawnPerfTest(kNumPipelinesPerStep, 1) {}
+    ~ShaderModuleCachingPerf() override = default;
+
+  private:
+    void Step() override;
+};
+
+void ShaderModuleCachingPerf::Step() {
+    for (unsigned int i = 0; i < kNumPipelinesPerStep; ++i) {
+        wgpu::ComputePipelineDescriptor csDesc;
+        csDesc.compute.module = utils::CreateShaderModule(device, kShader);
+        csDesc.compute.entryPoint = "main";
+        wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&csDesc);
+    }
+}
+
+TEST_P(ShaderModuleCachingPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST(ShaderModuleCachingPerf,
+                      D3D12Backend(),
+                      D3D12Backend({"enable_blob_cache"}),
+                      MetalBackend(),
+                      MetalBackend({"enable_blob_cache"}),
+                      OpenGLBackend(),
+                      OpenGLBackend({"enable_blob_cache"}),
+                      VulkanBackend(),
+                      VulkanBackend({"enable_blob_cache"}));
@@ -16,9 +16,14 @@
 // AsyncTaskTests:
 //     Simple tests for dawn::native::AsyncTask and dawn::native::AsnycTaskManager.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -61,6 +66,30 @@ void DoTask(ConcurrentTaskResultQueue* resultQueue, uint32_t id) {
     resultQueue->AddResult(std::move(result));
 }
 
+// Two tasks that each wait until the other one has started. They only both complete when they run
+// on different worker threads.
+struct Rendezvous {
+    static void Arrive(void* userdata) {
+        Rendezvous* rendezvous = static_cast<Rendezvous*>(userdata);
+        std::unique_lock<std::mutex> lock(rendezvous->mutex);
+        rendezvous->arrivedCount++;
+        rendezvous->condition.notify_all();
+        if (rendezvous->condition.wait_for(lock, std::chrono::seconds(10),
+                                           [rendezvous] { return rendezvous->arrivedCount == 2; })) {
+            rendezvous->metCount++;
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint32_t arrivedCount = 0;
+    std::atomic<uint32_t> metCount{0};
+};
+
+class TwoWorkerThreadsPlatform : public dawn::platform::Platform {
+    uint32_t GetMaxWorkerThreadCount() override { return 2; }
+};
+
 }  // anonymous namespace
 
 class AsyncTaskTest : public testing::Test {};
@@ -90,3 +119,106 @@ TEST_F(AsyncTaskTest, Basic) {
     }
     ASSERT_TRUE(idset.empty());
 }
+
+// Test that posting many more tasks than there are worker threads completes all of them, and that
+// each WaitableEvent only reports completion after its task ran.
+TEST_F(AsyncTaskTest, ManyWorkerTasks) {
+    dawn::platform::Platform platform;
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    constexpr size_t kTaskCount = 256u;
+    std::vector<std::atomic<bool>> taskDone(kTaskCount);
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events;
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTask(
+            [](void* userdata) { static_cast<std::atomic<bool>*>(userdata)->store(true); },
+            &taskDone[i]));
+    }
+
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        events[i]->Wait();
+        ASSERT_TRUE(events[i]->IsComplete());
+        ASSERT_TRUE(taskDone[i].load());
+    }
+}
+
+// Test that RunNow() runs a task that hasn't started yet on the calling thread, and that the
+// worker thread then skips it.
+TEST_F(AsyncTaskTest, RunNow) {
+    dawn::platform::Platform platform;
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+    dawn::native::AsyncTaskManager taskManager(pool.get());
+
+    // Block all the worker threads so that the next task stays pending.
+    std::mutex blockMutex;
+    std::unique_lock<std::mutex> blockLock(blockMutex);
+    const uint32_t blockingTaskCount = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t i = 0; i < blockingTaskCount; ++i) {
+        taskManager.PostTask([&blockMutex] { std::lock_guard<std::mutex> lock(blockMutex); });
+    }
+
+    std::atomic<uint32_t> runCount(0);
+    std::thread::id runThread;
+    Ref<dawn::native::AsyncTaskManager::WaitableTask> task = taskManager.PostTask([&] {
+        runThread = std::this_thread::get_id();
+        runCount++;
+    });
+
+    ASSERT_TRUE(task->RunNow());
+    ASSERT_EQ(1u, runCount.load());
+    ASSERT_EQ(std::this_thread::get_id(), runThread);
+    ASSERT_FALSE(task->Cancel());
+
+    blockLock.unlock();
+    taskManager.WaitAllPendingTasks();
+    ASSERT_EQ(1u, runCount.load());
+}
+
+// Test that cancelling a task that hasn't started yet runs its cancellation callback instead of
+// its body.
+TEST_F(AsyncTaskTest, Cancel) {
+    dawn::platform::Platform platform;
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+    dawn::native::AsyncTaskManager taskManager(pool.get());
+
+    std::mutex blockMutex;
+    std::unique_lock<std::mutex> blockLock(blockMutex);
+    const uint32_t blockingTaskCount = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t i = 0; i < blockingTaskCount; ++i) {
+        taskManager.PostTask([&blockMutex] { std::lock_guard<std::mutex> lock(blockMutex); });
+    }
+
+    std::atomic<uint32_t> runCount(0);
+    std::atomic<uint32_t> cancelCount(0);
+    Ref<dawn::native::AsyncTaskManager::WaitableTask> task =
+        taskManager.PostTask([&runCount] { runCount++; }, [&cancelCount] { cancelCount++; });
+
+    ASSERT_TRUE(task->Cancel());
+    ASSERT_FALSE(task->Cancel());
+    ASSERT_FALSE(task->RunNow());
+
+    blockLock.unlock();
+    taskManager.WaitAllPendingTasks();
+    ASSERT_EQ(0u, runCount.load());
+    ASSERT_EQ(1u, cancelCount.load());
+}
+
+// Test that a burst of tasks posted while a single worker is idle spawns more workers instead of
+// handing the whole burst to the idle one.
+TEST_F(AsyncTaskTest, BurstUsesSeveralWorkers) {
+    TwoWorkerThreadsPlatform platform;
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = platform.CreateWorkerTaskPool();
+
+    // Leave one idle worker behind.
+    pool->PostWorkerTask([](void*) {}, nullptr)->Wait();
+
+    Rendezvous rendezvous;
+    std::unique_ptr<dawn::platform::WaitableEvent> first =
+        pool->PostWorkerTask(Rendezvous::Arrive, &rendezvous);
+    std::unique_ptr<dawn::platform::WaitableEvent> second =
+        pool->PostWorkerTask(Rendezvous::Arrive, &rendezvous);
+    first->Wait();
+    second->Wait();
+
+    EXPECT_EQ(2u, rendezvous.metCount.load());
+}
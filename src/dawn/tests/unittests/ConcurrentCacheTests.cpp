@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "dawn/common/ConcurrentCache.h"
 #include "dawn/native/AsyncTask.h"
@@ -108,3 +109,42 @@ TEST_F(ConcurrentCacheTest, EraseAfterInsertion) {
     ASSERT_TRUE(insertOutput.second);
     ASSERT_EQ(1u, erasedObjectCount);
 }
+
+// Test that many concurrent insertions of equal objects, spread over all the shards of the cache,
+// agree on a single cached object for each value.
+TEST_F(ConcurrentCacheTest, ManyConcurrentInsertions) {
+    constexpr size_t kValueCount = 256;
+    constexpr size_t kTaskCount = 8;
+
+    std::vector<std::vector<SimpleCachedObject>> objects(kTaskCount);
+    std::vector<std::vector<SimpleCachedObject*>> insertOutputs(kTaskCount);
+    for (size_t task = 0; task < kTaskCount; ++task) {
+        for (size_t value = 0; value < kValueCount; ++value) {
+            objects[task].emplace_back(value);
+        }
+        insertOutputs[task].resize(kValueCount);
+    }
+
+    ConcurrentCache<SimpleCachedObject>* cachePtr = &mCache;
+    for (size_t task = 0; task < kTaskCount; ++task) {
+        mTaskManager.PostTask([cachePtr, &objects, &insertOutputs, task] {
+            for (size_t value = 0; value < kValueCount; ++value) {
+                insertOutputs[task][value] = cachePtr->Insert(&objects[task][value]).first;
+            }
+        });
+    }
+    mTaskManager.WaitAllPendingTasks();
+
+    for (size_t value = 0; value < kValueCount; ++value) {
+        SimpleCachedObject* cachedObject = insertOutputs[0][value];
+        ASSERT_EQ(value, cachedObject->GetValue());
+        for (size_t task = 1; task < kTaskCount; ++task) {
+            ASSERT_EQ(cachedObject, insertOutputs[task][value]);
+        }
+        ASSERT_EQ(cachedObject, mCache.Find(&objects[0][value]));
+        ASSERT_FALSE(mCache.Empty());
+        ASSERT_EQ(1u, mCache.Erase(cachedObject));
+        ASSERT_EQ(nullptr, mCache.Find(&objects[0][value]));
+    }
+    ASSERT_TRUE(mCache.Empty());
+}
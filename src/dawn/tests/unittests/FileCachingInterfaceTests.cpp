@@ -0,0 +1,228 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "dawn/platform/FileCachingInterface.h"
+#include "gtest/gtest.h"
+
+namespace dawn::platform {
+
+namespace {
+
+class FileCachingInterfaceTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        mPath = testing::TempDir() + "dawn_file_caching_" +
+                testing::UnitTest::GetInstance()->current_test_info()->name();
+        std::remove(mPath.c_str());
+    }
+
+    void TearDown() override { std::remove(mPath.c_str()); }
+
+    std::unique_ptr<FileCachingInterface> Open(uint64_t maxSize = 1 << 20) {
+        return FileCachingInterface::Create(mPath, maxSize);
+    }
+
+    static void Store(FileCachingInterface* cache,
+                      const std::string& key,
+                      const std::string& value) {
+        cache->StoreData(key.data(), key.size(), value.data(), value.size());
+    }
+
+    // Returns the value for |key|, loading it the same way BlobCache does, or an empty string if
+    // it isn't in the cache.
+    static std::string Load(FileCachingInterface* cache, const std::string& key) {
+        size_t size = cache->LoadData(key.data(), key.size(), nullptr, 0);
+        if (size == 0) {
+            return "";
+        }
+        std::string value(size, '\0');
+        if (cache->LoadData(key.data(), key.size(), value.data(), size) != size) {
+            return "";
+        }
+        return value;
+    }
+
+    // Overwrites the byte at |offset| from the end of the pack file.
+    void CorruptByteFromEnd(long offset) {
+        FILE* file = fopen(mPath.c_str(), "r+b");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(fseek(file, -offset, SEEK_END), 0);
+        int byte = fgetc(file);
+        ASSERT_EQ(fseek(file, -offset, SEEK_END), 0);
+        fputc(byte ^ 0xFF, file);
+        fclose(file);
+    }
+
+    std::string mPath;
+};
+
+// Test that stored entries can be loaded, including after the file is reopened.
+TEST_F(FileCachingInterfaceTests, StoreAndLoad) {
+    {
+        auto cache = Open();
+        ASSERT_NE(cache, nullptr);
+        EXPECT_EQ(Load(cache.get(), "key1"), "");
+
+        Store(cache.get(), "key1", "value1");
+        Store(cache.get(), "key2", "value2");
+        EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+        EXPECT_EQ(Load(cache.get(), "key2"), "value2");
+    }
+    {
+        auto cache = Open();
+        ASSERT_NE(cache, nullptr);
+        EXPECT_EQ(cache->GetEntryCountForTesting(), 2u);
+        EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+        EXPECT_EQ(Load(cache.get(), "key2"), "value2");
+        EXPECT_EQ(Load(cache.get(), "key3"), "");
+    }
+}
+
+// Test that storing an existing key replaces its value, including after the file is reopened.
+TEST_F(FileCachingInterfaceTests, Overwrite) {
+    {
+        auto cache = Open();
+        Store(cache.get(), "key", "value1");
+        Store(cache.get(), "key", "longer value2");
+        EXPECT_EQ(Load(cache.get(), "key"), "longer value2");
+    }
+    {
+        auto cache = Open();
+        EXPECT_EQ(cache->GetEntryCountForTesting(), 1u);
+        EXPECT_EQ(Load(cache.get(), "key"), "longer value2");
+    }
+}
+
+// Test that loading with a buffer that is too small only returns the size of the value.
+TEST_F(FileCachingInterfaceTests, LoadIntoSmallBuffer) {
+    auto cache = Open();
+    Store(cache.get(), "key", "value");
+
+    std::string value(2, '\0');
+    EXPECT_EQ(cache->LoadData("key", 3, value.data(), value.size()), 5u);
+    EXPECT_EQ(value, std::string(2, '\0'));
+}
+
+// Test that the file never grows past its maximum size, and that the least recently used entries
+// are the ones evicted.
+TEST_F(FileCachingInterfaceTests, EvictsLeastRecentlyUsed) {
+    constexpr uint64_t kMaxSize = 4096;
+    const std::string kValue(256, 'x');
+
+    auto cache = Open(kMaxSize);
+    Store(cache.get(), "first", kValue);
+    for (uint32_t i = 0; i < 100; ++i) {
+        // Keep using the first entry so that it is never the least recently used.
+        EXPECT_EQ(Load(cache.get(), "first"), kValue);
+        Store(cache.get(), "key" + std::to_string(i), kValue);
+        EXPECT_LE(cache->GetFileSizeForTesting(), kMaxSize);
+    }
+
+    EXPECT_EQ(Load(cache.get(), "first"), kValue);
+    EXPECT_EQ(Load(cache.get(), "key99"), kValue);
+    EXPECT_EQ(Load(cache.get(), "key0"), "");
+    EXPECT_LT(cache->GetEntryCountForTesting(), 16u);
+}
+
+// Test that entries larger than the maximum size are not stored.
+TEST_F(FileCachingInterfaceTests, EntryLargerThanMaxSize) {
+    auto cache = Open(1024);
+    Store(cache.get(), "small", "value");
+    Store(cache.get(), "large", std::string(2048, 'x'));
+    EXPECT_EQ(Load(cache.get(), "small"), "value");
+    EXPECT_EQ(Load(cache.get(), "large"), "");
+}
+
+// Test that a corrupted record is dropped when the file is opened while the records before it
+// are kept.
+TEST_F(FileCachingInterfaceTests, CorruptedRecordOnOpen) {
+    {
+        auto cache = Open();
+        Store(cache.get(), "key1", "value1");
+        Store(cache.get(), "key2", "value2");
+    }
+    CorruptByteFromEnd(1);
+    {
+        auto cache = Open();
+        ASSERT_NE(cache, nullptr);
+        EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+        EXPECT_EQ(Load(cache.get(), "key2"), "");
+
+        // The file is still usable after dropping the corrupted record.
+        Store(cache.get(), "key3", "value3");
+        EXPECT_EQ(Load(cache.get(), "key3"), "value3");
+    }
+    {
+        auto cache = Open();
+        EXPECT_EQ(cache->GetEntryCountForTesting(), 2u);
+        EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+        EXPECT_EQ(Load(cache.get(), "key3"), "value3");
+    }
+}
+
+// Test that a record corrupted while the file is open is detected when loaded.
+TEST_F(FileCachingInterfaceTests, CorruptedRecordOnLoad) {
+    auto cache = Open();
+    Store(cache.get(), "key1", "value1");
+    Store(cache.get(), "key2", "value2");
+    CorruptByteFromEnd(1);
+
+    EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    EXPECT_EQ(Load(cache.get(), "key2"), "");
+    EXPECT_EQ(cache->GetEntryCountForTesting(), 1u);
+}
+
+// Test that a record truncated by an interrupted write is dropped when the file is opened.
+TEST_F(FileCachingInterfaceTests, TruncatedRecord) {
+    {
+        auto cache = Open();
+        Store(cache.get(), "key1", "value1");
+    }
+    {
+        // Append the beginning of a record header.
+        FILE* file = fopen(mPath.c_str(), "ab");
+        ASSERT_NE(file, nullptr);
+        const uint8_t kPartialHeader[] = {0x43, 0x45, 0x52};
+        fwrite(kPartialHeader, 1, sizeof(kPartialHeader), file);
+        fclose(file);
+    }
+    {
+        auto cache = Open();
+        EXPECT_EQ(cache->GetEntryCountForTesting(), 1u);
+        EXPECT_EQ(Load(cache.get(), "key1"), "value1");
+    }
+}
+
+// Test that files that aren't pack files are replaced with an empty cache.
+TEST_F(FileCachingInterfaceTests, InvalidFile) {
+    {
+        FILE* file = fopen(mPath.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        fputs("not a pack file", file);
+        fclose(file);
+    }
+    auto cache = Open();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->GetEntryCountForTesting(), 0u);
+    Store(cache.get(), "key", "value");
+    EXPECT_EQ(Load(cache.get(), "key"), "value");
+}
+
+}  // anonymous namespace
+
+}  // namespace dawn::platform
@@ -0,0 +1,62 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <string>
+
+#include "dawn/common/Sha256.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+std::string Sha256Hex(const std::string& message) {
+    uint8_t digest[kSha256DigestSize];
+    ComputeSha256(message.data(), message.size(), digest);
+    std::string hex;
+    for (uint8_t byte : digest) {
+        char buffer[3];
+        snprintf(buffer, sizeof(buffer), "%02x", byte);
+        hex += buffer;
+    }
+    return hex;
+}
+
+}  // anonymous namespace
+
+// Test the digests of the FIPS 180-4 examples.
+TEST(Sha256Tests, KnownDigests) {
+    EXPECT_EQ(Sha256Hex(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(Sha256Hex("abc"),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    EXPECT_EQ(Sha256Hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    EXPECT_EQ(Sha256Hex(std::string(1000000, 'a')),
+              "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+// Test messages whose padding ends exactly at, or spills over, a block boundary.
+TEST(Sha256Tests, PaddingBoundaries) {
+    EXPECT_EQ(Sha256Hex(std::string(55, 'a')),
+              "9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318");
+    EXPECT_EQ(Sha256Hex(std::string(56, 'a')),
+              "b35439a4ac6f0948b6d6f9e3c6af0f5f590ce20f1bde7090ef7970686ec6738a");
+    EXPECT_EQ(Sha256Hex(std::string(64, 'a')),
+              "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb");
+}
+
+// Test that different inputs have different digests.
+TEST(Sha256Tests, DifferentInputs) {
+    EXPECT_NE(Sha256Hex("@compute fn a() {}"), Sha256Hex("@compute fn b() {}"));
+    EXPECT_NE(Sha256Hex(std::string(1, '\0')), Sha256Hex(""));
+}
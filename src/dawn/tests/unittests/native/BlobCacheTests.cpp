@@ -0,0 +1,175 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <numeric>
+#include <string>
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/BlobCache.h"
+#include "dawn/native/CacheKey.h"
+#include "dawn/tests/mocks/platform/CachingInterfaceMock.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+
+namespace {
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::NotNull;
+
+CacheKey MakeKey(const std::string& name) {
+    CacheKey key;
+    StreamIn(&key, kDawnVersion, name);
+    return key;
+}
+
+std::string ToString(const Blob& blob) {
+    return std::string(reinterpret_cast<const char*>(blob.Data()), blob.Size());
+}
+
+uint64_t TotalLoadCount(const BlobCacheStatistics& statistics) {
+    return std::accumulate(statistics.loadLatencyHistogram.begin(),
+                           statistics.loadLatencyHistogram.end(), uint64_t(0));
+}
+
+// Test that loads and stores go to the CachingInterface when the in-memory cache is disabled.
+TEST(BlobCacheTests, WithoutMemoryCache) {
+    NiceMock<CachingInterfaceMock> cachingInterface;
+    BlobCache cache(&cachingInterface);
+
+    EXPECT_TRUE(cache.Load(MakeKey("a")).Empty());
+
+    cache.Store(MakeKey("a"), 5, "hello");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+    EXPECT_EQ(cachingInterface.GetHitCount(), 2u);
+
+    BlobCacheStatistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.memoryHitCount, 0u);
+    EXPECT_EQ(statistics.platformHitCount, 2u);
+    EXPECT_EQ(statistics.missCount, 1u);
+    EXPECT_EQ(statistics.loadedBytes, 10u);
+    EXPECT_EQ(statistics.storedBytes, 5u);
+    EXPECT_EQ(TotalLoadCount(statistics), 3u);
+}
+
+// Test that blobs are loaded from the CachingInterface without querying their size first.
+TEST(BlobCacheTests, PlatformLoadWithoutSizeQuery) {
+    NiceMock<CachingInterfaceMock> cachingInterface;
+    const std::string kLargeValue(100 * 1024, 'x');
+    BlobCache(&cachingInterface).Store(MakeKey("small"), 5, "hello");
+    BlobCache(&cachingInterface).Store(MakeKey("large"), kLargeValue.size(), kLargeValue.data());
+
+    BlobCache cache(&cachingInterface);
+    EXPECT_CALL(cachingInterface, LoadData(_, _, NotNull(), _)).Times(1);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("small"))), "hello");
+
+    // The first load of a value larger than the load buffer needs a second call with the right
+    // size, after which the buffer is large enough.
+    EXPECT_CALL(cachingInterface, LoadData(_, _, NotNull(), _)).Times(2);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("large"))), kLargeValue);
+    EXPECT_CALL(cachingInterface, LoadData(_, _, NotNull(), _)).Times(1);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("large"))), kLargeValue);
+
+    EXPECT_CALL(cachingInterface, LoadData(_, _, NotNull(), _)).Times(1);
+    EXPECT_TRUE(cache.Load(MakeKey("missing")).Empty());
+    EXPECT_EQ(cachingInterface.GetHitCount(), 3u);
+}
+
+// Test that writing to a blob served from the in-memory cache doesn't modify the cached blob.
+TEST(BlobCacheTests, MemoryCacheBlobIsCopiedOnWrite) {
+    BlobCache cache(nullptr, 1024);
+    cache.Store(MakeKey("a"), 5, "hello");
+
+    Blob blob = cache.Load(MakeKey("a"));
+    const uint8_t* sharedData = blob.Data();
+    blob.MutableData()[0] = 'j';
+    EXPECT_NE(blob.Data(), sharedData);
+    EXPECT_EQ(ToString(blob), "jello");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+}
+
+// Test that stored blobs are loaded from memory without calling the CachingInterface.
+TEST(BlobCacheTests, MemoryCacheHitOnStore) {
+    NiceMock<CachingInterfaceMock> cachingInterface;
+    BlobCache cache(&cachingInterface, 1024);
+
+    cache.Store(MakeKey("a"), 5, "hello");
+    EXPECT_CALL(cachingInterface, LoadData).Times(0);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+
+    BlobCacheStatistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.memoryHitCount, 2u);
+    EXPECT_EQ(statistics.platformHitCount, 0u);
+    EXPECT_EQ(statistics.missCount, 0u);
+    EXPECT_EQ(TotalLoadCount(statistics), 2u);
+}
+
+// Test that blobs loaded from the CachingInterface are kept in memory.
+TEST(BlobCacheTests, MemoryCacheHitOnLoad) {
+    NiceMock<CachingInterfaceMock> cachingInterface;
+    BlobCache(&cachingInterface).Store(MakeKey("a"), 5, "hello");
+
+    BlobCache cache(&cachingInterface, 1024);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+    EXPECT_EQ(cachingInterface.GetHitCount(), 1u);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "hello");
+    EXPECT_EQ(cachingInterface.GetHitCount(), 1u);
+
+    BlobCacheStatistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.memoryHitCount, 1u);
+    EXPECT_EQ(statistics.platformHitCount, 1u);
+}
+
+// Test that blobs loaded from memory stay valid after they are evicted.
+TEST(BlobCacheTests, LoadedBlobOutlivesEviction) {
+    BlobCache cache(nullptr, 8);
+
+    cache.Store(MakeKey("a"), 5, "hello");
+    Blob blob = cache.Load(MakeKey("a"));
+    cache.SetMemoryCacheSize(0);
+    EXPECT_TRUE(cache.Load(MakeKey("a")).Empty());
+    EXPECT_EQ(ToString(blob), "hello");
+}
+
+// Test that the least recently used blobs are evicted from memory first.
+TEST(BlobCacheTests, MemoryCacheEvictsLeastRecentlyUsed) {
+    NiceMock<CachingInterfaceMock> cachingInterface;
+    BlobCache cache(&cachingInterface, 10);
+
+    cache.Store(MakeKey("a"), 5, "aaaaa");
+    cache.Store(MakeKey("b"), 5, "bbbbb");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "aaaaa");
+    cache.Store(MakeKey("c"), 5, "ccccc");
+
+    // "b" was evicted, so it is loaded from the CachingInterface.
+    EXPECT_EQ(ToString(cache.Load(MakeKey("a"))), "aaaaa");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("c"))), "ccccc");
+    EXPECT_EQ(cachingInterface.GetHitCount(), 0u);
+    EXPECT_EQ(ToString(cache.Load(MakeKey("b"))), "bbbbb");
+    EXPECT_EQ(cachingInterface.GetHitCount(), 1u);
+
+    // Blobs larger than the in-memory cache are not kept in memory.
+    cache.Store(MakeKey("d"), 11, "ddddddddddd");
+    EXPECT_EQ(ToString(cache.Load(MakeKey("d"))), "ddddddddddd");
+    EXPECT_EQ(cachingInterface.GetHitCount(), 2u);
+}
+
+}  // anonymous namespace
+
+}  // namespace dawn::native
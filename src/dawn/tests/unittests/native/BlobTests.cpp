@@ -39,7 +39,7 @@ TEST(BlobTests, SizedCreation) {
     ASSERT_NE(b.Data(), nullptr);
     // We should be able to copy 10 bytes into the blob.
     char data[10] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '0'};
-    memcpy(b.Data(), data, sizeof(data));
+    memcpy(b.MutableData(), data, sizeof(data));
     // And retrieve the exact contents back.
     EXPECT_EQ(memcmp(b.Data(), data, sizeof(data)), 0);
 }
@@ -112,7 +112,7 @@ TEST(BlobTests, MoveConstruct) {
     // Create the blob.
     Blob b1 = CreateBlob(10);
     char data[10] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '0'};
-    memcpy(b1.Data(), data, sizeof(data));
+    memcpy(b1.MutableData(), data, sizeof(data));
 
     // Move construct b2 from b1.
     Blob b2(std::move(b1));
@@ -129,7 +129,7 @@ TEST(BlobTests, MoveAssign) {
     // Create the blob.
     Blob b1 = CreateBlob(10);
     char data[10] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '0'};
-    memcpy(b1.Data(), data, sizeof(data));
+    memcpy(b1.MutableData(), data, sizeof(data));
 
     // Move assign b2 from b1.
     Blob b2;
@@ -147,7 +147,7 @@ TEST(BlobTests, MoveAssignOver) {
     // Create the blob.
     Blob b1 = CreateBlob(10);
     char data[10] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '0'};
-    memcpy(b1.Data(), data, sizeof(data));
+    memcpy(b1.MutableData(), data, sizeof(data));
 
     // Create another blob with a mock deleter.
     testing::StrictMock<testing::MockFunction<void()>> mockDeleter;
@@ -27,8 +27,10 @@ namespace {
 
 using ::testing::_;
 using ::testing::ByMove;
+using ::testing::Ge;
 using ::testing::Invoke;
 using ::testing::MockFunction;
+using ::testing::NotNull;
 using ::testing::Return;
 using ::testing::StrictMock;
 using ::testing::WithArg;
@@ -74,7 +76,7 @@ DAWN_MAKE_CACHE_REQUEST(CacheRequestForTesting, REQUEST_MEMBERS)
 // static_assert the expected types for various return types from the cache hit handler and cache
 // miss handler.
 TEST_F(CacheRequestTests, CacheResultTypes) {
-    EXPECT_CALL(mMockCache, LoadData(_, _, nullptr, 0)).WillRepeatedly(Return(0));
+    EXPECT_CALL(mMockCache, LoadData(_, _, NotNull(), _)).WillRepeatedly(Return(0));
 
     // (int, ResultOrError<int>), should be ResultOrError<CacheResult<int>>.
     auto v1 = LoadOrRun(
@@ -106,7 +108,7 @@ TEST_F(CacheRequestTests, MakesCacheKey) {
              req.c);
 
     // Expect a call to LoadData with the expected key.
-    EXPECT_CALL(mMockCache, LoadData(_, expectedKey.size(), nullptr, 0))
+    EXPECT_CALL(mMockCache, LoadData(_, expectedKey.size(), NotNull(), _))
         .WillOnce(WithArg<0>(Invoke([&](const void* actualKeyData) {
             EXPECT_EQ(memcmp(actualKeyData, expectedKey.data(), expectedKey.size()), 0);
             return 0;
@@ -136,7 +138,7 @@ TEST_F(CacheRequestTests, CacheKeyIgnoresUnsafeIgnoredValue) {
     req2.d = &v2;
     req2.e = Foo{24};
 
-    EXPECT_CALL(mMockCache, LoadData(_, _, nullptr, 0)).WillOnce(Return(0)).WillOnce(Return(0));
+    EXPECT_CALL(mMockCache, LoadData(_, _, NotNull(), _)).WillOnce(Return(0)).WillOnce(Return(0));
 
     static StrictMock<MockFunction<int(CacheRequestForTesting)>> cacheMissFn;
 
@@ -185,7 +187,7 @@ TEST_F(CacheRequestTests, CacheMiss) {
     static StrictMock<MockFunction<int(CacheRequestForTesting)>> cacheMissFn;
 
     // Mock a cache miss.
-    EXPECT_CALL(mMockCache, LoadData(_, _, nullptr, 0)).WillOnce(Return(0));
+    EXPECT_CALL(mMockCache, LoadData(_, _, NotNull(), _)).WillOnce(Return(0));
 
     // Expect the cache miss, and return some value.
     int rv = 42;
@@ -226,8 +228,7 @@ TEST_F(CacheRequestTests, CacheHit) {
     static constexpr char kCachedData[] = "hello world!";
 
     // Mock a cache hit, and load the cached data.
-    EXPECT_CALL(mMockCache, LoadData(_, _, nullptr, 0)).WillOnce(Return(sizeof(kCachedData)));
-    EXPECT_CALL(mMockCache, LoadData(_, _, _, sizeof(kCachedData)))
+    EXPECT_CALL(mMockCache, LoadData(_, _, NotNull(), Ge(sizeof(kCachedData))))
         .WillOnce(WithArg<2>(Invoke([](void* dataOut) {
             memcpy(dataOut, kCachedData, sizeof(kCachedData));
             return sizeof(kCachedData);
@@ -273,8 +274,7 @@ TEST_F(CacheRequestTests, CacheHitError) {
     static constexpr char kCachedData[] = "hello world!";
 
     // Mock a cache hit, and load the cached data.
-    EXPECT_CALL(mMockCache, LoadData(_, _, nullptr, 0)).WillOnce(Return(sizeof(kCachedData)));
-    EXPECT_CALL(mMockCache, LoadData(_, _, _, sizeof(kCachedData)))
+    EXPECT_CALL(mMockCache, LoadData(_, _, NotNull(), Ge(sizeof(kCachedData))))
         .WillOnce(WithArg<2>(Invoke([](void* dataOut) {
             memcpy(dataOut, kCachedData, sizeof(kCachedData));
             return sizeof(kCachedData);
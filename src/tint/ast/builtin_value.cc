@@ -22,49 +22,55 @@
 
 #include "src/tint/ast/builtin_value.h"
 
+#include "src/tint/utils/perfect_hash.h"
+
 namespace tint::ast {
 
 /// ParseBuiltinValue parses a BuiltinValue from a string.
 /// @param str the string to parse
 /// @returns the parsed enum, or BuiltinValue::kInvalid if the string could not be parsed.
 BuiltinValue ParseBuiltinValue(std::string_view str) {
-    if (str == "position") {
-        return BuiltinValue::kPosition;
-    }
-    if (str == "vertex_index") {
-        return BuiltinValue::kVertexIndex;
-    }
-    if (str == "instance_index") {
-        return BuiltinValue::kInstanceIndex;
-    }
-    if (str == "front_facing") {
-        return BuiltinValue::kFrontFacing;
-    }
-    if (str == "frag_depth") {
-        return BuiltinValue::kFragDepth;
-    }
-    if (str == "local_invocation_id") {
-        return BuiltinValue::kLocalInvocationId;
-    }
-    if (str == "local_invocation_index") {
-        return BuiltinValue::kLocalInvocationIndex;
-    }
-    if (str == "global_invocation_id") {
-        return BuiltinValue::kGlobalInvocationId;
-    }
-    if (str == "workgroup_id") {
-        return BuiltinValue::kWorkgroupId;
-    }
-    if (str == "num_workgroups") {
-        return BuiltinValue::kNumWorkgroups;
-    }
-    if (str == "sample_index") {
-        return BuiltinValue::kSampleIndex;
-    }
-    if (str == "sample_mask") {
-        return BuiltinValue::kSampleMask;
-    }
-    return BuiltinValue::kInvalid;
+    // Perfect hash table of the enum entries, generated by tools/src/cmd/gen.
+    struct Entry {
+        std::string_view name;
+        BuiltinValue value;
+    };
+    static constexpr Entry kEntries[] = {
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"global_invocation_id", BuiltinValue::kGlobalInvocationId},
+        {"front_facing", BuiltinValue::kFrontFacing},
+        {"", BuiltinValue::kInvalid},
+        {"local_invocation_index", BuiltinValue::kLocalInvocationIndex},
+        {"", BuiltinValue::kInvalid},
+        {"vertex_index", BuiltinValue::kVertexIndex},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"sample_mask", BuiltinValue::kSampleMask},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"position", BuiltinValue::kPosition},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"num_workgroups", BuiltinValue::kNumWorkgroups},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"instance_index", BuiltinValue::kInstanceIndex},
+        {"", BuiltinValue::kInvalid},
+        {"", BuiltinValue::kInvalid},
+        {"local_invocation_id", BuiltinValue::kLocalInvocationId},
+        {"sample_index", BuiltinValue::kSampleIndex},
+        {"", BuiltinValue::kInvalid},
+        {"frag_depth", BuiltinValue::kFragDepth},
+        {"workgroup_id", BuiltinValue::kWorkgroupId},
+        {"", BuiltinValue::kInvalid},
+    };
+    const Entry& entry = kEntries[utils::PerfectHash(str, 2) & 31];
+    return entry.name == str ? entry.value : BuiltinValue::kInvalid;
 }
 
 std::ostream& operator<<(std::ostream& out, BuiltinValue value) {
@@ -22,25 +22,31 @@
 
 #include "src/tint/ast/extension.h"
 
+#include "src/tint/utils/perfect_hash.h"
+
 namespace tint::ast {
 
 /// ParseExtension parses a Extension from a string.
 /// @param str the string to parse
 /// @returns the parsed enum, or Extension::kInvalid if the string could not be parsed.
 Extension ParseExtension(std::string_view str) {
-    if (str == "f16") {
-        return Extension::kF16;
-    }
-    if (str == "chromium_experimental_dp4a") {
-        return Extension::kChromiumExperimentalDp4A;
-    }
-    if (str == "chromium_disable_uniformity_analysis") {
-        return Extension::kChromiumDisableUniformityAnalysis;
-    }
-    if (str == "chromium_experimental_push_constant") {
-        return Extension::kChromiumExperimentalPushConstant;
-    }
-    return Extension::kInvalid;
+    // Perfect hash table of the enum entries, generated by tools/src/cmd/gen.
+    struct Entry {
+        std::string_view name;
+        Extension value;
+    };
+    static constexpr Entry kEntries[] = {
+        {"", Extension::kInvalid},
+        {"chromium_experimental_push_constant", Extension::kChromiumExperimentalPushConstant},
+        {"", Extension::kInvalid},
+        {"chromium_experimental_dp4a", Extension::kChromiumExperimentalDp4A},
+        {"chromium_disable_uniformity_analysis", Extension::kChromiumDisableUniformityAnalysis},
+        {"", Extension::kInvalid},
+        {"f16", Extension::kF16},
+        {"", Extension::kInvalid},
+    };
+    const Entry& entry = kEntries[utils::PerfectHash(str, 1) & 7];
+    return entry.name == str ? entry.value : Extension::kInvalid;
 }
 
 std::ostream& operator<<(std::ostream& out, Extension value) {
@@ -22,31 +22,39 @@
 
 #include "src/tint/ast/storage_class.h"
 
+#include "src/tint/utils/perfect_hash.h"
+
 namespace tint::ast {
 
 /// ParseStorageClass parses a StorageClass from a string.
 /// @param str the string to parse
 /// @returns the parsed enum, or StorageClass::kInvalid if the string could not be parsed.
 StorageClass ParseStorageClass(std::string_view str) {
-    if (str == "function") {
-        return StorageClass::kFunction;
-    }
-    if (str == "private") {
-        return StorageClass::kPrivate;
-    }
-    if (str == "workgroup") {
-        return StorageClass::kWorkgroup;
-    }
-    if (str == "uniform") {
-        return StorageClass::kUniform;
-    }
-    if (str == "storage") {
-        return StorageClass::kStorage;
-    }
-    if (str == "push_constant") {
-        return StorageClass::kPushConstant;
-    }
-    return StorageClass::kInvalid;
+    // Perfect hash table of the enum entries, generated by tools/src/cmd/gen.
+    struct Entry {
+        std::string_view name;
+        StorageClass value;
+    };
+    static constexpr Entry kEntries[] = {
+        {"", StorageClass::kInvalid},
+        {"", StorageClass::kInvalid},
+        {"", StorageClass::kInvalid},
+        {"", StorageClass::kInvalid},
+        {"uniform", StorageClass::kUniform},
+        {"push_constant", StorageClass::kPushConstant},
+        {"", StorageClass::kInvalid},
+        {"private", StorageClass::kPrivate},
+        {"", StorageClass::kInvalid},
+        {"", StorageClass::kInvalid},
+        {"", StorageClass::kInvalid},
+        {"workgroup", StorageClass::kWorkgroup},
+        {"storage", StorageClass::kStorage},
+        {"", StorageClass::kInvalid},
+        {"", StorageClass::kInvalid},
+        {"function", StorageClass::kFunction},
+    };
+    const Entry& entry = kEntries[utils::PerfectHash(str, 0) & 15];
+    return entry.name == str ? entry.value : StorageClass::kInvalid;
 }
 
 std::ostream& operator<<(std::ostream& out, StorageClass value) {
@@ -22,61 +22,55 @@
 
 #include "src/tint/ast/texel_format.h"
 
+#include "src/tint/utils/perfect_hash.h"
+
 namespace tint::ast {
 
 /// ParseTexelFormat parses a TexelFormat from a string.
 /// @param str the string to parse
 /// @returns the parsed enum, or TexelFormat::kInvalid if the string could not be parsed.
 TexelFormat ParseTexelFormat(std::string_view str) {
-    if (str == "rgba8unorm") {
-        return TexelFormat::kRgba8Unorm;
-    }
-    if (str == "rgba8snorm") {
-        return TexelFormat::kRgba8Snorm;
-    }
-    if (str == "rgba8uint") {
-        return TexelFormat::kRgba8Uint;
-    }
-    if (str == "rgba8sint") {
-        return TexelFormat::kRgba8Sint;
-    }
-    if (str == "rgba16uint") {
-        return TexelFormat::kRgba16Uint;
-    }
-    if (str == "rgba16sint") {
-        return TexelFormat::kRgba16Sint;
-    }
-    if (str == "rgba16float") {
-        return TexelFormat::kRgba16Float;
-    }
-    if (str == "r32uint") {
-        return TexelFormat::kR32Uint;
-    }
-    if (str == "r32sint") {
-        return TexelFormat::kR32Sint;
-    }
-    if (str == "r32float") {
-        return TexelFormat::kR32Float;
-    }
-    if (str == "rg32uint") {
-        return TexelFormat::kRg32Uint;
-    }
-    if (str == "rg32sint") {
-        return TexelFormat::kRg32Sint;
-    }
-    if (str == "rg32float") {
-        return TexelFormat::kRg32Float;
-    }
-    if (str == "rgba32uint") {
-        return TexelFormat::kRgba32Uint;
-    }
-    if (str == "rgba32sint") {
-        return TexelFormat::kRgba32Sint;
-    }
-    if (str == "rgba32float") {
-        return TexelFormat::kRgba32Float;
-    }
-    return TexelFormat::kInvalid;
+    // Perfect hash table of the enum entries, generated by tools/src/cmd/gen.
+    struct Entry {
+        std::string_view name;
+        TexelFormat value;
+    };
+    static constexpr Entry kEntries[] = {
+        {"rgba16sint", TexelFormat::kRgba16Sint},
+        {"", TexelFormat::kInvalid},
+        {"rg32uint", TexelFormat::kRg32Uint},
+        {"rgba32float", TexelFormat::kRgba32Float},
+        {"rgba16uint", TexelFormat::kRgba16Uint},
+        {"rgba16float", TexelFormat::kRgba16Float},
+        {"r32float", TexelFormat::kR32Float},
+        {"rgba8snorm", TexelFormat::kRgba8Snorm},
+        {"r32uint", TexelFormat::kR32Uint},
+        {"rgba8uint", TexelFormat::kRgba8Uint},
+        {"rgba32sint", TexelFormat::kRgba32Sint},
+        {"rgba8sint", TexelFormat::kRgba8Sint},
+        {"", TexelFormat::kInvalid},
+        {"rg32float", TexelFormat::kRg32Float},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"r32sint", TexelFormat::kR32Sint},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"rgba32uint", TexelFormat::kRgba32Uint},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"rg32sint", TexelFormat::kRg32Sint},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"", TexelFormat::kInvalid},
+        {"rgba8unorm", TexelFormat::kRgba8Unorm},
+    };
+    const Entry& entry = kEntries[utils::PerfectHash(str, 18) & 31];
+    return entry.name == str ? entry.value : TexelFormat::kInvalid;
 }
 
 std::ostream& operator<<(std::ostream& out, TexelFormat value) {
@@ -24,6 +24,8 @@ const TypeInfo detail::TypeInfoOf<CastableBase>::info{
     "CastableBase",
     tint::TypeInfo::HashCodeOf<CastableBase>(),
     tint::TypeInfo::FullHashCodeOf<CastableBase>(),
+    0,
+    detail::AncestorsOf<CastableBase>(),
 };
 
 CastableBase::CastableBase(const CastableBase&) = default;
@@ -74,6 +74,8 @@ static constexpr bool IsCastable =
         #CLASS,                                                 \
         tint::TypeInfo::HashCodeOf<CLASS>(),                    \
         tint::TypeInfo::FullHashCodeOf<CLASS>(),                \
+        tint::TypeInfo::DepthOf<CLASS>(),                       \
+        tint::detail::AncestorsOf<CLASS>(),                     \
     };                                                          \
     TINT_CASTABLE_POP_DISABLE_WARNINGS()
 
@@ -100,6 +102,11 @@ struct TypeInfo {
     const HashCode hashcode;
     /// The type hash code bitwise-or'd with all ancestor's hashcodes.
     const HashCode full_hashcode;
+    /// The number of ancestors of this type. CastableBase has a depth of 0.
+    const uint32_t depth;
+    /// The TypeInfo of this type and of each of its ancestors, indexed by depth. `ancestors[0]`
+    /// is the TypeInfo of CastableBase, and `ancestors[depth]` is this TypeInfo.
+    const TypeInfo* const* ancestors;
 
     /// @returns true if `type` derives from the class `TO`
     /// @param object the object type to test from, which must be, or derive from
@@ -127,7 +134,10 @@ struct TypeInfo {
             // We do not need to check ancestors, only whether this type is equal to the type T.
             return type == this;
         } else {
-            return Is(type);
+            // The depth of T is known at compile time, so only the ancestor of this type at that
+            // depth needs to be compared.
+            constexpr uint32_t kDepth = DepthOf<std::remove_cv_t<T>>();
+            return depth >= kDepth && ancestors[kDepth] == type;
         }
     }
 
@@ -135,21 +145,9 @@ struct TypeInfo {
     /// @returns true if the class with this TypeInfo is of, or derives from the
     /// class with the given TypeInfo.
     inline bool Is(const tint::TypeInfo* type) const {
-        // Optimization: Check whether the all the bits of the type's hashcode can
-        // be found in the full_hashcode. If a single bit is missing, then we
-        // can quickly tell that that this TypeInfo does not derive from `type`.
-        if ((full_hashcode & type->hashcode) != type->hashcode) {
-            return false;
-        }
-
-        // Walk the base types, starting with this TypeInfo, to see if any of the pointers match
-        // `type`.
-        for (auto* ti = this; ti != nullptr; ti = ti->base) {
-            if (ti == type) {
-                return true;
-            }
-        }
-        return false;
+        // If this type derives from `type`, then `type` is the ancestor of this type at the depth
+        // of `type`.
+        return depth >= type->depth && ancestors[type->depth] == type;
     }
 
     /// @returns the static TypeInfo for the type T
@@ -190,6 +188,16 @@ struct TypeInfo {
         }
     }
 
+    /// @returns the number of ancestors of the type `T`
+    template <typename T>
+    static constexpr uint32_t DepthOf() {
+        if constexpr (std::is_same_v<T, CastableBase>) {
+            return 0;
+        } else {
+            return DepthOf<typename T::TrueBase>() + 1;
+        }
+    }
+
     /// @returns the bitwise-or'd hashcodes of all the types of the tuple `TUPLE`.
     /// @see HashCodeOf
     template <typename TUPLE>
@@ -265,6 +273,22 @@ struct TypeInfoOf {
 /// type, but can always be automatically inferred.
 struct Infer;
 
+/// The TypeInfo of each of the types in `TYPES`, in order.
+template <typename... TYPES>
+inline constexpr const TypeInfo* kTypeInfos[] = {&TypeInfoOf<TYPES>::info...};
+
+/// @returns the TypeInfo of `T` and of each of its ancestors, indexed by depth, followed by the
+/// TypeInfo of each of the types in `DERIVED`.
+/// @see TypeInfo::ancestors
+template <typename T, typename... DERIVED>
+constexpr const TypeInfo* const* AncestorsOf() {
+    if constexpr (std::is_same_v<T, CastableBase>) {
+        return kTypeInfos<CastableBase, DERIVED...>;
+    } else {
+        return AncestorsOf<typename T::TrueBase, T, DERIVED...>();
+    }
+}
+
 }  // namespace detail
 
 /// @returns true if `obj` is a valid pointer, and is of, or derives from the
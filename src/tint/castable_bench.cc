@@ -229,6 +229,49 @@ void CastableSmallSwitch(::benchmark::State& state) {
 
 BENCHMARK(CastableSmallSwitch);
 
+void CastableLargeSwitchIntermediateTypes(::benchmark::State& state) {
+    auto objects = MakeObjects();
+    size_t i = 0;
+    for (auto _ : state) {
+        auto* object = objects[i % objects.size()].get();
+        Switch(
+            object,  //
+            [&](const AAA*) { ::benchmark::DoNotOptimize(i += 40); },
+            [&](const ABB*) { ::benchmark::DoNotOptimize(i += 90); },
+            [&](const AA*) { ::benchmark::DoNotOptimize(i += 30); },
+            [&](const AB*) { ::benchmark::DoNotOptimize(i += 70); },
+            [&](const AC*) { ::benchmark::DoNotOptimize(i += 110); },
+            [&](const BA*) { ::benchmark::DoNotOptimize(i += 160); },
+            [&](const BB*) { ::benchmark::DoNotOptimize(i += 200); },
+            [&](const BCC*) { ::benchmark::DoNotOptimize(i += 270); },
+            [&](const BC*) { ::benchmark::DoNotOptimize(i += 240); },
+            [&](const CA*) { ::benchmark::DoNotOptimize(i += 290); },
+            [&](const CB*) { ::benchmark::DoNotOptimize(i += 330); },
+            [&](const CC*) { ::benchmark::DoNotOptimize(i += 370); },
+            [&](const A*) { ::benchmark::DoNotOptimize(i += 20); },
+            [&](const B*) { ::benchmark::DoNotOptimize(i += 150); },
+            [&](const C*) { ::benchmark::DoNotOptimize(i += 280); },
+            [&](Default) { ::benchmark::DoNotOptimize(i += 123); });
+        i = (i * 31) ^ (i << 5);
+    }
+}
+
+BENCHMARK(CastableLargeSwitchIntermediateTypes);
+
+void CastableIs(::benchmark::State& state) {
+    auto objects = MakeObjects();
+    size_t i = 0;
+    for (auto _ : state) {
+        auto* object = objects[i % objects.size()].get();
+        ::benchmark::DoNotOptimize(i += object->Is<A>() ? 10 : 20);
+        ::benchmark::DoNotOptimize(i += object->Is<BB>() ? 30 : 40);
+        ::benchmark::DoNotOptimize(i += object->Is<CCA>() ? 50 : 60);
+        i = (i * 31) ^ (i << 5);
+    }
+}
+
+BENCHMARK(CastableIs);
+
 }  // namespace
 }  // namespace tint
 
@@ -189,6 +189,24 @@ TEST(Castable, Is) {
     ASSERT_TRUE(gecko->Is<Reptile>());
 }
 
+TEST(Castable, TypeInfoAncestors) {
+    auto& gecko = TypeInfo::Of<Gecko>();
+    ASSERT_EQ(gecko.depth, 4u);
+    EXPECT_EQ(gecko.ancestors[0], &TypeInfo::Of<CastableBase>());
+    EXPECT_EQ(gecko.ancestors[1], &TypeInfo::Of<Animal>());
+    EXPECT_EQ(gecko.ancestors[2], &TypeInfo::Of<Reptile>());
+    EXPECT_EQ(gecko.ancestors[3], &TypeInfo::Of<Lizard>());
+    EXPECT_EQ(gecko.ancestors[4], &gecko);
+    EXPECT_EQ(TypeInfo::Of<CastableBase>().depth, 0u);
+
+    EXPECT_TRUE(gecko.Is(&TypeInfo::Of<CastableBase>()));
+    EXPECT_TRUE(gecko.Is(&TypeInfo::Of<Lizard>()));
+    EXPECT_TRUE(gecko.Is(&gecko));
+    EXPECT_FALSE(gecko.Is(&TypeInfo::Of<Frog>()));
+    EXPECT_FALSE(gecko.Is(&TypeInfo::Of<Mammal>()));
+    EXPECT_FALSE(TypeInfo::Of<Lizard>().Is(&gecko));
+}
+
 TEST(Castable, IsWithPredicate) {
     std::unique_ptr<Animal> frog = std::make_unique<Frog>();
 
@@ -15,6 +15,7 @@
 #include "src/tint/clone_context.h"
 
 #include <string>
+#include <string_view>
 
 #include "src/tint/program_builder.h"
 #include "src/tint/utils/map.h"
@@ -36,7 +37,14 @@ CloneContext::CloneContext(ProgramBuilder* to, Program const* from, bool auto_cl
         // Almost all transforms will want to clone all symbols before doing any
         // work, to avoid any newly created symbols clashing with existing symbols
         // in the source program and causing them to be renamed.
-        from->Symbols().Foreach([&](Symbol s, const std::string&) { Clone(s); });
+        if (to->Symbols().IsEmpty()) {
+            // The destination has no symbols of its own, so it shares the names of the source,
+            // and each symbol is cloned to the destination symbol with the same value.
+            to->Symbols() = SymbolTable(from->Symbols(), to->ID());
+            num_shared_symbols_ = from->Symbols().Count();
+        } else {
+            from->Symbols().Foreach([&](Symbol s, std::string_view) { Clone(s); });
+        }
     }
 }
 
@@ -48,6 +56,13 @@ Symbol CloneContext::Clone(Symbol s) {
     if (!src) {
         return s;  // In-place clone
     }
+    if (s.IsValid() && s.value() <= num_shared_symbols_) {
+#if TINT_SYMBOL_STORE_DEBUG_NAME
+        return Symbol(s.value(), dst->ID(), src->Symbols().NameFor(s));
+#else
+        return Symbol(s.value(), dst->ID());
+#endif
+    }
     return utils::GetOrCreate(cloned_symbols_, s, [&]() -> Symbol {
         if (symbol_transform_) {
             return symbol_transform_(s);
@@ -569,6 +569,10 @@ class CloneContext {
     /// A map of symbol in #src to their cloned equivalent in #dst
     std::unordered_map<Symbol, Symbol> cloned_symbols_;
 
+    /// The number of symbols of #src that #dst shares, which are cloned to the symbol with the
+    /// same value
+    uint32_t num_shared_symbols_ = 0;
+
     /// Cloneable transform functions registered with ReplaceAll()
     utils::Vector<CloneableTransform, 8> transforms_;
 
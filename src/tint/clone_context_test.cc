@@ -889,6 +889,44 @@ TEST_F(CloneContextTest, CloneNewSymbols_AfterCloneSymbols) {
     EXPECT_EQ(cloned.Symbols().NameFor(new_c), "c");
 }
 
+TEST_F(CloneContextTest, CloneSymbols_SharedWithSource) {
+    ProgramBuilder builder;
+    Symbol old_a = builder.Symbols().New("a");
+    Symbol old_b = builder.Symbols().New("b");
+    Program original(std::move(builder));
+
+    ProgramBuilder cloned;
+    CloneContext ctx(&cloned, &original);
+    Symbol new_b = ctx.Clone(old_b);
+    Symbol new_c = cloned.Symbols().New("c");
+    Symbol new_a = ctx.Clone(old_a);
+
+    EXPECT_EQ(new_a.value(), old_a.value());
+    EXPECT_EQ(new_b.value(), old_b.value());
+    EXPECT_EQ(new_a.ProgramID(), cloned.ID());
+    EXPECT_EQ(cloned.Symbols().NameFor(new_a), "a");
+    EXPECT_EQ(cloned.Symbols().NameFor(new_b), "b");
+    EXPECT_EQ(cloned.Symbols().NameFor(new_c), "c");
+    EXPECT_FALSE(original.Symbols().Get("c").IsValid());
+}
+
+TEST_F(CloneContextTest, CloneSymbols_IntoNonEmptyProgram) {
+    ProgramBuilder builder;
+    Symbol old_a = builder.Symbols().New("a");
+    Symbol old_b = builder.Symbols().New("b");
+    Program original(std::move(builder));
+
+    ProgramBuilder cloned;
+    Symbol new_b = cloned.Symbols().New("b");
+    CloneContext ctx(&cloned, &original);
+    Symbol new_a = ctx.Clone(old_a);
+    Symbol new_b_1 = ctx.Clone(old_b);
+
+    EXPECT_EQ(cloned.Symbols().NameFor(new_a), "a");
+    EXPECT_EQ(cloned.Symbols().NameFor(new_b), "b");
+    EXPECT_EQ(cloned.Symbols().NameFor(new_b_1), "b_1");
+}
+
 TEST_F(CloneContextTest, ProgramIDs) {
     ProgramBuilder dst;
     Program src(ProgramBuilder{});
@@ -12,15 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #if TINT_BUILD_GLSL_WRITER
@@ -33,7 +39,11 @@
 #endif  // TINT_BUILD_SPV_READER
 
 #include "src/tint/ast/module.h"
+#if TINT_BUILD_WGSL_READER
+#include "src/tint/reader/wgsl/parser_impl.h"
+#endif  // TINT_BUILD_WGSL_READER
 #include "src/tint/utils/io/command.h"
+#include "src/tint/utils/parallel_for.h"
 #include "src/tint/utils/string.h"
 #include "src/tint/utils/transform.h"
 #include "src/tint/val/val.h"
@@ -71,6 +81,11 @@ struct Options {
     bool show_help = false;
     bool verbose = false;
 
+    std::vector<std::string> input_filenames;
+    std::string manifest;
+    std::string output_dir;
+    size_t jobs = 0;  // Default to the number of hardware threads
+
     std::string input_filename;
     std::string output_file = "-";  // Default to stdout
 
@@ -79,6 +94,7 @@ struct Options {
     bool validate = false;
     bool demangle = false;
     bool dump_inspector_bindings = false;
+    bool time_passes = false;
 
     Format format = Format::kNone;
 
@@ -94,7 +110,11 @@ struct Options {
     std::optional<tint::sem::BindingPoint> hlsl_root_constant_binding_point;
 };
 
-const char kUsage[] = R"(Usage: tint [options] <input-file>
+const char kUsage[] = R"(Usage: tint [options] <input-file>...
+
+ When several input files, a manifest or an output directory are given, the input
+ files are compiled in parallel and each output is written to a file named after
+ its input file, with the extension of the output format.
 
  options:
   --format <spirv|spvasm|wgsl|msl|hlsl>  -- Output format.
@@ -109,6 +129,13 @@ const char kUsage[] = R"(Usage: tint [options] <input-file>
   -ep <name>                -- Output single entry point
   --output-file <name>      -- Output file name.  Use "-" for standard output
   -o <name>                 -- Output file name.  Use "-" for standard output
+  --output-dir <dir>        -- Directory of the output files of a batch compilation.
+                               Defaults to the directory of each input file.
+                               The directory is created if it doesn't exist.
+  --manifest <file>         -- Compiles the input files listed in <file>, one per line.
+  --jobs <count>            -- Number of files to compile in parallel. Defaults to the
+                               number of hardware threads.
+  -j <count>                -- Same as --jobs
   --transform <name list>   -- Runs transforms, name list is comma separated
                                Available transforms:
 ${transforms}
@@ -117,6 +144,8 @@ ${transforms}
   --demangle                -- Preserve original source names. Demangle them.
                                Affects AST dumping, and text-based output languages.
   --dump-inspector-bindings -- Dump reflection data about bindins to stdout.
+  --time-passes             -- Print the time spent in each phase and in each transform,
+                               along with the size of the programs they produce.
   -h                        -- This help text
   --hlsl-root-constant-binding-point <group>,<binding>  -- Binding point for root constant.
                                Specify the binding point for generated uniform buffer
@@ -398,6 +427,32 @@ bool ParseArgs(const std::vector<std::string>& args, Options* opts) {
             }
             opts->output_file = args[i];
 
+        } else if (arg == "--output-dir") {
+            ++i;
+            if (i >= args.size()) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            opts->output_dir = args[i];
+        } else if (arg == "--manifest") {
+            ++i;
+            if (i >= args.size()) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            opts->manifest = args[i];
+        } else if (arg == "-j" || arg == "--jobs") {
+            ++i;
+            if (i >= args.size()) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                return false;
+            }
+            auto jobs = parse_unsigned_number(args[i]);
+            if (!jobs.has_value() || jobs.value() == 0) {
+                std::cerr << "Invalid value for " << arg << ": " << args[i] << std::endl;
+                return false;
+            }
+            opts->jobs = static_cast<size_t>(jobs.value());
         } else if (arg == "-h" || arg == "--help") {
             opts->show_help = true;
         } else if (arg == "-v" || arg == "--verbose") {
@@ -417,6 +472,8 @@ bool ParseArgs(const std::vector<std::string>& args, Options* opts) {
             opts->demangle = true;
         } else if (arg == "--dump-inspector-bindings") {
             opts->dump_inspector_bindings = true;
+        } else if (arg == "--time-passes") {
+            opts->time_passes = true;
         } else if (arg == "--validate") {
             opts->validate = true;
         } else if (arg == "--fxc") {
@@ -481,12 +538,7 @@ bool ParseArgs(const std::vector<std::string>& args, Options* opts) {
                 std::cerr << "Unrecognized option: " << arg << std::endl;
                 return false;
             }
-            if (!opts->input_filename.empty()) {
-                std::cerr << "More than one input file specified: '" << opts->input_filename
-                          << "' and '" << arg << "'" << std::endl;
-                return false;
-            }
-            opts->input_filename = arg;
+            opts->input_filenames.push_back(arg);
         }
     }
     return true;
@@ -494,13 +546,13 @@ bool ParseArgs(const std::vector<std::string>& args, Options* opts) {
 
 /// Copies the content from the file named `input_file` to `buffer`,
 /// assuming each element in the file is of type `T`.  If any error occurs,
-/// writes error messages to the standard error stream and returns false.
+/// writes error messages to `err` and returns false.
 /// Assumes the size of a `T` object is divisible by its required alignment.
 /// @returns true if we successfully read the file.
 template <typename T>
-bool ReadFile(const std::string& input_file, std::vector<T>* buffer) {
+bool ReadFile(const std::string& input_file, std::vector<T>* buffer, std::ostream& err) {
     if (!buffer) {
-        std::cerr << "The buffer pointer was null" << std::endl;
+        err << "The buffer pointer was null" << std::endl;
         return false;
     }
 
@@ -511,14 +563,14 @@ bool ReadFile(const std::string& input_file, std::vector<T>* buffer) {
     file = fopen(input_file.c_str(), "rb");
 #endif
     if (!file) {
-        std::cerr << "Failed to open " << input_file << std::endl;
+        err << "Failed to open " << input_file << std::endl;
         return false;
     }
 
     fseek(file, 0, SEEK_END);
     const auto file_size = static_cast<size_t>(ftell(file));
     if (0 != (file_size % sizeof(T))) {
-        std::cerr << "File " << input_file
+        err << "File " << input_file
                   << " does not contain an integral number of objects: " << file_size
                   << " bytes in the file, require " << sizeof(T) << " bytes per object"
                   << std::endl;
@@ -533,7 +585,7 @@ bool ReadFile(const std::string& input_file, std::vector<T>* buffer) {
     size_t bytes_read = fread(buffer->data(), 1, file_size, file);
     fclose(file);
     if (bytes_read != file_size) {
-        std::cerr << "Failed to read " << input_file << std::endl;
+        err << "Failed to read " << input_file << std::endl;
         return false;
     }
 
@@ -543,11 +595,14 @@ bool ReadFile(const std::string& input_file, std::vector<T>* buffer) {
 /// Writes the given `buffer` into the file named as `output_file` using the
 /// given `mode`.  If `output_file` is empty or "-", writes to standard
 /// output. If any error occurs, returns false and outputs error message to
-/// standard error. The ContainerT type must have data() and size() methods,
+/// `err`. The ContainerT type must have data() and size() methods,
 /// like `std::string` and `std::vector` do.
 /// @returns true on success
 template <typename ContainerT>
-bool WriteFile(const std::string& output_file, const std::string mode, const ContainerT& buffer) {
+bool WriteFile(const std::string& output_file,
+               const std::string mode,
+               const ContainerT& buffer,
+               std::ostream& err) {
     const bool use_stdout = output_file.empty() || output_file == "-";
     FILE* file = stdout;
 
@@ -558,7 +613,7 @@ bool WriteFile(const std::string& output_file, const std::string mode, const Con
         file = fopen(output_file.c_str(), mode.c_str());
 #endif
         if (!file) {
-            std::cerr << "Could not open file " << output_file << " for writing" << std::endl;
+            err << "Could not open file " << output_file << " for writing" << std::endl;
             return false;
         }
     }
@@ -567,9 +622,9 @@ bool WriteFile(const std::string& output_file, const std::string mode, const Con
         fwrite(buffer.data(), sizeof(typename ContainerT::value_type), buffer.size(), file);
     if (buffer.size() != written) {
         if (use_stdout) {
-            std::cerr << "Could not write all output to standard output" << std::endl;
+            err << "Could not write all output to standard output" << std::endl;
         } else {
-            std::cerr << "Could not write to file " << output_file << std::endl;
+            err << "Could not write to file " << output_file << std::endl;
             fclose(file);
         }
         return false;
@@ -582,7 +637,7 @@ bool WriteFile(const std::string& output_file, const std::string mode, const Con
 }
 
 #if TINT_BUILD_SPV_WRITER
-std::string Disassemble(const std::vector<uint32_t>& data) {
+std::string Disassemble(const std::vector<uint32_t>& data, std::ostream& err) {
     std::string spv_errors;
     spv_target_env target_env = SPV_ENV_UNIVERSAL_1_0;
 
@@ -615,7 +670,7 @@ std::string Disassemble(const std::vector<uint32_t>& data) {
     if (!tools.Disassemble(
             data, &result,
             SPV_BINARY_TO_TEXT_OPTION_INDENT | SPV_BINARY_TO_TEXT_OPTION_FRIENDLY_NAMES)) {
-        std::cerr << spv_errors << std::endl;
+        err << spv_errors << std::endl;
     }
     return result;
 }
@@ -636,29 +691,131 @@ void PrintWGSL(std::ostream& out, const tint::Program& program) {
 #endif
 }
 
+/// PrintDiagnostics writes the formatted diagnostics to `err`. Colors are used when `err` is the
+/// standard error stream and it is a terminal.
+/// @param diagnostics the diagnostics to print
+/// @param err the output stream to write the diagnostics to
+void PrintDiagnostics(const tint::diag::List& diagnostics, std::ostream& err) {
+    tint::diag::Formatter diag_formatter;
+    if (&err == &std::cerr) {
+        auto diag_printer = tint::diag::Printer::create(stderr, true);
+        diag_formatter.format(diagnostics, diag_printer.get());
+    } else {
+        err << diag_formatter.format(diagnostics);
+    }
+}
+
+/// Statistics accumulated over all the runs of a transform
+struct TransformTotals {
+    /// The number of times the transform was run
+    size_t runs = 0;
+    /// The number of runs that made no changes to the program
+    size_t skipped = 0;
+    /// The total time spent running the transform
+    std::chrono::duration<double, std::milli> duration{};
+    /// The total number of AST nodes of the programs produced by the transform
+    size_t ast_node_count = 0;
+    /// The total number of semantic nodes of the programs produced by the transform
+    size_t sem_node_count = 0;
+    /// The total number of bytes allocated for the programs produced by the transform
+    size_t allocated_bytes = 0;
+
+    /// Adds the statistics of `other` to the statistics of this object.
+    /// @param other the statistics to add
+    /// @returns this object
+    TransformTotals& operator+=(const TransformTotals& other) {
+        runs += other.runs;
+        skipped += other.skipped;
+        duration += other.duration;
+        ast_node_count += other.ast_node_count;
+        sem_node_count += other.sem_node_count;
+        allocated_bytes += other.allocated_bytes;
+        return *this;
+    }
+};
+
+/// The time spent in each phase of the compilation of a file, and in each transform.
+struct PhaseTimes {
+    /// Duration in milliseconds
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    /// Time spent parsing the input file. For SPIR-V inputs, this includes the resolve phase.
+    Duration parse{};
+    /// Time spent resolving the parsed WGSL program
+    Duration resolve{};
+    /// Time spent running the transforms
+    Duration transform{};
+    /// Time spent generating, writing and validating the output
+    Duration generate{};
+    /// The statistics of each transform, keyed by transform name. This includes the transforms
+    /// run by the writers.
+    std::map<std::string, TransformTotals> transforms;
+
+    /// @returns the total time spent in all the phases
+    Duration Total() const { return parse + resolve + transform + generate; }
+
+    /// Adds the times of `other` to the times of this object.
+    /// @param other the times to add
+    /// @returns this object
+    PhaseTimes& operator+=(const PhaseTimes& other) {
+        parse += other.parse;
+        resolve += other.resolve;
+        transform += other.transform;
+        generate += other.generate;
+        for (auto& [name, totals] : other.transforms) {
+            transforms[name] += totals;
+        }
+        return *this;
+    }
+};
+
+/// Accumulates the statistics of the transforms that were run into `times`.
+/// @param statistics the statistics of each transform that was run
+/// @param times the times to add the statistics to
+void RecordTransformStatistics(
+    const std::vector<tint::transform::Manager::TransformStatistics>& statistics,
+    PhaseTimes& times) {
+    for (auto& transform : statistics) {
+        auto& totals = times.transforms[transform.type->name];
+        totals.runs++;
+        totals.skipped += transform.skipped ? 1 : 0;
+        totals.duration += transform.duration;
+        totals.ast_node_count += transform.ast_node_count;
+        totals.sem_node_count += transform.sem_node_count;
+        totals.allocated_bytes += transform.allocated_bytes;
+    }
+}
+
 /// Generate SPIR-V code for a program.
 /// @param program the program to generate
 /// @param options the options that Tint was invoked with
+/// @param err the stream to write errors to
+/// @param times the times to add the statistics of the writer's transforms to
 /// @returns true on success
-bool GenerateSpirv(const tint::Program* program, const Options& options) {
+bool GenerateSpirv(const tint::Program* program,
+                   const Options& options,
+                   std::ostream& err,
+                   PhaseTimes& times) {
 #if TINT_BUILD_SPV_WRITER
     // TODO(jrprice): Provide a way for the user to set non-default options.
     tint::writer::spirv::Options gen_options;
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.generate_external_texture_bindings = true;
+    gen_options.collect_transform_statistics = options.time_passes;
     auto result = tint::writer::spirv::Generate(program, gen_options);
+    RecordTransformStatistics(result.transform_statistics, times);
     if (!result.success) {
-        PrintWGSL(std::cerr, *program);
-        std::cerr << "Failed to generate: " << result.error << std::endl;
+        PrintWGSL(err, *program);
+        err << "Failed to generate: " << result.error << std::endl;
         return false;
     }
 
     if (options.format == Format::kSpvAsm) {
-        if (!WriteFile(options.output_file, "w", Disassemble(result.spirv))) {
+        if (!WriteFile(options.output_file, "w", Disassemble(result.spirv, err), err)) {
             return false;
         }
     } else {
-        if (!WriteFile(options.output_file, "wb", result.spirv)) {
+        if (!WriteFile(options.output_file, "wb", result.spirv, err)) {
             return false;
         }
     }
@@ -667,8 +824,8 @@ bool GenerateSpirv(const tint::Program* program, const Options& options) {
         // Use Vulkan 1.1, since this is what Tint, internally, uses.
         spvtools::SpirvTools tools(SPV_ENV_VULKAN_1_1);
         tools.SetMessageConsumer(
-            [](spv_message_level_t, const char*, const spv_position_t& pos, const char* msg) {
-                std::cerr << (pos.line + 1) << ":" << (pos.column + 1) << ": " << msg << std::endl;
+            [&err](spv_message_level_t, const char*, const spv_position_t& pos, const char* msg) {
+                err << (pos.line + 1) << ":" << (pos.column + 1) << ": " << msg << std::endl;
             });
         if (!tools.Validate(result.spirv.data(), result.spirv.size(),
                             spvtools::ValidatorOptions())) {
@@ -680,7 +837,8 @@ bool GenerateSpirv(const tint::Program* program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "SPIR-V writer not enabled in tint build" << std::endl;
+    (void)times;
+    err << "SPIR-V writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_SPV_WRITER
 }
@@ -688,18 +846,19 @@ bool GenerateSpirv(const tint::Program* program, const Options& options) {
 /// Generate WGSL code for a program.
 /// @param program the program to generate
 /// @param options the options that Tint was invoked with
+/// @param err the stream to write errors to
 /// @returns true on success
-bool GenerateWgsl(const tint::Program* program, const Options& options) {
+bool GenerateWgsl(const tint::Program* program, const Options& options, std::ostream& err) {
 #if TINT_BUILD_WGSL_WRITER
     // TODO(jrprice): Provide a way for the user to set non-default options.
     tint::writer::wgsl::Options gen_options;
     auto result = tint::writer::wgsl::Generate(program, gen_options);
     if (!result.success) {
-        std::cerr << "Failed to generate: " << result.error << std::endl;
+        err << "Failed to generate: " << result.error << std::endl;
         return false;
     }
 
-    if (!WriteFile(options.output_file, "w", result.wgsl)) {
+    if (!WriteFile(options.output_file, "w", result.wgsl, err)) {
         return false;
     }
 
@@ -708,9 +867,7 @@ bool GenerateWgsl(const tint::Program* program, const Options& options) {
         auto source = std::make_unique<tint::Source::File>(options.input_filename, result.wgsl);
         auto reparsed_program = tint::reader::wgsl::Parse(source.get());
         if (!reparsed_program.IsValid()) {
-            auto diag_printer = tint::diag::Printer::create(stderr, true);
-            tint::diag::Formatter diag_formatter;
-            diag_formatter.format(reparsed_program.Diagnostics(), diag_printer.get());
+            PrintDiagnostics(reparsed_program.Diagnostics(), err);
             return false;
         }
     }
@@ -719,7 +876,7 @@ bool GenerateWgsl(const tint::Program* program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "WGSL writer not enabled in tint build" << std::endl;
+    err << "WGSL writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_WGSL_WRITER
 }
@@ -727,8 +884,13 @@ bool GenerateWgsl(const tint::Program* program, const Options& options) {
 /// Generate MSL code for a program.
 /// @param program the program to generate
 /// @param options the options that Tint was invoked with
+/// @param err the stream to write errors to
+/// @param times the times to add the statistics of the writer's transforms to
 /// @returns true on success
-bool GenerateMsl(const tint::Program* program, const Options& options) {
+bool GenerateMsl(const tint::Program* program,
+                 const Options& options,
+                 std::ostream& err,
+                 PhaseTimes& times) {
 #if TINT_BUILD_MSL_WRITER
     // Remap resource numbers to a flat namespace.
     // TODO(crbug.com/tint/1501): Do this via Options::BindingMap.
@@ -742,14 +904,16 @@ bool GenerateMsl(const tint::Program* program, const Options& options) {
     tint::writer::msl::Options gen_options;
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.generate_external_texture_bindings = true;
+    gen_options.collect_transform_statistics = options.time_passes;
     auto result = tint::writer::msl::Generate(input_program, gen_options);
+    RecordTransformStatistics(result.transform_statistics, times);
     if (!result.success) {
-        PrintWGSL(std::cerr, *program);
-        std::cerr << "Failed to generate: " << result.error << std::endl;
+        PrintWGSL(err, *program);
+        err << "Failed to generate: " << result.error << std::endl;
         return false;
     }
 
-    if (!WriteFile(options.output_file, "w", result.msl)) {
+    if (!WriteFile(options.output_file, "w", result.msl, err)) {
         return false;
     }
 
@@ -773,7 +937,7 @@ bool GenerateMsl(const tint::Program* program, const Options& options) {
         }
 #endif  // TINT_ENABLE_MSL_VALIDATION_USING_METAL_API
         if (res.failed) {
-            std::cerr << res.output << std::endl;
+            err << res.output << std::endl;
             return false;
         }
     }
@@ -782,7 +946,8 @@ bool GenerateMsl(const tint::Program* program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "MSL writer not enabled in tint build" << std::endl;
+    (void)times;
+    err << "MSL writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_MSL_WRITER
 }
@@ -790,22 +955,31 @@ bool GenerateMsl(const tint::Program* program, const Options& options) {
 /// Generate HLSL code for a program.
 /// @param program the program to generate
 /// @param options the options that Tint was invoked with
+/// @param out the stream to write the validation output to, in verbose mode
+/// @param err the stream to write errors to
+/// @param times the times to add the statistics of the writer's transforms to
 /// @returns true on success
-bool GenerateHlsl(const tint::Program* program, const Options& options) {
+bool GenerateHlsl(const tint::Program* program,
+                  const Options& options,
+                  std::ostream& out,
+                  std::ostream& err,
+                  PhaseTimes& times) {
 #if TINT_BUILD_HLSL_WRITER
     // TODO(jrprice): Provide a way for the user to set non-default options.
     tint::writer::hlsl::Options gen_options;
     gen_options.disable_workgroup_init = options.disable_workgroup_init;
     gen_options.generate_external_texture_bindings = true;
+    gen_options.collect_transform_statistics = options.time_passes;
     gen_options.root_constant_binding_point = options.hlsl_root_constant_binding_point;
     auto result = tint::writer::hlsl::Generate(program, gen_options);
+    RecordTransformStatistics(result.transform_statistics, times);
     if (!result.success) {
-        PrintWGSL(std::cerr, *program);
-        std::cerr << "Failed to generate: " << result.error << std::endl;
+        PrintWGSL(err, *program);
+        err << "Failed to generate: " << result.error << std::endl;
         return false;
     }
 
-    if (!WriteFile(options.output_file, "w", result.hlsl)) {
+    if (!WriteFile(options.output_file, "w", result.hlsl, err)) {
         return false;
     }
 
@@ -865,28 +1039,28 @@ bool GenerateHlsl(const tint::Program* program, const Options& options) {
         }
 
         if (fxc_res.failed) {
-            std::cerr << "FXC validation failure:" << std::endl << fxc_res.output << std::endl;
+            err << "FXC validation failure:" << std::endl << fxc_res.output << std::endl;
         }
         if (dxc_res.failed) {
-            std::cerr << "DXC validation failure:" << std::endl << dxc_res.output << std::endl;
+            err << "DXC validation failure:" << std::endl << dxc_res.output << std::endl;
         }
         if (fxc_res.failed || dxc_res.failed) {
             return false;
         }
         if (!fxc_found && !dxc_found) {
-            std::cerr << "Couldn't find FXC or DXC. Cannot validate" << std::endl;
+            err << "Couldn't find FXC or DXC. Cannot validate" << std::endl;
             return false;
         }
         if (options.verbose) {
             if (fxc_found && !fxc_res.failed) {
-                std::cout << "Passed FXC validation" << std::endl;
-                std::cout << fxc_res.output;
-                std::cout << std::endl;
+                out << "Passed FXC validation" << std::endl;
+                out << fxc_res.output;
+                out << std::endl;
             }
             if (dxc_found && !dxc_res.failed) {
-                std::cout << "Passed DXC validation" << std::endl;
-                std::cout << dxc_res.output;
-                std::cout << std::endl;
+                out << "Passed DXC validation" << std::endl;
+                out << dxc_res.output;
+                out << std::endl;
             }
         }
     }
@@ -895,7 +1069,9 @@ bool GenerateHlsl(const tint::Program* program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "HLSL writer not enabled in tint build" << std::endl;
+    (void)out;
+    (void)times;
+    err << "HLSL writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_HLSL_WRITER
 }
@@ -919,24 +1095,27 @@ EShLanguage pipeline_stage_to_esh_language(tint::ast::PipelineStage stage) {
 /// Generate GLSL code for a program.
 /// @param program the program to generate
 /// @param options the options that Tint was invoked with
+/// @param err the stream to write errors to
+/// @param times the times to add the statistics of the writer's transforms to
 /// @returns true on success
-bool GenerateGlsl(const tint::Program* program, const Options& options) {
+bool GenerateGlsl(const tint::Program* program,
+                  const Options& options,
+                  std::ostream& err,
+                  PhaseTimes& times) {
 #if TINT_BUILD_GLSL_WRITER
-    if (options.validate) {
-        glslang::InitializeProcess();
-    }
-
     auto generate = [&](const tint::Program* prg, const std::string entry_point_name) -> bool {
         tint::writer::glsl::Options gen_options;
         gen_options.generate_external_texture_bindings = true;
+        gen_options.collect_transform_statistics = options.time_passes;
         auto result = tint::writer::glsl::Generate(prg, gen_options, entry_point_name);
+        RecordTransformStatistics(result.transform_statistics, times);
         if (!result.success) {
-            PrintWGSL(std::cerr, *prg);
-            std::cerr << "Failed to generate: " << result.error << std::endl;
+            PrintWGSL(err, *prg);
+            err << "Failed to generate: " << result.error << std::endl;
             return false;
         }
 
-        if (!WriteFile(options.output_file, "w", result.glsl)) {
+        if (!WriteFile(options.output_file, "w", result.glsl, err)) {
             return false;
         }
 
@@ -951,9 +1130,9 @@ bool GenerateGlsl(const tint::Program* program, const Options& options) {
                 bool glslang_result = shader.parse(&glslang::DefaultTBuiltInResource, 310,
                                                    EEsProfile, false, false, EShMsgDefault);
                 if (!glslang_result) {
-                    std::cerr << "Error parsing GLSL shader:\n"
-                              << shader.getInfoLog() << "\n"
-                              << shader.getInfoDebugLog() << "\n";
+                    err << "Error parsing GLSL shader:\n"
+                        << shader.getInfoLog() << "\n"
+                        << shader.getInfoDebugLog() << "\n";
                     return false;
                 }
             }
@@ -977,130 +1156,93 @@ bool GenerateGlsl(const tint::Program* program, const Options& options) {
 #else
     (void)program;
     (void)options;
-    std::cerr << "GLSL writer not enabled in tint build" << std::endl;
+    (void)times;
+    err << "GLSL writer not enabled in tint build" << std::endl;
     return false;
 #endif  // TINT_BUILD_GLSL_WRITER
 }
 
-}  // namespace
-
-int main(int argc, const char** argv) {
-    std::vector<std::string> args(argv, argv + argc);
-    Options options;
-
-    tint::SetInternalCompilerErrorReporter(&TintInternalCompilerErrorReporter);
-
-#if TINT_BUILD_WGSL_WRITER
-    tint::Program::printer = [](const tint::Program* program) {
-        auto result = tint::writer::wgsl::Generate(program, {});
-        if (!result.error.empty()) {
-            return "error: " + result.error;
-        }
-        return result.wgsl;
-    };
-#endif  // TINT_BUILD_WGSL_WRITER
+struct TransformFactory {
+    const char* name;
+    /// Build and adds the transform to the transform manager.
+    /// Parameters:
+    ///   inspector - an inspector created from the parsed program
+    ///   manager   - the transform manager. Add transforms to this.
+    ///   inputs    - the input data to the transform manager. Add inputs to this.
+    ///   err       - the stream that errors are written to
+    /// Returns true on success, false on error (program will immediately exit)
+    std::function<bool(tint::inspector::Inspector& inspector,
+                       tint::transform::Manager& manager,
+                       tint::transform::DataMap& inputs,
+                       std::ostream& err)>
+        make;
+};
 
-    if (!ParseArgs(args, &options)) {
-        std::cerr << "Failed to parse arguments." << std::endl;
-        return 1;
+/// @param transforms the list of available transforms
+/// @returns the names of the transforms, one per line
+std::string TransformNames(const std::vector<TransformFactory>& transforms) {
+    std::stringstream names;
+    for (auto& t : transforms) {
+        names << "   " << t.name << std::endl;
     }
+    return names.str();
+}
 
-    struct TransformFactory {
-        const char* name;
-        /// Build and adds the transform to the transform manager.
-        /// Parameters:
-        ///   inspector - an inspector created from the parsed program
-        ///   manager   - the transform manager. Add transforms to this.
-        ///   inputs    - the input data to the transform manager. Add inputs to this.
-        /// Returns true on success, false on error (program will immediately exit)
-        std::function<bool(tint::inspector::Inspector& inspector,
-                           tint::transform::Manager& manager,
-                           tint::transform::DataMap& inputs)>
-            make;
-    };
-    std::vector<TransformFactory> transforms = {
-        {"first_index_offset",
-         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap& i) {
-             i.Add<tint::transform::FirstIndexOffset::BindingPoint>(0, 0);
-             m.Add<tint::transform::FirstIndexOffset>();
-             return true;
-         }},
-        {"fold_trivial_single_use_lets",
-         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap&) {
-             m.Add<tint::transform::FoldTrivialSingleUseLets>();
-             return true;
-         }},
-        {"renamer",
-         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap&) {
-             m.Add<tint::transform::Renamer>();
-             return true;
-         }},
-        {"robustness",
-         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap&) {
-             m.Add<tint::transform::Robustness>();
-             return true;
-         }},
-        {"substitute_override",
-         [&](tint::inspector::Inspector& inspector, tint::transform::Manager& m,
-             tint::transform::DataMap& i) {
-             tint::transform::SubstituteOverride::Config cfg;
-
-             std::unordered_map<tint::OverrideId, double> values;
-             values.reserve(options.overrides.size());
-
-             for (const auto& [name, value] : options.overrides) {
-                 if (name.empty()) {
-                     std::cerr << "empty override name";
-                     return false;
-                 }
-                 if (isdigit(name[0])) {
-                     tint::OverrideId id{
-                         static_cast<decltype(tint::OverrideId::value)>(atoi(name.c_str()))};
-                     values.emplace(id, value);
-                 } else {
-                     auto override_names = inspector.GetNamedOverrideIds();
-                     auto it = override_names.find(name);
-                     if (it == override_names.end()) {
-                         std::cerr << "unknown override '" << name << "'";
-                         return false;
-                     }
-                     values.emplace(it->second, value);
-                 }
-             }
-
-             cfg.map = std::move(values);
-
-             i.Add<tint::transform::SubstituteOverride::Config>(cfg);
-             m.Add<tint::transform::SubstituteOverride>();
-             return true;
-         }},
-    };
-    auto transform_names = [&] {
-        std::stringstream names;
-        for (auto& t : transforms) {
-            names << "   " << t.name << std::endl;
-        }
-        return names.str();
-    };
+/// Prints the time spent in each phase to `out`, on a single line.
+/// @param out the stream to print the times to
+/// @param times the times to print
+void PrintPhaseTimes(std::ostream& out, const PhaseTimes& times) {
+    out << std::fixed << std::setprecision(3) << "parse: " << times.parse.count()
+        << " ms, resolve: " << times.resolve.count()
+        << " ms, transform: " << times.transform.count()
+        << " ms, generate: " << times.generate.count() << " ms, total: " << times.Total().count()
+        << " ms" << std::endl;
+}
 
-    if (options.show_help) {
-        std::string usage = tint::utils::ReplaceAll(kUsage, "${transforms}", transform_names());
-        std::cout << usage << std::endl;
-        return 0;
+/// Prints the statistics of each transform in `times` to `out`, one transform per line, ordered
+/// by decreasing time.
+/// @param out the stream to print the statistics to
+/// @param times the times holding the statistics of each transform
+void PrintTransformStatistics(std::ostream& out, const PhaseTimes& times) {
+    std::vector<std::pair<std::string, TransformTotals>> sorted(times.transforms.begin(),
+                                                                 times.transforms.end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.duration > b.second.duration;
+    });
+
+    out << "Time per transform:" << std::endl;
+    for (auto& [name, totals] : sorted) {
+        out << "  " << name << ": " << std::fixed << std::setprecision(3)
+            << totals.duration.count() << " ms, " << totals.runs << " runs (" << totals.skipped
+            << " without changes), " << totals.ast_node_count << " AST nodes, "
+            << totals.sem_node_count << " semantic nodes, " << totals.allocated_bytes << " bytes"
+            << std::endl;
     }
+}
 
-    // Implement output format defaults.
-    if (options.format == Format::kNone) {
-        // Try inferring from filename.
-        options.format = infer_format(options.output_file);
-    }
-    if (options.format == Format::kNone) {
-        // Ultimately, default to SPIR-V assembly. That's nice for interactive use.
-        options.format = Format::kSpvAsm;
-    }
+/// Prints the number of nodes and the memory allocated for `program` to `out`, on a single line.
+/// @param out the stream to print the statistics to
+/// @param program the program
+void PrintProgramStatistics(std::ostream& out, const tint::Program& program) {
+    out << program.ASTNodes().Count() << " AST nodes, " << program.SemNodes().Count()
+        << " semantic nodes, "
+        << program.ASTNodes().AllocatedBytes() + program.SemNodes().AllocatedBytes() << " bytes"
+        << std::endl;
+}
 
-    auto diag_printer = tint::diag::Printer::create(stderr, true);
-    tint::diag::Formatter diag_formatter;
+/// Compiles the file `options.input_filename` to `options.output_file`.
+/// @param options the options that Tint was invoked with
+/// @param transforms the list of available transforms
+/// @param out the stream to write the output that isn't written to the output file to
+/// @param err the stream to write diagnostics and errors to
+/// @param times the time spent in each phase of the compilation
+/// @returns true on success
+bool Compile(const Options& options,
+             const std::vector<TransformFactory>& transforms,
+             std::ostream& out,
+             std::ostream& err,
+             PhaseTimes& times) {
+    using Clock = std::chrono::steady_clock;
 
     std::unique_ptr<tint::Program> program;
     std::unique_ptr<tint::Source::File> source_file;
@@ -1124,128 +1266,142 @@ int main(int argc, const char** argv) {
         input_format = InputFormat::kSpirvAsm;
     }
 
+    auto start = Clock::now();
     switch (input_format) {
         case InputFormat::kUnknown: {
-            std::cerr << "Unknown input format" << std::endl;
-            return 1;
+            err << "Unknown input format" << std::endl;
+            return false;
         }
         case InputFormat::kWgsl: {
 #if TINT_BUILD_WGSL_READER
             std::vector<uint8_t> data;
-            if (!ReadFile<uint8_t>(options.input_filename, &data)) {
-                return 1;
+            if (!ReadFile<uint8_t>(options.input_filename, &data, err)) {
+                return false;
             }
             source_file = std::make_unique<tint::Source::File>(
                 options.input_filename, std::string(data.begin(), data.end()));
-            program = std::make_unique<tint::Program>(tint::reader::wgsl::Parse(source_file.get()));
+
+            // Parse and resolve separately so that the time spent in each phase can be reported.
+            tint::reader::wgsl::ParserImpl parser(source_file.get());
+            parser.Parse();
+            auto parsed = Clock::now();
+            times.parse = parsed - start;
+            program = std::make_unique<tint::Program>(std::move(parser.builder()));
+            times.resolve = Clock::now() - parsed;
             break;
 #else
-            std::cerr << "Tint not built with the WGSL reader enabled" << std::endl;
-            return 1;
+            err << "Tint not built with the WGSL reader enabled" << std::endl;
+            return false;
 #endif  // TINT_BUILD_WGSL_READER
         }
         case InputFormat::kSpirvBin: {
 #if TINT_BUILD_SPV_READER
             std::vector<uint32_t> data;
-            if (!ReadFile<uint32_t>(options.input_filename, &data)) {
-                return 1;
+            if (!ReadFile<uint32_t>(options.input_filename, &data, err)) {
+                return false;
             }
             program = std::make_unique<tint::Program>(tint::reader::spirv::Parse(data));
+            times.parse = Clock::now() - start;
             break;
 #else
-            std::cerr << "Tint not built with the SPIR-V reader enabled" << std::endl;
-            return 1;
+            err << "Tint not built with the SPIR-V reader enabled" << std::endl;
+            return false;
 #endif  // TINT_BUILD_SPV_READER
         }
         case InputFormat::kSpirvAsm: {
 #if TINT_BUILD_SPV_READER
             std::vector<char> text;
-            if (!ReadFile<char>(options.input_filename, &text)) {
-                return 1;
+            if (!ReadFile<char>(options.input_filename, &text, err)) {
+                return false;
             }
             // Use Vulkan 1.1, since this is what Tint, internally, is expecting.
             spvtools::SpirvTools tools(SPV_ENV_VULKAN_1_1);
-            tools.SetMessageConsumer([](spv_message_level_t, const char*, const spv_position_t& pos,
-                                        const char* msg) {
-                std::cerr << (pos.line + 1) << ":" << (pos.column + 1) << ": " << msg << std::endl;
+            tools.SetMessageConsumer([&err](spv_message_level_t, const char*,
+                                            const spv_position_t& pos, const char* msg) {
+                err << (pos.line + 1) << ":" << (pos.column + 1) << ": " << msg << std::endl;
             });
             std::vector<uint32_t> data;
             if (!tools.Assemble(text.data(), text.size(), &data,
                                 SPV_TEXT_TO_BINARY_OPTION_PRESERVE_NUMERIC_IDS)) {
-                return 1;
+                return false;
             }
             program = std::make_unique<tint::Program>(tint::reader::spirv::Parse(data));
+            times.parse = Clock::now() - start;
             break;
 #else
-            std::cerr << "Tint not built with the SPIR-V reader enabled" << std::endl;
-            return 1;
+            err << "Tint not built with the SPIR-V reader enabled" << std::endl;
+            return false;
 #endif  // TINT_BUILD_SPV_READER
         }
     }
 
     if (!program) {
-        std::cerr << "Failed to parse input file: " << options.input_filename << std::endl;
-        return 1;
+        err << "Failed to parse input file: " << options.input_filename << std::endl;
+        return false;
     }
     if (program->Diagnostics().count() > 0) {
         if (!program->IsValid() && input_format != InputFormat::kWgsl) {
             // Invalid program from a non-wgsl source. Print the WGSL, to help
             // understand the diagnostics.
-            PrintWGSL(std::cout, *program);
+            PrintWGSL(out, *program);
         }
-        diag_formatter.format(program->Diagnostics(), diag_printer.get());
+        PrintDiagnostics(program->Diagnostics(), err);
     }
 
     if (!program->IsValid()) {
-        return 1;
+        return false;
+    }
+    if (options.time_passes) {
+        out << options.input_filename << ": ";
+        PrintProgramStatistics(out, *program);
     }
     if (options.parse_only) {
-        return 1;
+        return true;
     }
 
     tint::inspector::Inspector inspector(program.get());
 
     if (options.dump_inspector_bindings) {
-        std::cout << std::string(80, '-') << std::endl;
+        out << std::string(80, '-') << std::endl;
         auto entry_points = inspector.GetEntryPoints();
         if (!inspector.error().empty()) {
-            std::cerr << "Failed to get entry points from Inspector: " << inspector.error()
-                      << std::endl;
-            return 1;
+            err << "Failed to get entry points from Inspector: " << inspector.error()
+                << std::endl;
+            return false;
         }
 
         for (auto& entry_point : entry_points) {
             auto bindings = inspector.GetResourceBindings(entry_point.name);
             if (!inspector.error().empty()) {
-                std::cerr << "Failed to get bindings from Inspector: " << inspector.error()
-                          << std::endl;
-                return 1;
+                err << "Failed to get bindings from Inspector: " << inspector.error()
+                    << std::endl;
+                return false;
             }
-            std::cout << "Entry Point = " << entry_point.name << std::endl;
+            out << "Entry Point = " << entry_point.name << std::endl;
             for (auto& binding : bindings) {
-                std::cout << "\t[" << binding.bind_group << "][" << binding.binding
-                          << "]:" << std::endl;
-                std::cout << "\t\t resource_type = " << ResourceTypeToString(binding.resource_type)
-                          << std::endl;
-                std::cout << "\t\t dim = " << TextureDimensionToString(binding.dim) << std::endl;
-                std::cout << "\t\t sampled_kind = " << SampledKindToString(binding.sampled_kind)
-                          << std::endl;
-                std::cout << "\t\t image_format = " << TexelFormatToString(binding.image_format)
-                          << std::endl;
+                out << "\t[" << binding.bind_group << "][" << binding.binding << "]:" << std::endl;
+                out << "\t\t resource_type = " << ResourceTypeToString(binding.resource_type)
+                    << std::endl;
+                out << "\t\t dim = " << TextureDimensionToString(binding.dim) << std::endl;
+                out << "\t\t sampled_kind = " << SampledKindToString(binding.sampled_kind)
+                    << std::endl;
+                out << "\t\t image_format = " << TexelFormatToString(binding.image_format)
+                    << std::endl;
             }
         }
-        std::cout << std::string(80, '-') << std::endl;
+        out << std::string(80, '-') << std::endl;
     }
 
     tint::transform::Manager transform_manager;
     tint::transform::DataMap transform_inputs;
+    transform_inputs.Add<tint::transform::Manager::Config>(options.time_passes);
 
     // If overrides are provided, add the SubstituteOverride transform.
     if (!options.overrides.empty()) {
         for (auto& t : transforms) {
             if (t.name == std::string("substitute_override")) {
-                if (!t.make(inspector, transform_manager, transform_inputs)) {
-                    return 1;
+                if (!t.make(inspector, transform_manager, transform_inputs, err)) {
+                    return false;
                 }
                 break;
             }
@@ -1260,17 +1416,17 @@ int main(int argc, const char** argv) {
         bool found = false;
         for (auto& t : transforms) {
             if (t.name == name) {
-                if (!t.make(inspector, transform_manager, transform_inputs)) {
-                    return 1;
+                if (!t.make(inspector, transform_manager, transform_inputs, err)) {
+                    return false;
                 }
                 found = true;
                 break;
             }
         }
         if (!found) {
-            std::cerr << "Unknown transform: " << name << std::endl;
-            std::cerr << "Available transforms: " << std::endl << transform_names();
-            return 1;
+            err << "Unknown transform: " << name << std::endl;
+            err << "Available transforms: " << std::endl << TransformNames(transforms);
+            return false;
         }
     }
 
@@ -1307,38 +1463,348 @@ int main(int argc, const char** argv) {
             break;
     }
 
-    auto out = transform_manager.Run(program.get(), std::move(transform_inputs));
-    if (!out.program.IsValid()) {
-        PrintWGSL(std::cerr, out.program);
-        diag_formatter.format(out.program.Diagnostics(), diag_printer.get());
-        return 1;
+    start = Clock::now();
+    auto transformed = transform_manager.Run(program.get(), std::move(transform_inputs));
+    times.transform = Clock::now() - start;
+    if (auto* statistics = transformed.data.Get<tint::transform::Manager::Statistics>()) {
+        RecordTransformStatistics(statistics->transforms, times);
+    }
+    if (!transformed.program.IsValid()) {
+        PrintWGSL(err, transformed.program);
+        PrintDiagnostics(transformed.program.Diagnostics(), err);
+        return false;
     }
 
-    *program = std::move(out.program);
+    *program = std::move(transformed.program);
 
+    start = Clock::now();
     bool success = false;
     switch (options.format) {
         case Format::kSpirv:
         case Format::kSpvAsm:
-            success = GenerateSpirv(program.get(), options);
+            success = GenerateSpirv(program.get(), options, err, times);
             break;
         case Format::kWgsl:
-            success = GenerateWgsl(program.get(), options);
+            success = GenerateWgsl(program.get(), options, err);
             break;
         case Format::kMsl:
-            success = GenerateMsl(program.get(), options);
+            success = GenerateMsl(program.get(), options, err, times);
             break;
         case Format::kHlsl:
-            success = GenerateHlsl(program.get(), options);
+            success = GenerateHlsl(program.get(), options, out, err, times);
             break;
         case Format::kGlsl:
-            success = GenerateGlsl(program.get(), options);
+            success = GenerateGlsl(program.get(), options, err, times);
             break;
         default:
-            std::cerr << "Unknown output format specified" << std::endl;
-            return 1;
+            err << "Unknown output format specified" << std::endl;
+            return false;
+    }
+    times.generate = Clock::now() - start;
+    return success;
+}
+
+/// @param format the output format
+/// @returns the file extension of output files of the given format
+std::string FormatExtension(Format format) {
+    switch (format) {
+        case Format::kSpirv:
+            return ".spv";
+        case Format::kSpvAsm:
+            return ".spvasm";
+        case Format::kWgsl:
+            return ".wgsl";
+        case Format::kMsl:
+            return ".metal";
+        case Format::kHlsl:
+            return ".hlsl";
+        case Format::kGlsl:
+            return ".glsl";
+        case Format::kNone:
+            break;
+    }
+    return "";
+}
+
+/// @param input_filename the name of an input file compiled in batch mode
+/// @param options the options that Tint was invoked with
+/// @returns the name of the output file for `input_filename`: the input file name with its
+/// extension replaced by the extension of the output format, in the output directory if one was
+/// specified and in the directory of the input file otherwise.
+std::string BatchOutputFilename(const std::string& input_filename, const Options& options) {
+    auto slash = input_filename.find_last_of("/\\");
+    auto basename_start = (slash == std::string::npos) ? 0 : slash + 1;
+    std::string dir = input_filename.substr(0, basename_start);
+    std::string stem = input_filename.substr(basename_start);
+    auto dot = stem.rfind('.');
+    if (dot != std::string::npos && dot > 0) {
+        stem = stem.substr(0, dot);
+    }
+
+    if (!options.output_dir.empty()) {
+        dir = options.output_dir;
+        if (dir.back() != '/' && dir.back() != '\\') {
+            dir += '/';
+        }
+    }
+    return dir + stem + FormatExtension(options.format);
+}
+
+/// Appends the input file names listed in the manifest file `manifest` to
+/// `options->input_filenames`. The manifest contains one file name per line. Empty lines and lines
+/// starting with '#' are ignored.
+/// @param manifest the name of the manifest file
+/// @param options the options to add the input file names to
+/// @returns true on success
+bool ReadManifest(const std::string& manifest, Options* options) {
+    std::ifstream file(manifest);
+    if (!file) {
+        std::cerr << "Failed to open manifest " << manifest << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+            line.pop_back();
+        }
+        if (!line.empty() && line[0] != '#') {
+            options->input_filenames.push_back(line);
+        }
+    }
+    return true;
+}
+
+/// Compiles all of `options.input_filenames` concurrently, writing each output to the file named
+/// by BatchOutputFilename(). The diagnostics of each file are printed once all the files have
+/// been compiled, in the order of the input files, followed by the time spent in each phase and,
+/// with --time-passes, in each transform.
+/// @param options the options that Tint was invoked with
+/// @param transforms the list of available transforms
+/// @returns true if all the files were compiled successfully
+bool CompileBatch(const Options& options, const std::vector<TransformFactory>& transforms) {
+    struct Job {
+        Options options;
+        bool success = false;
+        std::stringstream out;
+        std::stringstream err;
+        PhaseTimes times;
+    };
+
+    // The options of each job only name its own input file, so the list of input files isn't
+    // copied into every job.
+    Options job_options = options;
+    job_options.input_filenames.clear();
+    job_options.manifest.clear();
+
+    std::vector<Job> jobs(options.input_filenames.size());
+    std::unordered_map<std::string, std::string> input_for_output;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        Job& job = jobs[i];
+        job.options = job_options;
+        job.options.input_filename = options.input_filenames[i];
+        job.options.output_file = BatchOutputFilename(job.options.input_filename, options);
+
+        if (job.options.output_file == job.options.input_filename) {
+            std::cerr << "Output file for " << job.options.input_filename
+                      << " would overwrite the input file. Use --output-dir to choose another "
+                      << "directory." << std::endl;
+            return false;
+        }
+        auto [it, inserted] =
+            input_for_output.emplace(job.options.output_file, job.options.input_filename);
+        if (!inserted) {
+            std::cerr << "Input files " << it->second << " and " << job.options.input_filename
+                      << " both output to " << it->first << std::endl;
+            return false;
+        }
+    }
+
+    // Create the output directory before the jobs start writing to it.
+    if (!options.output_dir.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(options.output_dir, error);
+        if (error) {
+            std::cerr << "Failed to create output directory " << options.output_dir << ": "
+                      << error.message() << std::endl;
+            return false;
+        }
+    }
+
+    size_t num_threads = tint::utils::ParallelForWorkerCount(jobs.size(), options.jobs);
+
+    auto start = std::chrono::steady_clock::now();
+
+    tint::utils::ParallelFor(jobs.size(), options.jobs, [&](size_t i, size_t) {
+        Job& job = jobs[i];
+        job.success = Compile(job.options, transforms, job.out, job.err, job.times);
+    });
+
+    PhaseTimes::Duration elapsed = std::chrono::steady_clock::now() - start;
+
+    size_t num_failed = 0;
+    PhaseTimes total_times;
+    for (auto& job : jobs) {
+        std::cout << job.out.str();
+        std::cerr << job.err.str();
+        if (!job.success) {
+            std::cerr << "Failed to compile " << job.options.input_filename << std::endl;
+            num_failed++;
+        }
+        if (options.verbose) {
+            std::cout << job.options.input_filename << ": ";
+            PrintPhaseTimes(std::cout, job.times);
+        }
+        total_times += job.times;
+    }
+
+    std::cout << "Compiled " << jobs.size() << " files (" << num_failed << " failed) in "
+              << std::fixed << std::setprecision(3) << elapsed.count() << " ms on " << num_threads
+              << " threads" << std::endl;
+    std::cout << "Total time per phase: ";
+    PrintPhaseTimes(std::cout, total_times);
+    if (options.time_passes) {
+        PrintTransformStatistics(std::cout, total_times);
+    }
+
+    return num_failed == 0;
+}
+
+}  // namespace
+
+int main(int argc, const char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    Options options;
+
+    tint::SetInternalCompilerErrorReporter(&TintInternalCompilerErrorReporter);
+
+#if TINT_BUILD_WGSL_WRITER
+    tint::Program::printer = [](const tint::Program* program) {
+        auto result = tint::writer::wgsl::Generate(program, {});
+        if (!result.error.empty()) {
+            return "error: " + result.error;
+        }
+        return result.wgsl;
+    };
+#endif  // TINT_BUILD_WGSL_WRITER
+
+    if (!ParseArgs(args, &options)) {
+        std::cerr << "Failed to parse arguments." << std::endl;
+        return 1;
+    }
+
+    std::vector<TransformFactory> transforms = {
+        {"first_index_offset",
+         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap& i,
+            std::ostream&) {
+             i.Add<tint::transform::FirstIndexOffset::BindingPoint>(0, 0);
+             m.Add<tint::transform::FirstIndexOffset>();
+             return true;
+         }},
+        {"fold_trivial_single_use_lets",
+         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap&,
+            std::ostream&) {
+             m.Add<tint::transform::FoldTrivialSingleUseLets>();
+             return true;
+         }},
+        {"renamer",
+         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap&,
+            std::ostream&) {
+             m.Add<tint::transform::Renamer>();
+             return true;
+         }},
+        {"robustness",
+         [](tint::inspector::Inspector&, tint::transform::Manager& m, tint::transform::DataMap&,
+            std::ostream&) {
+             m.Add<tint::transform::Robustness>();
+             return true;
+         }},
+        {"substitute_override",
+         [&](tint::inspector::Inspector& inspector, tint::transform::Manager& m,
+             tint::transform::DataMap& i, std::ostream& err) {
+             tint::transform::SubstituteOverride::Config cfg;
+
+             std::unordered_map<tint::OverrideId, double> values;
+             values.reserve(options.overrides.size());
+
+             for (const auto& [name, value] : options.overrides) {
+                 if (name.empty()) {
+                     err << "empty override name" << std::endl;
+                     return false;
+                 }
+                 if (isdigit(name[0])) {
+                     tint::OverrideId id{
+                         static_cast<decltype(tint::OverrideId::value)>(atoi(name.c_str()))};
+                     values.emplace(id, value);
+                 } else {
+                     auto override_names = inspector.GetNamedOverrideIds();
+                     auto it = override_names.find(name);
+                     if (it == override_names.end()) {
+                         err << "unknown override '" << name << "'" << std::endl;
+                         return false;
+                     }
+                     values.emplace(it->second, value);
+                 }
+             }
+
+             cfg.map = std::move(values);
+
+             i.Add<tint::transform::SubstituteOverride::Config>(cfg);
+             m.Add<tint::transform::SubstituteOverride>();
+             return true;
+         }},
+    };
+
+    if (options.show_help) {
+        std::string usage =
+            tint::utils::ReplaceAll(kUsage, "${transforms}", TransformNames(transforms));
+        std::cout << usage << std::endl;
+        return 0;
+    }
+
+    if (!options.manifest.empty() && !ReadManifest(options.manifest, &options)) {
+        return 1;
+    }
+
+    // Several input files, a manifest or an output directory select the batch mode.
+    const bool batch = options.input_filenames.size() > 1 || !options.manifest.empty() ||
+                       !options.output_dir.empty();
+    if (batch && options.output_file != "-") {
+        std::cerr << "-o cannot be used when compiling several files. Use --output-dir instead."
+                  << std::endl;
+        return 1;
+    }
+
+    // Implement output format defaults.
+    if (options.format == Format::kNone) {
+        // Try inferring from filename.
+        options.format = infer_format(options.output_file);
+    }
+    if (options.format == Format::kNone) {
+        // Ultimately, default to SPIR-V assembly. That's nice for interactive use.
+        options.format = Format::kSpvAsm;
+    }
+
+#if TINT_BUILD_GLSL_WRITER
+    // glslang is initialized once for the process, before any file is compiled.
+    if (options.format == Format::kGlsl && options.validate) {
+        glslang::InitializeProcess();
+    }
+#endif  // TINT_BUILD_GLSL_WRITER
+
+    if (batch) {
+        return CompileBatch(options, transforms) ? 0 : 1;
+    }
+
+    if (!options.input_filenames.empty()) {
+        options.input_filename = options.input_filenames[0];
+    }
+    PhaseTimes times;
+    bool success = Compile(options, transforms, std::cout, std::cerr, times);
+    if (options.time_passes) {
+        PrintPhaseTimes(std::cout, times);
+        PrintTransformStatistics(std::cout, times);
     }
-    if (!success) {
+    if (!success || options.parse_only) {
         return 1;
     }
 
@@ -190,10 +190,10 @@ void Formatter::format(const Diagnostic& diag, State& state) const {
         state.newline();
         state.set_style({Color::kDefault, false});
 
+        auto& lines = src.file->content.Lines();
         for (size_t line_num = rng.begin.line;
-             (line_num <= rng.end.line) && (line_num <= src.file->content.lines.size());
-             line_num++) {
-            auto& line = src.file->content.lines[line_num - 1];
+             (line_num <= rng.end.line) && (line_num <= lines.size()); line_num++) {
+            auto& line = lines[line_num - 1];
             auto line_len = line.size();
 
             bool is_ascii = true;
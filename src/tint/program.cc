@@ -55,7 +55,7 @@ Program::Program(ProgramBuilder&& builder) {
 
     is_valid_ = builder.IsValid();
     if (builder.ResolveOnBuild() && builder.IsValid()) {
-        resolver::Resolver resolver(&builder);
+        resolver::Resolver resolver(&builder, builder.ResolverMaxThreads());
         if (!resolver.Resolve()) {
             is_valid_ = false;
         }
@@ -328,6 +328,14 @@ class ProgramBuilder {
     /// built.
     bool ResolveOnBuild() const { return resolve_on_build_; }
 
+    /// Sets the maximum number of threads used by the Resolver when the program is built.
+    /// @param max_threads the maximum number of threads (defaults to 1), or 0 to use the number of
+    /// hardware threads
+    void SetResolverMaxThreads(size_t max_threads) { resolver_max_threads_ = max_threads; }
+
+    /// @return the maximum number of threads used by the Resolver when the program is built.
+    size_t ResolverMaxThreads() const { return resolver_max_threads_; }
+
     /// @returns true if the program has no error diagnostics and is not missing
     /// information
     bool IsValid() const;
@@ -3103,6 +3111,9 @@ class ProgramBuilder {
     /// program when built.
     bool resolve_on_build_ = true;
 
+    /// Set by SetResolverMaxThreads(). The maximum number of threads used by the Resolver.
+    size_t resolver_max_threads_ = 1;
+
     /// Set by MarkAsMoved(). Once set, no methods may be called on this builder.
     bool moved_ = false;
 };
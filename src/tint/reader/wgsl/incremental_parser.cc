@@ -0,0 +1,156 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/reader/wgsl/incremental_parser.h"
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/tint/program_builder.h"
+#include "src/tint/reader/wgsl/parser_impl.h"
+#include "src/tint/resolver/dependency_graph.h"
+#include "src/tint/utils/hash.h"
+
+namespace tint::reader::wgsl {
+namespace {
+
+/// @returns the byte offset of `loc` in `content`
+size_t OffsetOf(const Source::FileContent& content, const Source::Location& loc) {
+    auto& lines = content.Lines();
+    if (loc.line == 0 || loc.line > lines.size()) {
+        return content.data_view.size();
+    }
+    auto line = lines[loc.line - 1];
+    auto line_offset = static_cast<size_t>(line.data() - content.data_view.data());
+    return line_offset + std::min(loc.column - 1, line.size());
+}
+
+}  // namespace
+
+IncrementalParser::IncrementalParser() = default;
+
+IncrementalParser::~IncrementalParser() = default;
+
+IncrementalParser::Result IncrementalParser::Parse(Source::File const* file) {
+    Result result;
+
+    ParserImpl parser(file);
+    parser.builder().SetResolveOnBuild(false);
+    parser.Parse();
+    auto program = parser.program();
+    result.diagnostics.add(program.Diagnostics());
+    if (!program.IsValid()) {
+        return result;
+    }
+
+    auto& decls = program.AST().GlobalDeclarations();
+    auto& ranges = parser.global_decl_ranges();
+    TINT_ASSERT(Reader, ranges.size() == decls.Length());
+
+    resolver::DependencyGraph graph;
+    if (!resolver::DependencyGraph::Build(program.AST(), program.Symbols(), result.diagnostics,
+                                          graph)) {
+        return result;
+    }
+
+    // Hash the source text of each declaration. Enable directives change the meaning of every
+    // other declaration, so their hashes are combined into the key of every declaration.
+    std::unordered_map<const ast::Node*, size_t> text_hashes;
+    size_t enables_hash = 0;
+    for (size_t i = 0; i < decls.Length(); i++) {
+        auto begin = OffsetOf(file->content, ranges[i].begin);
+        auto end = std::max(begin, OffsetOf(file->content, ranges[i].end));
+        auto text = file->content.data_view.substr(begin, end - begin);
+        auto hash = std::hash<std::string_view>()(text);
+        if (decls[i]->Is<ast::Enable>()) {
+            utils::HashCombine(&enables_hash, hash);
+        }
+        text_hashes.emplace(decls[i], hash);
+    }
+
+    // Build the key of each declaration. ordered_globals holds dependencies before their
+    // dependents, so the keys of the dependencies are known before they are needed.
+    std::unordered_map<const ast::Node*, size_t> keys;
+    bool changed = false;
+    for (auto* decl : graph.ordered_globals) {
+        auto key = utils::Hash(enables_hash, text_hashes[decl]);
+        for (auto* dep : graph.global_dependencies[decl]) {
+            utils::HashCombine(&key, keys[dep]);
+        }
+        keys.emplace(decl, key);
+        changed = changed || !validated_.count(key);
+    }
+
+    if (!changed) {
+        result.reused_declarations = decls.Length();
+        return result;
+    }
+
+    // Gather the declarations that need to be resolved: those that have changed, and their
+    // dependencies. Override IDs must be unique across the module, so all overrides are
+    // resolved, and enable directives are always kept.
+    std::unordered_set<const ast::Node*> needed;
+    std::vector<const ast::Node*> pending;
+    for (auto* decl : decls) {
+        if (decl->IsAnyOf<ast::Enable, ast::Override>() || !validated_.count(keys[decl])) {
+            pending.emplace_back(decl);
+        }
+    }
+    while (!pending.empty()) {
+        auto* decl = pending.back();
+        pending.pop_back();
+        if (needed.emplace(decl).second) {
+            for (auto* dep : graph.global_dependencies[decl]) {
+                pending.emplace_back(dep);
+            }
+        }
+    }
+
+    // Resolve a program holding just the needed declarations, in their original order.
+    ProgramBuilder builder;
+    CloneContext ctx(&builder, &program);
+    for (auto* decl : decls) {
+        if (needed.count(decl)) {
+            builder.AST().AddGlobalDeclaration(ctx.Clone(decl));
+        }
+    }
+    Program resolved(std::move(builder));
+    result.diagnostics.add(resolved.Diagnostics());
+    result.resolved_declarations = needed.size();
+    result.reused_declarations = decls.Length() - needed.size();
+
+    // Only keep the keys of this version of the module, so the set does not grow with each edit.
+    // Declarations that raised any diagnostic, including warnings, are resolved again next time.
+    bool clean = resolved.Diagnostics().count() == 0;
+    std::unordered_set<size_t> validated;
+    for (auto* decl : decls) {
+        auto key = keys[decl];
+        if (validated_.count(key) || (clean && needed.count(decl))) {
+            validated.emplace(key);
+        }
+    }
+    validated_ = std::move(validated);
+
+    return result;
+}
+
+void IncrementalParser::Reset() {
+    validated_.clear();
+}
+
+}  // namespace tint::reader::wgsl
@@ -0,0 +1,68 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_READER_WGSL_INCREMENTAL_PARSER_H_
+#define SRC_TINT_READER_WGSL_INCREMENTAL_PARSER_H_
+
+#include <unordered_set>
+
+#include "src/tint/diagnostic/diagnostic.h"
+#include "src/tint/source.h"
+
+namespace tint::reader::wgsl {
+
+/// IncrementalParser parses and validates successive versions of a WGSL module, such as the
+/// edits made in a live shader editor.
+///
+/// Each module-scope declaration is keyed by a hash of its source text, of the module's enable
+/// directives, and of the keys of the declarations it depends on. Declarations with a key that
+/// was resolved without any diagnostics by the previous call to Parse() are not resolved again.
+/// After an edit to a single function, only that function, the declarations that depend on it,
+/// and their dependencies are resolved.
+class IncrementalParser {
+  public:
+    /// The result of Parse()
+    struct Result {
+        /// The diagnostics raised by parsing the module and resolving its changed declarations
+        diag::List diagnostics;
+        /// The number of module-scope declarations that were resolved
+        size_t resolved_declarations = 0;
+        /// The number of module-scope declarations that were not resolved, as they were
+        /// validated by the previous call to Parse()
+        size_t reused_declarations = 0;
+    };
+
+    /// Constructor
+    IncrementalParser();
+
+    /// Destructor
+    ~IncrementalParser();
+
+    /// Parses the WGSL source, and resolves the module-scope declarations that were not validated
+    /// by the previous call to Parse().
+    /// @param file the source file. The returned diagnostics reference the file.
+    /// @returns the diagnostics and the number of resolved declarations
+    Result Parse(Source::File const* file);
+
+    /// Forgets the declarations validated by earlier calls to Parse().
+    void Reset();
+
+  private:
+    /// The keys of the module-scope declarations that have been resolved without diagnostics
+    std::unordered_set<size_t> validated_;
+};
+
+}  // namespace tint::reader::wgsl
+
+#endif  // SRC_TINT_READER_WGSL_INCREMENTAL_PARSER_H_
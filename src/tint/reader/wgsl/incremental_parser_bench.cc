@@ -0,0 +1,81 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sstream>
+#include <string>
+
+#include "src/tint/bench/benchmark.h"
+#include "src/tint/reader/wgsl/incremental_parser.h"
+#include "src/tint/reader/wgsl/parser.h"
+
+namespace tint::reader::wgsl {
+namespace {
+
+/// @returns a module with `num_kernels` compute entry points, each calling its own helper
+/// function. The helper of the last entry point adds `edit` to its result.
+std::string GenerateModule(int64_t num_kernels, int edit) {
+    std::stringstream wgsl;
+    wgsl << "@group(0) @binding(0) var<storage, read_write> output : array<f32>;\n\n";
+    for (int64_t i = 0; i < num_kernels; i++) {
+        wgsl << "fn helper" << i << "(a : f32) -> f32 {\n";
+        wgsl << "  var x = a;\n";
+        wgsl << "  for (var i = 0; i < 4; i++) {\n";
+        wgsl << "    x = x * 2.0 + " << i << ".0;\n";
+        wgsl << "  }\n";
+        wgsl << "  return x + " << (i == num_kernels - 1 ? edit : 0) << ".0;\n";
+        wgsl << "}\n\n";
+        wgsl << "@compute @workgroup_size(1)\n";
+        wgsl << "fn main" << i << "() {\n";
+        wgsl << "  output[" << i << "] = helper" << i << "(1.0);\n";
+        wgsl << "}\n\n";
+    }
+    return wgsl.str();
+}
+
+/// Alternates between two versions of a module that differ in the body of one helper function,
+/// as a live editor would, re-validating the module with an IncrementalParser.
+void IncrementalParseSingleEdit(benchmark::State& state) {
+    Source::File file_a("a.wgsl", GenerateModule(state.range(0), 0));
+    Source::File file_b("b.wgsl", GenerateModule(state.range(0), 1));
+    IncrementalParser parser;
+    parser.Parse(&file_a);
+    bool use_b = true;
+    for (auto _ : state) {
+        auto res = parser.Parse(use_b ? &file_b : &file_a);
+        if (res.diagnostics.contains_errors()) {
+            state.SkipWithError(res.diagnostics.str().c_str());
+        }
+        use_b = !use_b;
+    }
+}
+
+/// Like IncrementalParseSingleEdit, but parses and resolves the whole module for each edit.
+void FullParseSingleEdit(benchmark::State& state) {
+    Source::File file_a("a.wgsl", GenerateModule(state.range(0), 0));
+    Source::File file_b("b.wgsl", GenerateModule(state.range(0), 1));
+    bool use_b = true;
+    for (auto _ : state) {
+        auto program = Parse(use_b ? &file_b : &file_a);
+        if (program.Diagnostics().contains_errors()) {
+            state.SkipWithError(program.Diagnostics().str().c_str());
+        }
+        use_b = !use_b;
+    }
+}
+
+BENCHMARK(IncrementalParseSingleEdit)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(FullParseSingleEdit)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace tint::reader::wgsl
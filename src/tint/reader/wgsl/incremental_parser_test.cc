@@ -0,0 +1,165 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/reader/wgsl/incremental_parser.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tint::reader::wgsl {
+namespace {
+
+class IncrementalParserTest : public testing::Test {
+  public:
+    /// Parses `source` with #parser, keeping the file alive until the end of the test.
+    IncrementalParser::Result Parse(const std::string& source) {
+        files_.emplace_back(std::make_unique<Source::File>("test.wgsl", source));
+        return parser.Parse(files_.back().get());
+    }
+
+    IncrementalParser parser;
+
+  private:
+    std::vector<std::unique_ptr<Source::File>> files_;
+};
+
+constexpr const char* kModule = R"(
+struct S {
+  a : f32,
+}
+
+@group(0) @binding(0) var<storage, read_write> buffer : S;
+
+fn helper() -> f32 {
+  return 1.0;
+}
+
+fn compute_value() -> f32 {
+  return helper();
+}
+
+fn unrelated() -> i32 {
+  return 1;
+}
+
+@compute @workgroup_size(1)
+fn main() {
+  buffer.a = compute_value();
+}
+)";
+
+TEST_F(IncrementalParserTest, FirstParseResolvesEverything) {
+    auto res = Parse(kModule);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    EXPECT_EQ(res.resolved_declarations, 6u);
+    EXPECT_EQ(res.reused_declarations, 0u);
+}
+
+TEST_F(IncrementalParserTest, Unchanged) {
+    Parse(kModule);
+    auto res = Parse(kModule);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    EXPECT_EQ(res.resolved_declarations, 0u);
+    EXPECT_EQ(res.reused_declarations, 6u);
+}
+
+TEST_F(IncrementalParserTest, MovedDeclarationIsReused) {
+    Parse(kModule);
+    auto res = Parse(std::string("\n\n// a comment\n") + kModule);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    EXPECT_EQ(res.resolved_declarations, 0u);
+    EXPECT_EQ(res.reused_declarations, 6u);
+}
+
+TEST_F(IncrementalParserTest, EditFunctionWithoutDependents) {
+    Parse(kModule);
+    std::string src = kModule;
+    src.replace(src.find("return 1;"), 9, "return 2;");
+    auto res = Parse(src);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    EXPECT_EQ(res.resolved_declarations, 1u);  // unrelated
+    EXPECT_EQ(res.reused_declarations, 5u);
+}
+
+TEST_F(IncrementalParserTest, EditFunctionWithDependents) {
+    Parse(kModule);
+    std::string src = kModule;
+    src.replace(src.find("return 1.0;"), 11, "return 2.0;");
+    auto res = Parse(src);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    // helper, compute_value and main, and the dependencies of main: S and buffer.
+    EXPECT_EQ(res.resolved_declarations, 5u);
+    EXPECT_EQ(res.reused_declarations, 1u);
+}
+
+TEST_F(IncrementalParserTest, EditAttribute) {
+    Parse(kModule);
+    std::string src = kModule;
+    src.replace(src.find("@binding(0)"), 11, "@binding(1)");
+    auto res = Parse(src);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    // buffer, S and main, and the dependencies of main: compute_value and helper.
+    EXPECT_EQ(res.resolved_declarations, 5u);
+    EXPECT_EQ(res.reused_declarations, 1u);
+}
+
+TEST_F(IncrementalParserTest, ErrorInDependent) {
+    Parse(kModule);
+    std::string src = kModule;
+    src.replace(src.find("fn helper() -> f32"), 18, "fn helper() -> i32");
+    src.replace(src.find("return 1.0;"), 11, "return 1;");
+    auto res = Parse(src);
+    EXPECT_EQ(res.diagnostics.str(),
+              R"(test.wgsl:13:3 error: return statement type must match its function return type, returned 'i32', expected 'f32'
+  return helper();
+  ^^^^^^
+)");
+
+    // The error is reported again until it is fixed.
+    res = Parse(src);
+    EXPECT_TRUE(res.diagnostics.contains_errors());
+
+    res = Parse(kModule);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+}
+
+TEST_F(IncrementalParserTest, EnableChangesEverything) {
+    Parse(kModule);
+    auto res = Parse(std::string("enable f16;\n") + kModule);
+    EXPECT_EQ(res.diagnostics.count(), 0u) << res.diagnostics.str();
+    EXPECT_EQ(res.resolved_declarations, 7u);
+    EXPECT_EQ(res.reused_declarations, 0u);
+}
+
+TEST_F(IncrementalParserTest, ParseError) {
+    Parse(kModule);
+    auto res = Parse("fn f( {}");
+    EXPECT_TRUE(res.diagnostics.contains_errors());
+    EXPECT_EQ(res.resolved_declarations, 0u);
+    EXPECT_EQ(res.reused_declarations, 0u);
+}
+
+TEST_F(IncrementalParserTest, Reset) {
+    Parse(kModule);
+    parser.Reset();
+    auto res = Parse(kModule);
+    EXPECT_EQ(res.resolved_declarations, 6u);
+    EXPECT_EQ(res.reused_declarations, 0u);
+}
+
+}  // namespace
+}  // namespace tint::reader::wgsl
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <cstring>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <tuple>
@@ -27,13 +28,14 @@
 #include "src/tint/debug.h"
 #include "src/tint/number.h"
 #include "src/tint/text/unicode.h"
+#include "src/tint/utils/perfect_hash.h"
 
 namespace tint::reader::wgsl {
 namespace {
 
 // Unicode parsing code assumes that the size of a single std::string element is
 // 1 byte.
-static_assert(sizeof(decltype(tint::Source::FileContent::data[0])) == sizeof(uint8_t),
+static_assert(sizeof(decltype(tint::Source::FileContent::data_view[0])) == sizeof(uint8_t),
               "tint::reader::wgsl requires the size of a std::string element "
               "to be a single byte");
 
@@ -84,9 +86,120 @@ uint32_t hex_value(char c) {
     return 0;
 }
 
+/// A WGSL keyword
+struct Keyword {
+    /// The keyword spelling
+    std::string_view name;
+    /// The token type of the keyword
+    Token::Type type;
+};
+
+/// The WGSL keywords
+constexpr Keyword kKeywords[] = {
+    {"array", Token::Type::kArray},
+    {"atomic", Token::Type::kAtomic},
+    {"bitcast", Token::Type::kBitcast},
+    {"bool", Token::Type::kBool},
+    {"break", Token::Type::kBreak},
+    {"case", Token::Type::kCase},
+    {"const", Token::Type::kConst},
+    {"continue", Token::Type::kContinue},
+    {"continuing", Token::Type::kContinuing},
+    {"discard", Token::Type::kDiscard},
+    {"default", Token::Type::kDefault},
+    {"else", Token::Type::kElse},
+    {"enable", Token::Type::kEnable},
+    {"f16", Token::Type::kF16},
+    {"f32", Token::Type::kF32},
+    {"fallthrough", Token::Type::kFallthrough},
+    {"false", Token::Type::kFalse},
+    {"fn", Token::Type::kFn},
+    {"for", Token::Type::kFor},
+    {"i32", Token::Type::kI32},
+    {"if", Token::Type::kIf},
+    {"let", Token::Type::kLet},
+    {"loop", Token::Type::kLoop},
+    {"mat2x2", Token::Type::kMat2x2},
+    {"mat2x3", Token::Type::kMat2x3},
+    {"mat2x4", Token::Type::kMat2x4},
+    {"mat3x2", Token::Type::kMat3x2},
+    {"mat3x3", Token::Type::kMat3x3},
+    {"mat3x4", Token::Type::kMat3x4},
+    {"mat4x2", Token::Type::kMat4x2},
+    {"mat4x3", Token::Type::kMat4x3},
+    {"mat4x4", Token::Type::kMat4x4},
+    {"override", Token::Type::kOverride},
+    {"ptr", Token::Type::kPtr},
+    {"return", Token::Type::kReturn},
+    {"sampler", Token::Type::kSampler},
+    {"sampler_comparison", Token::Type::kComparisonSampler},
+    {"static_assert", Token::Type::kStaticAssert},
+    {"struct", Token::Type::kStruct},
+    {"switch", Token::Type::kSwitch},
+    {"texture_1d", Token::Type::kTextureSampled1d},
+    {"texture_2d", Token::Type::kTextureSampled2d},
+    {"texture_2d_array", Token::Type::kTextureSampled2dArray},
+    {"texture_3d", Token::Type::kTextureSampled3d},
+    {"texture_cube", Token::Type::kTextureSampledCube},
+    {"texture_cube_array", Token::Type::kTextureSampledCubeArray},
+    {"texture_depth_2d", Token::Type::kTextureDepth2d},
+    {"texture_depth_2d_array", Token::Type::kTextureDepth2dArray},
+    {"texture_depth_cube", Token::Type::kTextureDepthCube},
+    {"texture_depth_cube_array", Token::Type::kTextureDepthCubeArray},
+    {"texture_depth_multisampled_2d", Token::Type::kTextureDepthMultisampled2d},
+    {"texture_external", Token::Type::kTextureExternal},
+    {"texture_multisampled_2d", Token::Type::kTextureMultisampled2d},
+    {"texture_storage_1d", Token::Type::kTextureStorage1d},
+    {"texture_storage_2d", Token::Type::kTextureStorage2d},
+    {"texture_storage_2d_array", Token::Type::kTextureStorage2dArray},
+    {"texture_storage_3d", Token::Type::kTextureStorage3d},
+    {"true", Token::Type::kTrue},
+    {"type", Token::Type::kType},
+    {"u32", Token::Type::kU32},
+    {"var", Token::Type::kVar},
+    {"vec2", Token::Type::kVec2},
+    {"vec3", Token::Type::kVec3},
+    {"vec4", Token::Type::kVec4},
+    {"while", Token::Type::kWhile},
+};
+
+/// The number of slots of the keyword hash table. Must be a power of two.
+constexpr uint32_t kKeywordTableSize = 256;
+
+/// The seed of the keyword hash table, chosen so that no two keywords hash to the same slot.
+/// If adding a keyword makes the static_assert below fail, search for a new seed.
+constexpr uint32_t kKeywordHashSeed = 41810;
+
+/// KeywordTable is a perfect hash table of kKeywords
+struct KeywordTable {
+    /// The index of the keyword in kKeywords plus one for each slot, or 0 for empty slots
+    uint8_t slots[kKeywordTableSize] = {};
+    /// True if two keywords hash to the same slot
+    bool has_collisions = false;
+};
+
+/// @returns the perfect hash table of kKeywords
+constexpr KeywordTable BuildKeywordTable() {
+    KeywordTable table;
+    for (size_t i = 0; i < std::size(kKeywords); i++) {
+        auto slot = utils::PerfectHash(kKeywords[i].name, kKeywordHashSeed) &
+                    (kKeywordTableSize - 1);
+        if (table.slots[slot] != 0) {
+            table.has_collisions = true;
+        }
+        table.slots[slot] = static_cast<uint8_t>(i + 1);
+    }
+    return table;
+}
+
+constexpr KeywordTable kKeywordTable = BuildKeywordTable();
+static_assert(!kKeywordTable.has_collisions, "kKeywordHashSeed causes keyword hash collisions");
+
 }  // namespace
 
-Lexer::Lexer(const Source::File* file) : file_(file), location_{1, 1} {}
+Lexer::Lexer(const Source::File* file) : file_(file), location_{1, 1} {
+    line_ = file_->content.LineAt(0, &next_line_offset_);
+}
 
 Lexer::~Lexer() = default;
 
@@ -94,16 +207,7 @@ std::vector<Token> Lexer::Lex() {
     std::vector<Token> tokens;
     tokens.reserve(kDefaultListSize);
     while (true) {
-        tokens.emplace_back(next());
-
-        // If the token can be split, we insert a placeholder element into
-        // the stream to hold the split character.
-        if (tokens.back().IsSplittable()) {
-            auto src = tokens.back().source();
-            src.range.begin.column++;
-            tokens.emplace_back(Token(Token::Type::kPlaceholder, src));
-        }
-
+        tokens.emplace_back(Next());
         if (tokens.back().IsEof() || tokens.back().IsError()) {
             break;
         }
@@ -111,12 +215,25 @@ std::vector<Token> Lexer::Lex() {
     return tokens;
 }
 
-const std::string_view Lexer::line() const {
-    if (file_->content.lines.size() == 0) {
-        static const char* empty_string = "";
-        return empty_string;
+Token Lexer::Next() {
+    if (!placeholder_.IsUninitialized()) {
+        return std::exchange(placeholder_, Token{});
     }
-    return file_->content.lines[location_.line - 1];
+
+    auto t = next();
+
+    // If the token can be split, we insert a placeholder element into
+    // the stream to hold the split character.
+    if (t.IsSplittable()) {
+        auto src = t.source();
+        src.range.begin.column++;
+        placeholder_ = Token(Token::Type::kPlaceholder, src);
+    }
+    return t;
+}
+
+const std::string_view Lexer::line() const {
+    return line_;
 }
 
 size_t Lexer::pos() const {
@@ -153,10 +270,15 @@ void Lexer::set_pos(size_t pos) {
 void Lexer::advance_line() {
     location_.line++;
     location_.column = 1;
+    if (next_line_offset_ < file_->content.data_view.size()) {
+        line_ = file_->content.LineAt(next_line_offset_, &next_line_offset_);
+    } else {
+        line_ = {};
+    }
 }
 
 bool Lexer::is_eof() const {
-    return location_.line >= file_->content.lines.size() && pos() >= length();
+    return next_line_offset_ >= file_->content.data_view.size() && pos() >= length();
 }
 
 bool Lexer::is_eol() const {
@@ -366,9 +488,9 @@ Token Lexer::try_float() {
 
         // If an 'e' or 'E' was present, then the number part must also be present.
         if (!has_exponent) {
-            const auto str = std::string{substr(start, end - start)};
-            return {Token::Type::kError, source,
-                    "incomplete exponent for floating point literal: " + str};
+            error_ = "incomplete exponent for floating point literal: " +
+                     std::string{substr(start, end - start)};
+            return {Token::Type::kError, source, std::string_view(error_)};
         }
     }
 
@@ -691,8 +813,10 @@ Token Lexer::try_hex_float() {
     }
 
     if (signed_exponent >= kExponentMax || (signed_exponent == kExponentMax && mantissa != 0)) {
-        std::string type = has_f_suffix ? "f32" : (has_h_suffix ? "f16" : "abstract-float");
-        return {Token::Type::kError, source, "value cannot be represented as '" + type + "'"};
+        return {Token::Type::kError, source,
+                has_f_suffix   ? "value cannot be represented as 'f32'"
+                : has_h_suffix ? "value cannot be represented as 'f16'"
+                               : "value cannot be represented as 'abstract-float'"};
     }
 
     // Combine sign, mantissa, and exponent
@@ -1132,200 +1256,12 @@ Token Lexer::try_punctuation() {
 }
 
 Token Lexer::check_keyword(const Source& source, std::string_view str) {
-    if (str == "array") {
-        return {Token::Type::kArray, source, "array"};
-    }
-    if (str == "atomic") {
-        return {Token::Type::kAtomic, source, "atomic"};
-    }
-    if (str == "bitcast") {
-        return {Token::Type::kBitcast, source, "bitcast"};
-    }
-    if (str == "bool") {
-        return {Token::Type::kBool, source, "bool"};
-    }
-    if (str == "break") {
-        return {Token::Type::kBreak, source, "break"};
-    }
-    if (str == "case") {
-        return {Token::Type::kCase, source, "case"};
-    }
-    if (str == "const") {
-        return {Token::Type::kConst, source, "const"};
-    }
-    if (str == "continue") {
-        return {Token::Type::kContinue, source, "continue"};
-    }
-    if (str == "continuing") {
-        return {Token::Type::kContinuing, source, "continuing"};
-    }
-    if (str == "discard") {
-        return {Token::Type::kDiscard, source, "discard"};
-    }
-    if (str == "default") {
-        return {Token::Type::kDefault, source, "default"};
-    }
-    if (str == "else") {
-        return {Token::Type::kElse, source, "else"};
-    }
-    if (str == "enable") {
-        return {Token::Type::kEnable, source, "enable"};
-    }
-    if (str == "f16") {
-        return {Token::Type::kF16, source, "f16"};
-    }
-    if (str == "f32") {
-        return {Token::Type::kF32, source, "f32"};
-    }
-    if (str == "fallthrough") {
-        return {Token::Type::kFallthrough, source, "fallthrough"};
-    }
-    if (str == "false") {
-        return {Token::Type::kFalse, source, "false"};
-    }
-    if (str == "fn") {
-        return {Token::Type::kFn, source, "fn"};
-    }
-    if (str == "for") {
-        return {Token::Type::kFor, source, "for"};
-    }
-    if (str == "i32") {
-        return {Token::Type::kI32, source, "i32"};
-    }
-    if (str == "if") {
-        return {Token::Type::kIf, source, "if"};
-    }
-    if (str == "let") {
-        return {Token::Type::kLet, source, "let"};
-    }
-    if (str == "loop") {
-        return {Token::Type::kLoop, source, "loop"};
-    }
-    if (str == "mat2x2") {
-        return {Token::Type::kMat2x2, source, "mat2x2"};
-    }
-    if (str == "mat2x3") {
-        return {Token::Type::kMat2x3, source, "mat2x3"};
-    }
-    if (str == "mat2x4") {
-        return {Token::Type::kMat2x4, source, "mat2x4"};
-    }
-    if (str == "mat3x2") {
-        return {Token::Type::kMat3x2, source, "mat3x2"};
-    }
-    if (str == "mat3x3") {
-        return {Token::Type::kMat3x3, source, "mat3x3"};
-    }
-    if (str == "mat3x4") {
-        return {Token::Type::kMat3x4, source, "mat3x4"};
-    }
-    if (str == "mat4x2") {
-        return {Token::Type::kMat4x2, source, "mat4x2"};
-    }
-    if (str == "mat4x3") {
-        return {Token::Type::kMat4x3, source, "mat4x3"};
-    }
-    if (str == "mat4x4") {
-        return {Token::Type::kMat4x4, source, "mat4x4"};
-    }
-    if (str == "override") {
-        return {Token::Type::kOverride, source, "override"};
-    }
-    if (str == "ptr") {
-        return {Token::Type::kPtr, source, "ptr"};
-    }
-    if (str == "return") {
-        return {Token::Type::kReturn, source, "return"};
-    }
-    if (str == "sampler") {
-        return {Token::Type::kSampler, source, "sampler"};
-    }
-    if (str == "sampler_comparison") {
-        return {Token::Type::kComparisonSampler, source, "sampler_comparison"};
-    }
-    if (str == "static_assert") {
-        return {Token::Type::kStaticAssert, source, "static_assert"};
-    }
-    if (str == "struct") {
-        return {Token::Type::kStruct, source, "struct"};
-    }
-    if (str == "switch") {
-        return {Token::Type::kSwitch, source, "switch"};
-    }
-    if (str == "texture_1d") {
-        return {Token::Type::kTextureSampled1d, source, "texture_1d"};
-    }
-    if (str == "texture_2d") {
-        return {Token::Type::kTextureSampled2d, source, "texture_2d"};
-    }
-    if (str == "texture_2d_array") {
-        return {Token::Type::kTextureSampled2dArray, source, "texture_2d_array"};
-    }
-    if (str == "texture_3d") {
-        return {Token::Type::kTextureSampled3d, source, "texture_3d"};
-    }
-    if (str == "texture_cube") {
-        return {Token::Type::kTextureSampledCube, source, "texture_cube"};
-    }
-    if (str == "texture_cube_array") {
-        return {Token::Type::kTextureSampledCubeArray, source, "texture_cube_array"};
-    }
-    if (str == "texture_depth_2d") {
-        return {Token::Type::kTextureDepth2d, source, "texture_depth_2d"};
-    }
-    if (str == "texture_depth_2d_array") {
-        return {Token::Type::kTextureDepth2dArray, source, "texture_depth_2d_array"};
-    }
-    if (str == "texture_depth_cube") {
-        return {Token::Type::kTextureDepthCube, source, "texture_depth_cube"};
-    }
-    if (str == "texture_depth_cube_array") {
-        return {Token::Type::kTextureDepthCubeArray, source, "texture_depth_cube_array"};
-    }
-    if (str == "texture_depth_multisampled_2d") {
-        return {Token::Type::kTextureDepthMultisampled2d, source, "texture_depth_multisampled_2d"};
-    }
-    if (str == "texture_external") {
-        return {Token::Type::kTextureExternal, source, "texture_external"};
-    }
-    if (str == "texture_multisampled_2d") {
-        return {Token::Type::kTextureMultisampled2d, source, "texture_multisampled_2d"};
-    }
-    if (str == "texture_storage_1d") {
-        return {Token::Type::kTextureStorage1d, source, "texture_storage_1d"};
-    }
-    if (str == "texture_storage_2d") {
-        return {Token::Type::kTextureStorage2d, source, "texture_storage_2d"};
-    }
-    if (str == "texture_storage_2d_array") {
-        return {Token::Type::kTextureStorage2dArray, source, "texture_storage_2d_array"};
-    }
-    if (str == "texture_storage_3d") {
-        return {Token::Type::kTextureStorage3d, source, "texture_storage_3d"};
-    }
-    if (str == "true") {
-        return {Token::Type::kTrue, source, "true"};
-    }
-    if (str == "type") {
-        return {Token::Type::kType, source, "type"};
-    }
-    if (str == "u32") {
-        return {Token::Type::kU32, source, "u32"};
-    }
-    if (str == "var") {
-        return {Token::Type::kVar, source, "var"};
-    }
-    if (str == "vec2") {
-        return {Token::Type::kVec2, source, "vec2"};
-    }
-    if (str == "vec3") {
-        return {Token::Type::kVec3, source, "vec3"};
-    }
-    if (str == "vec4") {
-        return {Token::Type::kVec4, source, "vec4"};
-    }
-    if (str == "while") {
-        return {Token::Type::kWhile, source, "while"};
+    auto slot = utils::PerfectHash(str, kKeywordHashSeed) & (kKeywordTableSize - 1);
+    if (auto index = kKeywordTable.slots[slot]) {
+        const Keyword& keyword = kKeywords[index - 1];
+        if (keyword.name == str) {
+            return {keyword.type, source, keyword.name};
+        }
     }
     return {};
 }
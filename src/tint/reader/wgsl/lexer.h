@@ -33,6 +33,14 @@ class Lexer {
     /// @return the token list.
     std::vector<Token> Lex();
 
+    /// Lexes a single token, so that the input can be tokenized as a stream without holding the
+    /// whole token list in memory. A splittable token (such as `>>`) is followed by a placeholder
+    /// token that holds its split character. The returned tokens may reference the Lexer, and
+    /// must not be used once the Lexer has been destroyed. Must not be called once an end of
+    /// file or error token has been returned.
+    /// @return the next token
+    Token Next();
+
   private:
     /// Returns the next token in the input stream.
     /// @return Token
@@ -106,6 +114,14 @@ class Lexer {
     Source::File const* const file_;
     /// The current location within the input
     Source::Location location_;
+    /// The current line of the input
+    std::string_view line_;
+    /// The byte offset of the line that follows #line_ in the file content
+    size_t next_line_offset_ = 0;
+    /// The placeholder token to return from the next call to Next(), if any
+    Token placeholder_;
+    /// The message of an error token that is not a string literal
+    std::string error_;
 };
 
 }  // namespace tint::reader::wgsl
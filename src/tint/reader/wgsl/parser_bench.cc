@@ -36,5 +36,26 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_WGSL_PROGRAMS(ParseWGSL);
 
+// Like ParseWGSL, but also constructs the Source::File for each parse, as Dawn does for each
+// shader module that it creates.
+void ParseWGSLWithNewFile(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& file = std::get<Source::File>(res);
+    std::string source{file.content.data_view};
+    for (auto _ : state) {
+        Source::File new_file(file.path, source);
+        auto res = Parse(&new_file);
+        if (res.Diagnostics().contains_errors()) {
+            state.SkipWithError(res.Diagnostics().str().c_str());
+        }
+    }
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(ParseWGSLWithNewFile);
+
 }  // namespace
 }  // namespace tint::reader::wgsl
@@ -244,44 +244,65 @@ void ParserImpl::deprecated(const Source& source, const std::string& msg) {
                                        "use of deprecated language feature: " + msg, source);
 }
 
-const Token& ParserImpl::next() {
+void ParserImpl::lex_until(size_t idx) {
+    while (lexed_token_count() <= idx) {
+        if (!tokens_.empty() && (tokens_.back().IsEof() || tokens_.back().IsError())) {
+            return;
+        }
+        tokens_.emplace_back(lexer_->Next());
+    }
+}
+
+Token ParserImpl::next() {
+    lex_until(next_token_idx_);
+
     // If the next token is already an error or the end of file, stay there.
-    if (tokens_[next_token_idx_].IsEof() || tokens_[next_token_idx_].IsError()) {
-        return tokens_[next_token_idx_];
+    if (token_at(next_token_idx_).IsEof() || token_at(next_token_idx_).IsError()) {
+        return token_at(next_token_idx_);
     }
 
     // Skip over any placeholder elements
     while (true) {
-        if (!tokens_[next_token_idx_].IsPlaceholder()) {
+        if (!token_at(next_token_idx_).IsPlaceholder()) {
             break;
         }
         next_token_idx_++;
+        lex_until(next_token_idx_);
     }
     last_source_idx_ = next_token_idx_;
 
-    if (!tokens_[next_token_idx_].IsEof() && !tokens_[next_token_idx_].IsError()) {
+    if (!token_at(next_token_idx_).IsEof() && !token_at(next_token_idx_).IsError()) {
         next_token_idx_++;
     }
-    return tokens_[last_source_idx_];
+
+    // Drop the tokens that can no longer be accessed.
+    while (first_token_idx_ < last_source_idx_ && first_token_idx_ + 1 < next_token_idx_) {
+        tokens_.pop_front();
+        first_token_idx_++;
+    }
+
+    return token_at(last_source_idx_);
 }
 
-const Token& ParserImpl::peek(size_t idx) {
-    if (next_token_idx_ + idx >= tokens_.size()) {
-        return tokens_[tokens_.size() - 1];
+Token ParserImpl::peek(size_t idx) {
+    lex_until(next_token_idx_ + idx);
+    if (next_token_idx_ + idx >= lexed_token_count()) {
+        return tokens_.back();
     }
 
     // Skip over any placeholder elements
     while (true) {
-        if (!tokens_[next_token_idx_ + idx].IsPlaceholder()) {
+        if (!token_at(next_token_idx_ + idx).IsPlaceholder()) {
             break;
         }
         idx++;
+        lex_until(next_token_idx_ + idx);
     }
-    if (next_token_idx_ + idx >= tokens_.size()) {
-        return tokens_[tokens_.size() - 1];
+    if (next_token_idx_ + idx >= lexed_token_count()) {
+        return tokens_.back();
     }
 
-    return tokens_[next_token_idx_ + idx];
+    return token_at(next_token_idx_ + idx);
 }
 
 bool ParserImpl::peek_is(Token::Type tok, size_t idx) {
@@ -293,24 +314,30 @@ void ParserImpl::split_token(Token::Type lhs, Token::Type rhs) {
         TINT_ICE(Reader, builder_.Diagnostics())
             << "attempt to update placeholder at beginning of tokens";
     }
-    if (next_token_idx_ >= tokens_.size()) {
+    lex_until(next_token_idx_);
+    if (next_token_idx_ >= lexed_token_count()) {
         TINT_ICE(Reader, builder_.Diagnostics())
             << "attempt to update placeholder past end of tokens";
     }
-    if (!tokens_[next_token_idx_].IsPlaceholder()) {
+    if (!token_at(next_token_idx_).IsPlaceholder()) {
         TINT_ICE(Reader, builder_.Diagnostics()) << "attempt to update non-placeholder token";
     }
-    tokens_[next_token_idx_ - 1].SetType(lhs);
-    tokens_[next_token_idx_].SetType(rhs);
+    token_at(next_token_idx_ - 1).SetType(lhs);
+    token_at(next_token_idx_).SetType(rhs);
 }
 
-Source ParserImpl::last_source() const {
-    return tokens_[last_source_idx_].source();
+Source ParserImpl::last_source() {
+    // Lex the first token if next() has not been called yet.
+    lex_until(last_source_idx_);
+    return token_at(last_source_idx_).source();
 }
 
 void ParserImpl::InitializeLex() {
-    Lexer l{file_};
-    tokens_ = l.Lex();
+    lexer_ = std::make_unique<Lexer>(file_);
+    tokens_.clear();
+    first_token_idx_ = 0;
+    next_token_idx_ = 0;
+    last_source_idx_ = 0;
 }
 
 bool ParserImpl::Parse() {
@@ -324,7 +351,7 @@ bool ParserImpl::Parse() {
 void ParserImpl::translation_unit() {
     bool after_global_decl = false;
     while (continue_parsing()) {
-        auto& p = peek();
+        auto p = peek();
         if (p.IsEof()) {
             break;
         }
@@ -340,6 +367,9 @@ void ParserImpl::translation_unit() {
                 add_error(p, "unexpected token");
             }
         }
+        while (global_decl_ranges_.size() < builder_.AST().GlobalDeclarations().Length()) {
+            global_decl_ranges_.emplace_back(p.source().range.begin, last_source().range.end);
+        }
 
         if (builder_.Diagnostics().error_count() >= max_errors_) {
             add_error(Source{{}, p.source().file},
@@ -352,7 +382,7 @@ void ParserImpl::translation_unit() {
 // global_directive
 //  : enable_directive
 Maybe<bool> ParserImpl::global_directive(bool have_parsed_decl) {
-    auto& p = peek();
+    auto p = peek();
     auto ed = enable_directive();
     if (ed.matched && have_parsed_decl) {
         return add_error(p, "enable directives must come before all global declarations");
@@ -370,7 +400,7 @@ Maybe<bool> ParserImpl::enable_directive() {
 
         // Match the extension name.
         Expect<std::string> name = {""};
-        auto& t = peek();
+        auto t = peek();
         if (t.IsIdentifier()) {
             synchronized_ = true;
             next();
@@ -534,7 +564,7 @@ Maybe<bool> ParserImpl::global_decl() {
     }
 
     // We have a statement outside of a function?
-    auto& t = peek();
+    auto t = peek();
     auto stat = without_error([&] { return statement(); });
     if (stat.matched) {
         // Attempt to jump to the next '}' - the function might have just been
@@ -910,7 +940,7 @@ Maybe<const ast::Type*> ParserImpl::depth_texture() {
 //  | 'rgba32sint'
 //  | 'rgba32float'
 Expect<ast::TexelFormat> ParserImpl::expect_texel_format(std::string_view use) {
-    auto& t = next();
+    auto t = next();
     auto fmt = ast::ParseTexelFormat(t.to_str());
     if (fmt == ast::TexelFormat::kInvalid) {
         return add_error(t.source(), "invalid format", use);
@@ -934,7 +964,7 @@ Expect<ParserImpl::TypedIdentifier> ParserImpl::expect_ident_or_variable_ident_d
         return Failure::kErrored;
     }
 
-    auto& t = peek();
+    auto t = peek();
     auto type = type_decl();
     if (type.errored) {
         return Failure::kErrored;
@@ -1020,7 +1050,7 @@ Maybe<const ast::Alias*> ParserImpl::type_alias_decl() {
         return Failure::kNoMatch;
     }
 
-    auto& t = next();
+    auto t = next();
     const char* use = "type alias";
 
     auto name = expect_ident(use);
@@ -1066,10 +1096,11 @@ Maybe<const ast::Alias*> ParserImpl::type_alias_decl() {
 //   | MAT4x4 LESS_THAN type_decl GREATER_THAN
 //   | texture_samplers
 Maybe<const ast::Type*> ParserImpl::type_decl() {
-    auto& t = peek();
+    auto t = peek();
     Source source;
     if (match(Token::Type::kIdentifier, &source)) {
-        return builder_.create<ast::TypeName>(source, builder_.Symbols().Register(t.to_str()));
+        auto sym = builder_.Symbols().Register(t.to_str_view());
+        return builder_.create<ast::TypeName>(source, sym);
     }
 
     if (match(Token::Type::kBool, &source)) {
@@ -1284,7 +1315,7 @@ Expect<const ast::Type*> ParserImpl::expect_type_decl_matrix(const Token& t) {
 //
 // Note, we also parse `push_constant` from the experimental extension
 Expect<ast::StorageClass> ParserImpl::expect_address_space(std::string_view use) {
-    auto& t = peek();
+    auto t = peek();
     auto ident = expect_ident("storage class");
     if (ident.errored) {
         return Failure::kErrored;
@@ -1301,7 +1332,7 @@ Expect<ast::StorageClass> ParserImpl::expect_address_space(std::string_view use)
 // struct_decl
 //   : STRUCT IDENT struct_body_decl
 Maybe<const ast::Struct*> ParserImpl::struct_decl() {
-    auto& t = peek();
+    auto t = peek();
 
     if (!match(Token::Type::kStruct)) {
         return Failure::kNoMatch;
@@ -1329,7 +1360,7 @@ Expect<ParserImpl::StructMemberList> ParserImpl::expect_struct_body_decl() {
         bool errored = false;
         while (continue_parsing()) {
             // Check for the end of the list.
-            auto& t = peek();
+            auto t = peek();
             if (!t.IsIdentifier() && !t.Is(Token::Type::kAttr)) {
                 break;
             }
@@ -1499,7 +1530,7 @@ Expect<ParserImpl::ParameterList> ParserImpl::expect_param_list() {
     ParameterList ret;
     while (continue_parsing()) {
         // Check for the end of the list.
-        auto& t = peek();
+        auto t = peek();
         if (!t.IsIdentifier() && !t.Is(Token::Type::kAttr)) {
             break;
         }
@@ -1541,7 +1572,7 @@ Expect<ast::Parameter*> ParserImpl::expect_param() {
 //
 // TODO(crbug.com/tint/1503): Remove when deprecation period is over.
 Expect<ast::PipelineStage> ParserImpl::expect_pipeline_stage() {
-    auto& t = peek();
+    auto t = peek();
     if (t == "vertex") {
         next();  // Consume the peek
         return {ast::PipelineStage::kVertex, t.source()};
@@ -2085,7 +2116,7 @@ Maybe<const ast::CaseStatement*> ParserImpl::switch_body() {
         return Failure::kNoMatch;
     }
 
-    auto& t = next();
+    auto t = next();
 
     CaseSelectorList selector_list;
     if (t.Is(Token::Type::kCase)) {
@@ -2337,8 +2368,8 @@ Maybe<const ast::WhileStatement*> ParserImpl::while_statement() {
 // func_call_statement
 //    : IDENT argument_expression_list
 Maybe<const ast::CallStatement*> ParserImpl::func_call_statement() {
-    auto& t = peek();
-    auto& t2 = peek(1);
+    auto t = peek();
+    auto t2 = peek(1);
     if (!t.IsIdentifier() || !t2.Is(Token::Type::kParenLeft)) {
         return Failure::kNoMatch;
     }
@@ -2354,7 +2385,8 @@ Maybe<const ast::CallStatement*> ParserImpl::func_call_statement() {
         t.source(),
         create<ast::CallExpression>(
             t.source(),
-            create<ast::IdentifierExpression>(t.source(), builder_.Symbols().Register(t.to_str())),
+            create<ast::IdentifierExpression>(t.source(),
+                                              builder_.Symbols().Register(t.to_str_view())),
             std::move(params.value)));
 }
 
@@ -2425,7 +2457,7 @@ Maybe<const ast::BlockStatement*> ParserImpl::continuing_statement() {
 //   | paren_expression
 //   | BITCAST LESS_THAN type_decl GREATER_THAN paren_expression
 Maybe<const ast::Expression*> ParserImpl::primary_expression() {
-    auto& t = peek();
+    auto t = peek();
 
     auto lit = const_literal();
     if (lit.errored) {
@@ -2463,8 +2495,8 @@ Maybe<const ast::Expression*> ParserImpl::primary_expression() {
     if (t.IsIdentifier()) {
         next();
 
-        auto* ident =
-            create<ast::IdentifierExpression>(t.source(), builder_.Symbols().Register(t.to_str()));
+        auto* ident = create<ast::IdentifierExpression>(
+            t.source(), builder_.Symbols().Register(t.to_str_view()));
 
         if (peek_is(Token::Type::kParenLeft)) {
             auto params = expect_argument_expression_list("function call");
@@ -2590,7 +2622,7 @@ Expect<ParserImpl::ExpressionList> ParserImpl::expect_argument_expression_list(
 //   | STAR unary_expression
 //   | AND unary_expression
 Maybe<const ast::Expression*> ParserImpl::unary_expression() {
-    auto& t = peek();
+    auto t = peek();
 
     if (match(Token::Type::kPlusPlus) || match(Token::Type::kMinusMinus)) {
         add_error(t.source(),
@@ -2655,7 +2687,7 @@ Expect<const ast::Expression*> ParserImpl::expect_multiplicative_expr(const ast:
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
 
         auto rhs = unary_expression();
         if (rhs.errored) {
@@ -2700,7 +2732,7 @@ Expect<const ast::Expression*> ParserImpl::expect_additive_expr(const ast::Expre
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
 
         auto rhs = multiplicative_expression();
         if (rhs.errored) {
@@ -2747,7 +2779,7 @@ Expect<const ast::Expression*> ParserImpl::expect_shift_expr(const ast::Expressi
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
         auto rhs = additive_expression();
         if (rhs.errored) {
             return Failure::kErrored;
@@ -2797,7 +2829,7 @@ Expect<const ast::Expression*> ParserImpl::expect_relational_expr(const ast::Exp
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
 
         auto rhs = shift_expression();
         if (rhs.errored) {
@@ -2842,7 +2874,7 @@ Expect<const ast::Expression*> ParserImpl::expect_equality_expr(const ast::Expre
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
 
         auto rhs = relational_expression();
         if (rhs.errored) {
@@ -2881,7 +2913,7 @@ Expect<const ast::Expression*> ParserImpl::expect_and_expr(const ast::Expression
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
 
         auto rhs = equality_expression();
         if (rhs.errored) {
@@ -2993,7 +3025,7 @@ Expect<const ast::Expression*> ParserImpl::expect_logical_and_expr(const ast::Ex
             return lhs;
         }
 
-        auto& t = next();
+        auto t = next();
 
         auto rhs = inclusive_or_expression();
         if (rhs.errored) {
@@ -3119,7 +3151,7 @@ Maybe<ast::BinaryOp> ParserImpl::compound_assignment_operator() {
 // decrement_statement
 // | lhs_expression MINUS_MINUS
 Maybe<const ast::Statement*> ParserImpl::assignment_statement() {
-    auto& t = peek();
+    auto t = peek();
 
     // tint:295 - Test for `ident COLON` - this is invalid grammar, and without
     // special casing will error as "missing = for assignment", which is less
@@ -3185,7 +3217,7 @@ Maybe<const ast::Statement*> ParserImpl::assignment_statement() {
 //   | TRUE
 //   | FALSE
 Maybe<const ast::LiteralExpression*> ParserImpl::const_literal() {
-    auto& t = peek();
+    auto t = peek();
     if (match(Token::Type::kIntLiteral)) {
         return create<ast::IntLiteralExpression>(t.source(), t.to_i64(),
                                                  ast::IntLiteralExpression::Suffix::kNone);
@@ -3250,7 +3282,7 @@ Maybe<ParserImpl::AttributeList> ParserImpl::attribute_list() {
 }
 
 Expect<const ast::Attribute*> ParserImpl::expect_attribute() {
-    auto& t = peek();
+    auto t = peek();
     auto attr = attribute();
     if (attr.errored) {
         return Failure::kErrored;
@@ -3286,7 +3318,7 @@ Expect<const ast::Attribute*> ParserImpl::expect_attribute() {
 //
 Maybe<const ast::Attribute*> ParserImpl::attribute() {
     using Result = Maybe<const ast::Attribute*>;
-    auto& t = next();
+    auto t = next();
 
     if (!t.IsIdentifier()) {
         return Failure::kNoMatch;
@@ -3507,7 +3539,7 @@ bool ParserImpl::expect_attributes_consumed(utils::VectorRef<const ast::Attribut
 }
 
 bool ParserImpl::match(Token::Type tok, Source* source /*= nullptr*/) {
-    auto& t = peek();
+    auto t = peek();
 
     if (source != nullptr) {
         *source = t.source();
@@ -3521,7 +3553,7 @@ bool ParserImpl::match(Token::Type tok, Source* source /*= nullptr*/) {
 }
 
 bool ParserImpl::expect(std::string_view use, Token::Type tok) {
-    auto& t = peek();
+    auto t = peek();
     if (t.Is(tok)) {
         next();
         synchronized_ = true;
@@ -3560,7 +3592,7 @@ bool ParserImpl::expect(std::string_view use, Token::Type tok) {
 }
 
 Expect<int32_t> ParserImpl::expect_sint(std::string_view use) {
-    auto& t = peek();
+    auto t = peek();
     if (!t.Is(Token::Type::kIntLiteral) && !t.Is(Token::Type::kIntLiteral_I)) {
         return add_error(t.source(), "expected signed integer literal", use);
     }
@@ -3603,7 +3635,7 @@ Expect<uint32_t> ParserImpl::expect_nonzero_positive_sint(std::string_view use)
 }
 
 Expect<std::string> ParserImpl::expect_ident(std::string_view use) {
-    auto& t = peek();
+    auto t = peek();
     if (t.IsIdentifier()) {
         synchronized_ = true;
         next();
@@ -3699,7 +3731,7 @@ bool ParserImpl::sync_to(Token::Type tok, bool consume) {
     BlockCounters counters;
 
     for (size_t i = 0; i < kMaxResynchronizeLookahead; i++) {
-        auto& t = peek(i);
+        auto t = peek(i);
         if (counters.consume(t) > 0) {
             continue;  // Nested block
         }
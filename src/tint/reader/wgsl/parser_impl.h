@@ -15,6 +15,7 @@
 #ifndef SRC_TINT_READER_WGSL_PARSER_IMPL_H_
 #define SRC_TINT_READER_WGSL_PARSER_IMPL_H_
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -310,8 +311,8 @@ class ParserImpl {
     explicit ParserImpl(Source::File const* file);
     ~ParserImpl();
 
-    /// Reads tokens from the source file. This will be called automatically
-    /// by |parse|.
+    /// Prepares the lexing of the source file. This will be called automatically
+    /// by |parse|. Tokens are lexed on demand as the parser peeks at them.
     void InitializeLex();
 
     /// Run the parser
@@ -343,12 +344,17 @@ class ParserImpl {
     /// @returns the program builder.
     ProgramBuilder& builder() { return builder_; }
 
+    /// @returns the source range of each module-scope declaration added by translation_unit(),
+    /// in the order of ast::Module::GlobalDeclarations(). Unlike the source of the declaration
+    /// node, each range spans the whole declaration, including its attributes.
+    const std::vector<Source::Range>& global_decl_ranges() const { return global_decl_ranges_; }
+
     /// @returns the next token
-    const Token& next();
+    Token next();
     /// Peeks ahead and returns the token at `idx` ahead of the current position
     /// @param idx the index of the token to return
     /// @returns the token `idx` positions ahead without advancing
-    const Token& peek(size_t idx = 0);
+    Token peek(size_t idx = 0);
     /// Peeks ahead and returns true if the token at `idx` ahead of the current
     /// position is |tok|
     /// @param idx the index of the token to return
@@ -356,7 +362,7 @@ class ParserImpl {
     /// @returns true if the token `idx` positions ahead is |tok|
     bool peek_is(Token::Type tok, size_t idx = 0);
     /// @returns the last source location that was returned by `next()`
-    Source last_source() const;
+    Source last_source();
     /// Appends an error at `t` with the message `msg`
     /// @param t the token to associate the error with
     /// @param msg the error message
@@ -888,8 +894,27 @@ class ParserImpl {
         return builder_.create<T>(std::forward<ARGS>(args)...);
     }
 
+    /// Lexes tokens until `tokens_` holds the token at index `idx`, or the last token of the
+    /// input has been lexed.
+    /// @param idx the index of the token
+    void lex_until(size_t idx);
+
+    /// @returns the number of tokens lexed so far, including the tokens that have been dropped
+    size_t lexed_token_count() const { return first_token_idx_ + tokens_.size(); }
+
+    /// @param idx the index of the token, which must be lexed and not yet dropped
+    /// @returns the token at index `idx`
+    Token& token_at(size_t idx) { return tokens_[idx - first_token_idx_]; }
+
     Source::File const* const file_;
-    std::vector<Token> tokens_;
+    std::unique_ptr<Lexer> lexer_;
+    /// The tokens that have been lexed and not yet dropped. Tokens are dropped once they have been
+    /// consumed by next(), except for the last consumed token, which split_token() and
+    /// last_source() still use. The number of tokens held is therefore bounded by the lookahead
+    /// of peek(), and not by the size of the input.
+    std::deque<Token> tokens_;
+    /// The index of the token at the front of `tokens_`
+    size_t first_token_idx_ = 0;
     size_t next_token_idx_ = 0;
     size_t last_source_idx_ = 0;
     bool synchronized_ = true;
@@ -898,6 +923,7 @@ class ParserImpl {
     int silence_errors_ = 0;
     ProgramBuilder builder_;
     size_t max_errors_ = 25;
+    std::vector<Source::Range> global_decl_ranges_;
 };
 
 }  // namespace tint::reader::wgsl
@@ -136,5 +136,14 @@ fn main() -> @location(0) vec4<f32> {
     EXPECT_EQ(p->error(), "5:3: unterminated block comment") << p->error();
 }
 
+TEST_F(ParserImplTest, LastSourceBeforeNext) {
+    auto p = parser("  fn main() {}");
+
+    // No token has been lexed yet, so the source is the one of the first token.
+    auto source = p->last_source();
+    EXPECT_EQ(source.range.begin.line, 1u);
+    EXPECT_EQ(source.range.begin.column, 3u);
+}
+
 }  // namespace
 }  // namespace tint::reader::wgsl
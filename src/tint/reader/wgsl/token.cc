@@ -275,9 +275,6 @@ Token::Token() : type_(Type::kUninitialized) {}
 Token::Token(Type type, const Source& source, const std::string_view& view)
     : type_(type), source_(source), value_(view) {}
 
-Token::Token(Type type, const Source& source, const std::string& str)
-    : type_(type), source_(source), value_(str) {}
-
 Token::Token(Type type, const Source& source, const char* str)
     : type_(type), source_(source), value_(std::string_view(str)) {}
 
@@ -289,18 +286,11 @@ Token::Token(Type type, const Source& source, double val)
 
 Token::Token(Type type, const Source& source) : type_(type), source_(source) {}
 
-Token::Token(Token&&) = default;
-
-Token::~Token() = default;
-
 bool Token::operator==(std::string_view ident) const {
     if (type_ != Type::kIdentifier) {
         return false;
     }
-    if (auto* view = std::get_if<std::string_view>(&value_)) {
-        return *view == ident;
-    }
-    return std::get<std::string>(value_) == ident;
+    return std::get<std::string_view>(value_) == ident;
 }
 
 std::string Token::to_str() const {
@@ -319,15 +309,19 @@ std::string Token::to_str() const {
             return std::to_string(std::get<int64_t>(value_)) + "u";
         case Type::kIdentifier:
         case Type::kError:
-            if (auto* view = std::get_if<std::string_view>(&value_)) {
-                return std::string(*view);
-            }
-            return std::get<std::string>(value_);
+            return std::string(std::get<std::string_view>(value_));
         default:
             return "";
     }
 }
 
+std::string_view Token::to_str_view() const {
+    if (type_ == Type::kIdentifier || type_ == Type::kError) {
+        return std::get<std::string_view>(value_);
+    }
+    return {};
+}
+
 double Token::to_f64() const {
     return std::get<double>(value_);
 }
@@ -17,6 +17,7 @@
 
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <variant>
 
 #include "src/tint/source.h"
@@ -298,11 +299,6 @@ class Token {
     /// @param type the Token::Type of the token
     /// @param source the source of the token
     /// @param str the source string for the token
-    Token(Type type, const Source& source, const std::string& str);
-    /// Create a string Token
-    /// @param type the Token::Type of the token
-    /// @param source the source of the token
-    /// @param str the source string for the token
     Token(Type type, const Source& source, const char* str);
     /// Create a integer Token of the given type
     /// @param type the Token::Type of the token
@@ -314,9 +310,6 @@ class Token {
     /// @param source the source of the token
     /// @param val the source double for the token
     Token(Type type, const Source& source, double val);
-    /// Move constructor
-    Token(Token&&);
-    ~Token();
 
     /// Equality operator with an identifier
     /// @param ident the identifier string
@@ -388,6 +381,10 @@ class Token {
     /// Returns the string value of the token
     /// @return std::string
     std::string to_str() const;
+    /// Returns the string value of an identifier or error token, without copying it. An empty
+    /// string is returned for all other token types.
+    /// @return std::string_view
+    std::string_view to_str_view() const;
     /// Returns the float value of the token. 0 is returned if the token does not
     /// contain a float value.
     /// @return double
@@ -405,10 +402,13 @@ class Token {
     Type type_ = Type::kError;
     /// The source where the token appeared
     Source source_;
-    /// The value represented by the token
-    std::variant<int64_t, double, std::string, std::string_view> value_;
+    /// The value represented by the token. Strings are not owned by the token: identifiers
+    /// reference the source file content, and error messages string literals or the Lexer.
+    std::variant<int64_t, double, std::string_view> value_;
 };
 
+static_assert(std::is_trivially_copyable_v<Token>, "Token should be cheap to copy");
+
 #ifndef NDEBUG
 inline std::ostream& operator<<(std::ostream& out, Token::Type type) {
     out << Token::TypeToName(type);
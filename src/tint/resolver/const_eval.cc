@@ -21,6 +21,7 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "src/tint/program_builder.h"
 #include "src/tint/sem/abstract_float.h"
@@ -139,6 +140,44 @@ inline bool IsPositiveZero(T value) {
     return Number<N>(value) == Number<N>(0);  // Considers sign bit
 }
 
+/// ConvertValue attempts to convert the scalar or abstract-numeric `value` of type `T` to the type
+/// `TO`. Values that cannot be represented by a concrete type are clamped, as per
+/// https://www.w3.org/TR/WGSL/#floating-point-conversion. On materialization failure,
+/// ConvertValue() creates a new diagnostic message and returns a Failure.
+template <typename TO, typename T>
+utils::Result<TO> ConvertValue(ProgramBuilder& builder,
+                               T value,
+                               const sem::Type* target_ty,
+                               const Source& source) {
+    TINT_BEGIN_DISABLE_WARNING(UNREACHABLE_CODE);
+    if constexpr (std::is_same_v<TO, bool>) {
+        // [x -> bool]
+        return !IsPositiveZero(value);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        // [bool -> x]
+        return TO(value ? 1 : 0);
+    } else if (auto conv = CheckedConvert<TO>(value)) {
+        // Conversion success
+        return conv.Get();
+        // --- Below this point are the failure cases ---
+    } else if constexpr (std::is_same_v<T, AInt> || std::is_same_v<T, AFloat>) {
+        // [abstract-numeric -> x] - materialization failure
+        std::stringstream ss;
+        ss << "value " << value << " cannot be represented as ";
+        ss << "'" << builder.FriendlyName(target_ty) << "'";
+        builder.Diagnostics().add_error(tint::diag::System::Resolver, ss.str(), source);
+        return utils::Failure;
+    } else if constexpr (IsFloatingPoint<UnwrapNumber<TO>>) {
+        // [x -> floating-point] - number not exactly representable
+        return conv.Failure() == ConversionFailure::kExceedsNegativeLimit ? -TO::Inf() : TO::Inf();
+    } else {
+        // [x -> integer] - number not exactly representable
+        return conv.Failure() == ConversionFailure::kExceedsNegativeLimit ? TO::Lowest()
+                                                                          : TO::Highest();
+    }
+    TINT_END_DISABLE_WARNING(UNREACHABLE_CODE);
+}
+
 /// Constant inherits from sem::Constant to add an private implementation method for conversion.
 struct Constant : public sem::Constant {
     /// Convert attempts to convert the constant value to the given type. On error, Convert()
@@ -153,6 +192,12 @@ const Constant* CreateComposite(ProgramBuilder& builder,
                                 const sem::Type* type,
                                 utils::VectorRef<const sem::Constant*> elements);
 
+// Forward declaration
+utils::Result<const Constant*> ConvertToDense(ProgramBuilder& builder,
+                                              const sem::Constant* value,
+                                              const sem::Type* target_ty,
+                                              const Source& source);
+
 /// Element holds a single scalar or abstract-numeric value.
 /// Element implements the Constant interface.
 template <typename T>
@@ -179,60 +224,26 @@ struct Element : Constant {
     utils::Result<const Constant*> Convert(ProgramBuilder& builder,
                                            const sem::Type* target_ty,
                                            const Source& source) const override {
-        TINT_BEGIN_DISABLE_WARNING(UNREACHABLE_CODE);
         if (target_ty == type) {
             // If the types are identical, then no conversion is needed.
             return this;
         }
         bool failed = false;
         auto* res = ZeroTypeDispatch(target_ty, [&](auto zero_to) -> const Constant* {
-            // `T` is the source type, `value` is the source value.
             // `TO` is the target type.
             using TO = std::decay_t<decltype(zero_to)>;
-            if constexpr (std::is_same_v<TO, bool>) {
-                // [x -> bool]
-                return builder.create<Element<TO>>(target_ty, !IsPositiveZero(value));
-            } else if constexpr (std::is_same_v<T, bool>) {
-                // [bool -> x]
-                return builder.create<Element<TO>>(target_ty, TO(value ? 1 : 0));
-            } else if (auto conv = CheckedConvert<TO>(value)) {
-                // Conversion success
-                return builder.create<Element<TO>>(target_ty, conv.Get());
-                // --- Below this point are the failure cases ---
-            } else if constexpr (std::is_same_v<T, AInt> || std::is_same_v<T, AFloat>) {
-                // [abstract-numeric -> x] - materialization failure
-                std::stringstream ss;
-                ss << "value " << value << " cannot be represented as ";
-                ss << "'" << builder.FriendlyName(target_ty) << "'";
-                builder.Diagnostics().add_error(tint::diag::System::Resolver, ss.str(), source);
+            auto conv = ConvertValue<TO>(builder, value, target_ty, source);
+            if (!conv) {
                 failed = true;
-            } else if constexpr (IsFloatingPoint<UnwrapNumber<TO>>) {
-                // [x -> floating-point] - number not exactly representable
-                // https://www.w3.org/TR/WGSL/#floating-point-conversion
-                switch (conv.Failure()) {
-                    case ConversionFailure::kExceedsNegativeLimit:
-                        return builder.create<Element<TO>>(target_ty, -TO::Inf());
-                    case ConversionFailure::kExceedsPositiveLimit:
-                        return builder.create<Element<TO>>(target_ty, TO::Inf());
-                }
-            } else {
-                // [x -> integer] - number not exactly representable
-                // https://www.w3.org/TR/WGSL/#floating-point-conversion
-                switch (conv.Failure()) {
-                    case ConversionFailure::kExceedsNegativeLimit:
-                        return builder.create<Element<TO>>(target_ty, TO::Lowest());
-                    case ConversionFailure::kExceedsPositiveLimit:
-                        return builder.create<Element<TO>>(target_ty, TO::Highest());
-                }
+                return nullptr;
             }
-            return nullptr;  // Expression is not constant.
+            return builder.create<Element<TO>>(target_ty, conv.Get());
         });
         if (failed) {
             // A diagnostic error has been raised, and resolving should abort.
             return utils::Failure;
         }
         return res;
-        TINT_END_DISABLE_WARNING(UNREACHABLE_CODE);
     }
 
     sem::Type const* const type;
@@ -301,8 +312,15 @@ struct Composite : Constant {
     utils::Result<const Constant*> Convert(ProgramBuilder& builder,
                                            const sem::Type* target_ty,
                                            const Source& source) const override {
+        if (target_ty == type) {
+            // If the types are identical, then no conversion is needed.
+            return this;
+        }
         // Convert each of the composite element types.
         auto* el_ty = sem::Type::ElementOf(target_ty);
+        if (el_ty->is_scalar()) {
+            return ConvertToDense(builder, this, target_ty, source);
+        }
         utils::Vector<const sem::Constant*, 4> conv_els;
         conv_els.Reserve(elements.Length());
         for (auto* el : elements) {
@@ -335,6 +353,138 @@ struct Composite : Constant {
     const size_t hash;
 };
 
+/// DenseComposite holds the differing scalar values of a vector or array in a single contiguous
+/// buffer of Elements, instead of a separately allocated Element for each value.
+/// DenseComposite is used for the result of converting a composite of scalars, such as the
+/// materialization of an abstract-numeric array, which may hold thousands of values.
+/// Use CreateDenseComposite() to create the appropriate Constant type.
+/// DenseComposite implements the Constant interface.
+template <typename T>
+struct DenseComposite : Constant {
+    DenseComposite(const sem::Type* t,
+                   const sem::Type* el_t,
+                   utils::VectorRef<T> values,
+                   bool all_0,
+                   bool any_0)
+        : type(t), elements(MakeElements(el_t, values)), all_zero(all_0), any_zero(any_0) {
+        // Hashed as a Composite, so that the hash of equal constants is equal.
+        hash = utils::Hash(type, all_zero, any_zero);
+        for (auto& el : elements) {
+            utils::HashCombine(&hash, el.Hash());
+        }
+    }
+    ~DenseComposite() override = default;
+    const sem::Type* Type() const override { return type; }
+    std::variant<std::monostate, AInt, AFloat> Value() const override { return {}; }
+    const sem::Constant* Index(size_t i) const override {
+        return i < elements.size() ? &elements[i] : nullptr;
+    }
+    bool AllZero() const override { return all_zero; }
+    bool AnyZero() const override { return any_zero; }
+    bool AllEqual() const override { return false; /* otherwise this should be a Splat */ }
+    size_t Hash() const override { return hash; }
+
+    utils::Result<const Constant*> Convert(ProgramBuilder& builder,
+                                           const sem::Type* target_ty,
+                                           const Source& source) const override {
+        if (target_ty == type) {
+            // If the types are identical, then no conversion is needed.
+            return this;
+        }
+        return ConvertToDense(builder, this, target_ty, source);
+    }
+
+    static std::vector<Element<T>> MakeElements(const sem::Type* el_t, utils::VectorRef<T> values) {
+        std::vector<Element<T>> els;
+        els.reserve(values.Length());
+        for (auto v : values) {
+            els.emplace_back(el_t, v);
+        }
+        return els;
+    }
+
+    sem::Type const* const type;
+    const std::vector<Element<T>> elements;
+    const bool all_zero;
+    const bool any_zero;
+    size_t hash;
+};
+
+/// CreateDenseComposite is used to construct a constant of a vector or array type, with the
+/// scalar element values `values` of the element type `el_ty`.
+/// CreateDenseComposite examines the values and will return either a DenseComposite or a Splat.
+template <typename T>
+const Constant* CreateDenseComposite(ProgramBuilder& builder,
+                                     const sem::Type* type,
+                                     const sem::Type* el_ty,
+                                     utils::VectorRef<T> values) {
+    if (values.IsEmpty()) {
+        return nullptr;
+    }
+    bool any_zero = false;
+    bool all_zero = true;
+    bool all_equal = true;
+    auto first = values.Front();
+    for (auto v : values) {
+        if (IsPositiveZero(v)) {
+            any_zero = true;
+        } else {
+            all_zero = false;
+        }
+        if (all_equal && v != first) {
+            all_equal = false;
+        }
+    }
+    if (all_equal) {
+        return builder.create<Splat>(type, builder.create<Element<T>>(el_ty, first),
+                                     values.Length());
+    }
+    return builder.create<DenseComposite<T>>(type, el_ty, std::move(values), all_zero, any_zero);
+}
+
+/// ConvertToDense converts the vector or array of scalars `value` to the type `target_ty`.
+/// The converted values are held by a single DenseComposite, or a Splat if all the values are
+/// equal. On error, ConvertToDense() creates a new diagnostic message and returns a Failure.
+utils::Result<const Constant*> ConvertToDense(ProgramBuilder& builder,
+                                              const sem::Constant* value,
+                                              const sem::Type* target_ty,
+                                              const Source& source) {
+    uint32_t n = 0;
+    auto* el_ty = sem::Type::ElementOf(target_ty, &n);
+    auto* from_el_ty = sem::Type::ElementOf(value->Type());
+    bool failed = false;
+    auto* res = ZeroTypeDispatch(el_ty, [&](auto zero_to) -> const Constant* {
+        // `TO` is the target element type.
+        using TO = std::decay_t<decltype(zero_to)>;
+        utils::Vector<TO, 16> values;
+        values.Reserve(n);
+        ZeroTypeDispatch(from_el_ty, [&](auto zero_from) {
+            // `FROM` is the source element type.
+            // Note: This file is the only place where `sem::Constant`s are created, so this
+            // static_cast is safe.
+            using FROM = std::decay_t<decltype(zero_from)>;
+            for (uint32_t i = 0; i < n && !failed; i++) {
+                auto* el = static_cast<const Element<FROM>*>(value->Index(i));
+                auto conv = ConvertValue<TO>(builder, el->value, el_ty, source);
+                if (!conv) {
+                    failed = true;
+                    break;
+                }
+                values.Push(conv.Get());
+            }
+        });
+        if (failed) {
+            return nullptr;
+        }
+        return CreateDenseComposite<TO>(builder, target_ty, el_ty, std::move(values));
+    });
+    if (failed) {
+        // A diagnostic error has been raised, and resolving should abort.
+        return utils::Failure;
+    }
+    return res;
+}
+
 /// CreateElement constructs and returns an Element<T>.
 template <typename T>
 const Constant* CreateElement(ProgramBuilder& builder, const sem::Type* t, T v) {
@@ -833,10 +983,17 @@ utils::Result<const sem::Constant*> ConstEval::Convert(const sem::Type* target_t
     if (value->Type() == target_ty) {
         return value;
     }
+    ConversionKey key{value, target_ty};
+    if (auto* cached = utils::Lookup(conversions, key)) {
+        return cached;
+    }
     auto conv = static_cast<const Constant*>(value)->Convert(builder, target_ty, source);
     if (!conv) {
         return utils::Failure;
     }
+    if (conv.Get()) {
+        conversions.emplace(key, conv.Get());
+    }
     return conv.Get();
 }
 
@@ -17,7 +17,10 @@
 
 #include <stddef.h>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
+#include "src/tint/utils/hash.h"
 #include "src/tint/utils/result.h"
 #include "src/tint/utils/vector.h"
 
@@ -250,7 +253,23 @@ class ConstEval {
     /// Adds the given warning message to the diagnostics
     void AddWarning(const std::string& msg, const Source& source) const;
 
+    /// The key of the memoized results of Convert(): the constant and the target type
+    using ConversionKey = std::pair<const sem::Constant*, const sem::Type*>;
+
+    /// ConversionKeyHasher provides a hash function for the ConversionKey
+    struct ConversionKeyHasher {
+        /// @param k the ConversionKey to create a hash for
+        /// @return the hash value
+        inline std::size_t operator()(const ConversionKey& k) const {
+            return utils::Hash(k.first, k.second);
+        }
+    };
+
     ProgramBuilder& builder;
+
+    /// The memoized results of Convert(). Abstract-numeric constants, such as a module-scope
+    /// lookup table, are materialized to the same type at each use.
+    std::unordered_map<ConversionKey, const sem::Constant*, ConversionKeyHasher> conversions;
 };
 
 }  // namespace tint::resolver
@@ -20,6 +20,7 @@
 #include "src/tint/sem/builtin_type.h"
 #include "src/tint/sem/expression.h"
 #include "src/tint/sem/index_accessor_expression.h"
+#include "src/tint/sem/materialize.h"
 #include "src/tint/sem/member_accessor_expression.h"
 #include "src/tint/sem/test_helper.h"
 #include "src/tint/utils/transform.h"
@@ -1968,6 +1969,76 @@ TEST_F(ResolverConstEvalTest, Array_Struct_f32_Elements) {
     EXPECT_EQ(sem->ConstantValue()->Index(1)->Index(1)->As<f32>(), 4_f);
 }
 
+TEST_F(ResolverConstEvalTest, Array_Materialize_Elements) {
+    // const a = array(1.0, 0.0, 3.5, 4.0);
+    // let b : array<f32, 4> = a;
+    GlobalConst("a", nullptr, Construct(ty.array(nullptr, nullptr), 1.0_a, 0.0_a, 3.5_a, 4.0_a));
+    auto* expr = Expr("a");
+    auto* constructed = Construct(ty.array<f32, 4>(), 1_f, 0_f, 3.5_f, 4_f);
+    WrapInFunction(Let("b", ty.array<f32, 4>(), expr), constructed);
+
+    EXPECT_TRUE(r()->Resolve()) << r()->error();
+
+    auto* sem = Sem().Get<sem::Materialize>(expr);
+    ASSERT_NE(sem, nullptr);
+    auto* arr = sem->Type()->As<sem::Array>();
+    ASSERT_NE(arr, nullptr);
+    EXPECT_TRUE(arr->ElemType()->Is<sem::F32>());
+    EXPECT_EQ(arr->Count(), 4u);
+    EXPECT_TYPE(sem->ConstantValue()->Type(), sem->Type());
+    EXPECT_FALSE(sem->ConstantValue()->AllEqual());
+    EXPECT_TRUE(sem->ConstantValue()->AnyZero());
+    EXPECT_FALSE(sem->ConstantValue()->AllZero());
+    EXPECT_EQ(sem->ConstantValue()->Index(4), nullptr);
+
+    EXPECT_TYPE(sem->ConstantValue()->Index(0)->Type(), arr->ElemType());
+    EXPECT_TRUE(sem->ConstantValue()->Index(0)->AllEqual());
+    EXPECT_FALSE(sem->ConstantValue()->Index(0)->AnyZero());
+    EXPECT_FALSE(sem->ConstantValue()->Index(0)->AllZero());
+    EXPECT_EQ(sem->ConstantValue()->Index(0)->As<f32>(), 1_f);
+
+    EXPECT_TRUE(sem->ConstantValue()->Index(1)->AllEqual());
+    EXPECT_TRUE(sem->ConstantValue()->Index(1)->AnyZero());
+    EXPECT_TRUE(sem->ConstantValue()->Index(1)->AllZero());
+    EXPECT_EQ(sem->ConstantValue()->Index(1)->As<f32>(), 0_f);
+
+    EXPECT_EQ(sem->ConstantValue()->Index(2)->As<f32>(), 3.5_f);
+    EXPECT_EQ(sem->ConstantValue()->Index(3)->As<f32>(), 4_f);
+
+    // The materialized constant hashes as the constant constructed from the same elements.
+    EXPECT_EQ(Sem().Get(constructed)->ConstantValue()->Hash(), sem->ConstantValue()->Hash());
+}
+
+TEST_F(ResolverConstEvalTest, Array_Materialize_AllEqual) {
+    // const a = array(2, 2, 2);
+    // let b : array<u32, 3> = a;
+    GlobalConst("a", nullptr, Construct(ty.array(nullptr, nullptr), 2_a, 2_a, 2_a));
+    auto* expr = Expr("a");
+    WrapInFunction(Let("b", ty.array<u32, 3>(), expr));
+
+    EXPECT_TRUE(r()->Resolve()) << r()->error();
+
+    auto* sem = Sem().Get<sem::Materialize>(expr);
+    ASSERT_NE(sem, nullptr);
+    EXPECT_TYPE(sem->ConstantValue()->Type(), sem->Type());
+    EXPECT_TRUE(sem->ConstantValue()->AllEqual());
+    EXPECT_FALSE(sem->ConstantValue()->AnyZero());
+    EXPECT_FALSE(sem->ConstantValue()->AllZero());
+    EXPECT_EQ(sem->ConstantValue()->Index(0)->As<u32>(), 2_u);
+    EXPECT_EQ(sem->ConstantValue()->Index(2)->As<u32>(), 2_u);
+    EXPECT_EQ(sem->ConstantValue()->Index(3), nullptr);
+}
+
+TEST_F(ResolverConstEvalTest, Array_Materialize_Unrepresentable) {
+    // const a = array(1, -1);
+    // let b : array<u32, 2> = a;
+    GlobalConst("a", nullptr, Construct(ty.array(nullptr, nullptr), 1_a, -1_a));
+    WrapInFunction(Let("b", ty.array<u32, 2>(), Expr(Source{{12, 34}}, "a")));
+
+    EXPECT_FALSE(r()->Resolve());
+    EXPECT_EQ(r()->error(), "12:34 error: value -1 cannot be represented as 'u32'");
+}
+
 TEST_F(ResolverConstEvalTest, Struct_I32s_ZeroInit) {
     Structure(
         "S", utils::Vector{Member("m1", ty.i32()), Member("m2", ty.i32()), Member("m3", ty.i32())});
@@ -491,6 +491,7 @@ struct DependencyAnalysis {
     bool Run(const ast::Module& module) {
         // Reserve container memory
         graph_.resolved_symbols.reserve(module.GlobalDeclarations().Length());
+        graph_.global_dependencies.reserve(module.GlobalDeclarations().Length());
         sorted_.reserve(module.GlobalDeclarations().Length());
 
         // Collect all the named globals from the AST module
@@ -499,6 +500,15 @@ struct DependencyAnalysis {
         // Traverse the named globals to build the dependency graph
         DetermineDependencies();
 
+        // Record the direct dependencies of each global
+        for (auto* global : declaration_order_) {
+            auto& deps = graph_.global_dependencies[global->node];
+            deps.reserve(global->deps.size());
+            for (auto* dep : global->deps) {
+                deps.emplace_back(dep->node);
+            }
+        }
+
         // Sort the globals into dependency order
         SortGlobals();
 
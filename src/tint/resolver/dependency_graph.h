@@ -48,6 +48,10 @@ struct DependencyGraph {
     /// All globals in dependency-sorted order.
     std::vector<const ast::Node*> ordered_globals;
 
+    /// Map of each module-scope declaration to the module-scope declarations that it directly
+    /// depends on, in the order that the dependencies are first referenced.
+    std::unordered_map<const ast::Node*, std::vector<const ast::Node*>> global_dependencies;
+
     /// Map of ast::IdentifierExpression or ast::TypeName to a type, function, or
     /// variable that declares the symbol.
     std::unordered_map<const ast::Node*, const ast::Node*> resolved_symbols;
@@ -1102,6 +1102,37 @@ TEST_F(ResolverDependencyGraphOrderedGlobalsTest, EnableFirst) {
 }
 }  // namespace ordered_globals
 
+////////////////////////////////////////////////////////////////////////////////
+// Global dependencies tests
+////////////////////////////////////////////////////////////////////////////////
+namespace global_dependencies {
+
+using ResolverDependencyGraphGlobalDependenciesTest = ResolverDependencyGraphTest;
+
+TEST_F(ResolverDependencyGraphGlobalDependenciesTest, DirectDependencies) {
+    // struct S { m : i32 }
+    // var<private> v : S;
+    // fn a() -> i32 { return v.m; }
+    // fn b() -> i32 { return a() + v.m; }
+    // fn c() {}
+    auto* s = Structure("S", utils::Vector{Member("m", ty.i32())});
+    auto* v = GlobalVar("v", ty.type_name("S"), ast::StorageClass::kPrivate);
+    auto* a = Func("a", utils::Empty, ty.i32(),
+                   utils::Vector{Return(MemberAccessor("v", "m"))});
+    auto* b = Func("b", utils::Empty, ty.i32(),
+                   utils::Vector{Return(Add(Call("a"), MemberAccessor("v", "m")))});
+    auto* c = Func("c", utils::Empty, ty.void_(), utils::Empty);
+
+    auto graph = Build();
+    EXPECT_THAT(graph.global_dependencies[s], ElementsAre());
+    EXPECT_THAT(graph.global_dependencies[v], ElementsAre(s));
+    EXPECT_THAT(graph.global_dependencies[a], ElementsAre(v));
+    EXPECT_THAT(graph.global_dependencies[b], ElementsAre(a, v));
+    EXPECT_THAT(graph.global_dependencies[c], ElementsAre());
+}
+
+}  // namespace global_dependencies
+
 ////////////////////////////////////////////////////////////////////////////////
 // Resolved symbols tests
 ////////////////////////////////////////////////////////////////////////////////
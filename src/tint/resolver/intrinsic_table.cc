@@ -962,6 +962,43 @@ bool operator==(const IntrinsicPrototype& a, const IntrinsicPrototype& b) {
     return true;
 }
 
+/// MatchKey is the key of the memoized results of Impl::MatchIntrinsic()
+struct MatchKey {
+    /// Hasher provides a hash function for the MatchKey
+    struct Hasher {
+        /// @param k the MatchKey to create a hash for
+        /// @return the hash value
+        inline std::size_t operator()(const MatchKey& k) const {
+            size_t hash = utils::Hash(k.intrinsic, k.template_type, k.args.Length());
+            for (auto* arg : k.args) {
+                utils::HashCombine(&hash, arg);
+            }
+            return hash;
+        }
+    };
+
+    /// The intrinsic being called
+    const IntrinsicInfo* intrinsic = nullptr;
+    /// The explicit template type, or nullptr
+    const sem::Type* template_type = nullptr;
+    /// The argument types
+    utils::Vector<const sem::Type*, kNumFixedParams> args;
+};
+
+/// Equality operator for MatchKey
+bool operator==(const MatchKey& a, const MatchKey& b) {
+    if (a.intrinsic != b.intrinsic || a.template_type != b.template_type ||
+        a.args.Length() != b.args.Length()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.args.Length(); i++) {
+        if (a.args[i] != b.args[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /// Impl is the private implementation of the IntrinsicTable interface.
 class Impl : public IntrinsicTable {
   public:
@@ -1013,6 +1050,8 @@ class Impl : public IntrinsicTable {
     }
 
     /// Attempts to find a single intrinsic overload that matches the provided argument types.
+    /// Successful matches are memoized, so repeated calls with the same intrinsic and argument
+    /// types do not evaluate the overloads again.
     /// @param intrinsic the intrinsic being called
     /// @param intrinsic_name the name of the intrinsic
     /// @param args the argument types
@@ -1028,7 +1067,7 @@ class Impl : public IntrinsicTable {
                                       const char* intrinsic_name,
                                       utils::VectorRef<const sem::Type*> args,
                                       TemplateState templates,
-                                      OnNoMatch on_no_match) const;
+                                      OnNoMatch on_no_match);
 
     /// Evaluates the single overload for the provided argument types.
     /// @param overload the overload being considered
@@ -1087,6 +1126,7 @@ class Impl : public IntrinsicTable {
         constructors;
     std::unordered_map<IntrinsicPrototype, sem::TypeConversion*, IntrinsicPrototype::Hasher>
         converters;
+    std::unordered_map<MatchKey, IntrinsicPrototype, MatchKey::Hasher> matches;
 };
 
 /// @return a string representing a call to a builtin with the given argument
@@ -1383,7 +1423,14 @@ IntrinsicPrototype Impl::MatchIntrinsic(const IntrinsicInfo& intrinsic,
                                         const char* intrinsic_name,
                                         utils::VectorRef<const sem::Type*> args,
                                         TemplateState templates,
-                                        OnNoMatch on_no_match) const {
+                                        OnNoMatch on_no_match) {
+    // The only template type that may be specified by the caller is the 0'th, for constructors.
+    MatchKey key{&intrinsic, templates.Type(0), {}};
+    key.args = args;
+    if (auto cached = matches.find(key); cached != matches.end()) {
+        return cached->second;
+    }
+
     size_t num_matched = 0;
     size_t match_idx = 0;
     utils::Vector<Candidate, kNumFixedCandidates> candidates;
@@ -1431,7 +1478,9 @@ IntrinsicPrototype Impl::MatchIntrinsic(const IntrinsicInfo& intrinsic,
         return_type = builder.create<sem::Void>();
     }
 
-    return IntrinsicPrototype{match.overload, return_type, std::move(match.parameters)};
+    IntrinsicPrototype prototype{match.overload, return_type, std::move(match.parameters)};
+    matches.emplace(std::move(key), prototype);
+    return prototype;
 }
 
 Impl::Candidate Impl::ScoreOverload(const OverloadInfo* overload,
@@ -600,6 +600,34 @@ TEST_F(IntrinsicTableTest, SameOverloadReturnsSameBuiltinPointer) {
     EXPECT_NE(b.sem, c.sem);
 }
 
+TEST_F(IntrinsicTableTest, RepeatedMismatchRaisesErrorEachTime) {
+    auto* i32 = create<sem::I32>();
+    auto a = table->Lookup(BuiltinType::kCos, utils::Vector{i32}, Source{{1, 2}});
+    ASSERT_EQ(a.sem, nullptr);
+    auto b = table->Lookup(BuiltinType::kCos, utils::Vector{i32}, Source{{3, 4}});
+    ASSERT_EQ(b.sem, nullptr);
+    ASSERT_EQ(Diagnostics().error_count(), 2u);
+    EXPECT_THAT(Diagnostics().str(), HasSubstr("1:2 error: no matching call to cos(i32)"));
+    EXPECT_THAT(Diagnostics().str(), HasSubstr("3:4 error: no matching call to cos(i32)"));
+}
+
+TEST_F(IntrinsicTableTest, RepeatedTypeConstructorWithDifferentTemplateArg) {
+    auto* i32 = create<sem::I32>();
+    auto* f32 = create<sem::F32>();
+    auto a = table->Lookup(CtorConvIntrinsic::kVec3, nullptr, utils::Vector{i32, i32, i32},
+                           Source{{12, 34}});
+    ASSERT_NE(a.target, nullptr) << Diagnostics().str();
+    auto b = table->Lookup(CtorConvIntrinsic::kVec3, i32, utils::Vector{i32, i32, i32},
+                           Source{{12, 34}});
+    ASSERT_NE(b.target, nullptr) << Diagnostics().str();
+    EXPECT_EQ(a.target, b.target);
+    auto c = table->Lookup(CtorConvIntrinsic::kVec3, f32, utils::Vector{i32, i32, i32},
+                           Source{{12, 34}});
+    EXPECT_EQ(c.target, nullptr);
+    EXPECT_THAT(Diagnostics().str(),
+                HasSubstr("no matching constructor for vec3<f32>(i32, i32, i32)"));
+}
+
 TEST_F(IntrinsicTableTest, MatchUnaryOp) {
     auto* i32 = create<sem::I32>();
     auto* vec3_i32 = create<sem::Vector>(i32, 3u);
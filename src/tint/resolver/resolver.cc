@@ -89,8 +89,9 @@
 
 namespace tint::resolver {
 
-Resolver::Resolver(ProgramBuilder* builder)
+Resolver::Resolver(ProgramBuilder* builder, size_t max_threads /* = 1 */)
     : builder_(builder),
+      max_threads_(max_threads),
       diagnostics_(builder->Diagnostics()),
       const_eval_(*builder),
       intrinsic_table_(IntrinsicTable::Create(*builder)),
@@ -165,7 +166,7 @@ bool Resolver::ResolveInternal() {
     }
 
     if (!enabled_extensions_.contains(ast::Extension::kChromiumDisableUniformityAnalysis)) {
-        if (!AnalyzeUniformity(builder_, dependencies_)) {
+        if (!AnalyzeUniformity(builder_, dependencies_, max_threads_)) {
             // TODO(jrprice): Reject programs that fail uniformity analysis.
         }
     }
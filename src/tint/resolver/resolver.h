@@ -80,7 +80,11 @@ class Resolver {
   public:
     /// Constructor
     /// @param builder the program builder
-    explicit Resolver(ProgramBuilder* builder);
+    /// @param max_threads the maximum number of threads used to resolve the program, or 0 to use
+    /// the number of hardware threads. If greater than 1, the uniformity of functions that do not
+    /// call each other is analyzed concurrently.
+    /// The resolved program and diagnostics do not depend on the number of threads.
+    explicit Resolver(ProgramBuilder* builder, size_t max_threads = 1);
 
     /// Destructor
     ~Resolver();
@@ -450,6 +454,7 @@ class Resolver {
         utils::UnorderedKeyWrapper<std::tuple<const sem::Struct*, size_t, sem::EvaluationStage>>;
 
     ProgramBuilder* const builder_;
+    const size_t max_threads_;
     diag::List& diagnostics_;
     ConstEval const_eval_;
     std::unique_ptr<IntrinsicTable> const intrinsic_table_;
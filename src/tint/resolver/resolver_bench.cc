@@ -0,0 +1,175 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sstream>
+#include <string>
+
+#include "src/tint/reader/wgsl/parser_impl.h"
+#include "src/tint/resolver/resolver.h"
+
+// Included after the internal headers, as it includes tint/tint.h.
+#include "src/tint/bench/benchmark.h"
+
+namespace tint::resolver {
+namespace {
+
+/// Resolves `file` on each iteration of the benchmark, excluding the time taken to parse it.
+/// @param state the benchmark state
+/// @param file the WGSL source to resolve
+/// @param max_threads the maximum number of threads used by the resolver
+void Resolve(benchmark::State& state, const Source::File& file, size_t max_threads = 1) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        reader::wgsl::ParserImpl parser(&file);
+        parser.Parse();
+        state.ResumeTiming();
+
+        Resolver resolver(&parser.builder(), max_threads);
+        if (!resolver.Resolve()) {
+            state.SkipWithError(resolver.error().c_str());
+        }
+    }
+}
+
+/// @returns a module with `num_functions` functions. Each function calls the function with half
+/// its index, so most of the functions can be analyzed independently of each other.
+std::string GenerateModule(int64_t num_functions) {
+    std::stringstream wgsl;
+    wgsl << "@group(0) @binding(0) var<storage, read_write> output : array<i32>;\n\n";
+    for (int64_t i = 0; i < num_functions; i++) {
+        wgsl << "fn func" << i << "(a : i32) -> i32 {\n";
+        wgsl << "  var x = a;\n";
+        wgsl << "  for (var i = 0; i < a; i++) {\n";
+        wgsl << "    if (x > " << i << ") {\n";
+        wgsl << "      x = x * 2 + output[i];\n";
+        wgsl << "    } else {\n";
+        wgsl << "      x = x - 1;\n";
+        wgsl << "    }\n";
+        wgsl << "  }\n";
+        wgsl << "  workgroupBarrier();\n";
+        if (i > 0) {
+            wgsl << "  x = x + func" << (i / 2) << "(a);\n";
+        }
+        wgsl << "  return x;\n";
+        wgsl << "}\n\n";
+    }
+    wgsl << "@compute @workgroup_size(1)\n";
+    wgsl << "fn main() {\n";
+    wgsl << "  output[0] = func" << (num_functions - 1) << "(4);\n";
+    wgsl << "}\n";
+    return wgsl.str();
+}
+
+/// Resolves a module with state.range(0) functions on a single thread.
+void ResolveSequential(benchmark::State& state) {
+    Resolve(state, Source::File("test.wgsl", GenerateModule(state.range(0))), 1);
+}
+
+/// Resolves a module with state.range(0) functions, using up to 8 threads.
+void ResolveConcurrent(benchmark::State& state) {
+    Resolve(state, Source::File("test.wgsl", GenerateModule(state.range(0))), 8);
+}
+
+BENCHMARK(ResolveSequential)->Arg(100)->Arg(500)->Arg(1000);
+BENCHMARK(ResolveConcurrent)->Arg(100)->Arg(500)->Arg(1000);
+
+/// @returns a module with two abstract-numeric constant arrays of `size` elements, used as lookup
+/// tables by an entry point. Each use of a table materializes the whole array.
+std::string GenerateLookupTableModule(int64_t size) {
+    std::stringstream wgsl;
+    wgsl << "const floats = array(";
+    for (int64_t i = 0; i < size; i++) {
+        wgsl << (i > 0 ? ", " : "") << i << ".5";
+    }
+    wgsl << ");\n";
+    wgsl << "const ints = array(";
+    for (int64_t i = 0; i < size; i++) {
+        wgsl << (i > 0 ? ", " : "") << i * 3;
+    }
+    wgsl << ");\n\n";
+    wgsl << "@group(0) @binding(0) var<storage, read_write> output : array<f32>;\n\n";
+    wgsl << "@compute @workgroup_size(1)\n";
+    wgsl << "fn main(@builtin(local_invocation_index) idx : u32) {\n";
+    for (int64_t i = 0; i < 8; i++) {
+        wgsl << "  output[" << i << "] = floats[idx + " << i << "u] + f32(ints[idx]);\n";
+    }
+    wgsl << "}\n";
+    return wgsl.str();
+}
+
+/// Resolves a module with abstract-numeric lookup tables of state.range(0) elements.
+void ResolveLookupTables(benchmark::State& state) {
+    Resolve(state, Source::File("test.wgsl", GenerateLookupTableModule(state.range(0))));
+}
+
+BENCHMARK(ResolveLookupTables)->Arg(256)->Arg(1024)->Arg(4096);
+
+/// @returns a module with an entry point that declares 64 variables, followed by `depth` levels of
+/// nested if-else statements and for-loops that assign to the variables.
+std::string GenerateDeepControlFlowModule(int64_t depth) {
+    constexpr int64_t kNumVars = 64;
+    std::stringstream wgsl;
+    wgsl << "@group(0) @binding(0) var<storage, read_write> output : array<i32>;\n\n";
+    wgsl << "@compute @workgroup_size(1)\n";
+    wgsl << "fn main(@builtin(local_invocation_index) idx : u32) {\n";
+    for (int64_t i = 0; i < kNumVars; i++) {
+        wgsl << "  var v" << i << " = " << i << ";\n";
+    }
+    for (int64_t d = 0; d < depth; d++) {
+        auto var = "v" + std::to_string(d % kNumVars);
+        auto next = "v" + std::to_string((d + 1) % kNumVars);
+        if (d % 2 == 0) {
+            wgsl << "  if (" << var << " > " << d << ") {\n";
+            wgsl << "    " << var << " = " << next << " + i32(idx);\n";
+            wgsl << "  } else {\n";
+            wgsl << "    " << next << " = " << var << " * 2;\n";
+            wgsl << "  }\n";
+            wgsl << "  if (" << next << " < " << d << ") {\n";
+        } else {
+            auto i = "i" + std::to_string(d);
+            wgsl << "  for (var " << i << " = 0; " << i << " < " << var << "; " << i << "++) {\n";
+            wgsl << "    " << var << " = " << next << " - " << i << ";\n";
+        }
+    }
+    for (int64_t d = 0; d < depth; d++) {
+        wgsl << "  }\n";
+    }
+    for (int64_t i = 0; i < kNumVars; i++) {
+        wgsl << "  output[" << i << "] = v" << i << ";\n";
+    }
+    wgsl << "}\n";
+    return wgsl.str();
+}
+
+/// Resolves a module with state.range(0) levels of nested control flow.
+void ResolveDeepControlFlow(benchmark::State& state) {
+    Resolve(state, Source::File("test.wgsl", GenerateDeepControlFlowModule(state.range(0))));
+}
+
+BENCHMARK(ResolveDeepControlFlow)->Arg(16)->Arg(32)->Arg(64);
+
+/// Resolves the benchmark input program `input_name`, excluding the time taken to parse it.
+void ResolveProgram(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    Resolve(state, std::get<Source::File>(res));
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(ResolveProgram);
+
+}  // namespace
+}  // namespace tint::resolver
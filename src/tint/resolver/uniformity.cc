@@ -14,8 +14,11 @@
 
 #include "src/tint/resolver/uniformity.h"
 
+#include <algorithm>
 #include <limits>
+#include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -23,7 +26,6 @@
 
 #include "src/tint/program_builder.h"
 #include "src/tint/resolver/dependency_graph.h"
-#include "src/tint/scope_stack.h"
 #include "src/tint/sem/block_statement.h"
 #include "src/tint/sem/for_loop_statement.h"
 #include "src/tint/sem/function.h"
@@ -36,8 +38,9 @@
 #include "src/tint/sem/type_conversion.h"
 #include "src/tint/sem/variable.h"
 #include "src/tint/sem/while_statement.h"
+#include "src/tint/utils/bitset.h"
 #include "src/tint/utils/block_allocator.h"
-#include "src/tint/utils/map.h"
+#include "src/tint/utils/parallel_for.h"
 #include "src/tint/utils/unique_vector.h"
 
 // Set to `1` to dump the uniformity graph for each function in graphviz format.
@@ -72,8 +75,9 @@ enum ParameterTag {
 /// single function.
 struct Node {
     /// Constructor
+    /// @param i the index of the node in the function's graph
     /// @param a the corresponding AST node
-    explicit Node(const ast::Node* a) : ast(a) {}
+    Node(uint32_t i, const ast::Node* a) : index(i), ast(a) {}
 
 #if TINT_DUMP_UNIFORMITY_GRAPH
     /// The node tag.
@@ -92,6 +96,9 @@ struct Node {
     /// The type of the node.
     Type type = kRegular;
 
+    /// The index of the node in the function's graph.
+    const uint32_t index;
+
     /// `true` if this node represents a potential control flow change.
     bool affects_control_flow = false;
 
@@ -112,6 +119,175 @@ struct Node {
     void AddEdge(Node* to) { edges.add(to); }
 };
 
+/// VariableScopes maps the variables of a function to their value nodes in the graph, scoped with
+/// respect to control flow, and holds the set of local read-write variables that are in scope.
+///
+/// Each variable is given a dense index when it is first assigned. The current value of each
+/// variable is held in a flat array, and each scope logs the values that it overwrote, which are
+/// restored when the scope is popped. Get() and Set() take constant time, regardless of the depth
+/// of the scope stack.
+class VariableScopes {
+  public:
+    /// An assignment made in a scope
+    struct Assignment {
+        /// The index of the variable
+        uint32_t index;
+        /// The assigned value node
+        Node* value;
+    };
+
+    /// Constructor
+    VariableScopes() { scopes_.push_back(Scope{next_scope_id_++, 0}); }
+
+    /// Push a new scope on to the stack
+    void Push() { scopes_.push_back(Scope{next_scope_id_++, log_.size()}); }
+
+    /// Pop the scope off the top of the stack, restoring the values that it overwrote.
+    /// The outermost scope can not be popped.
+    void Pop() {
+        if (scopes_.size() <= 1) {
+            return;
+        }
+        auto log_start = scopes_.back().log_start;
+        while (log_.size() > log_start) {
+            auto& entry = log_.back();
+            values_[entry.index] = entry.value;
+            assigned_in_[entry.index] = entry.assigned_in;
+            log_.pop_back();
+        }
+        scopes_.pop_back();
+    }
+
+    /// Assigns the value of a variable in the top most scope.
+    /// @param index the index of the variable
+    /// @param value the new value node
+    /// @returns the old value if the variable was assigned in the top most scope, otherwise nullptr
+    Node* Set(uint32_t index, Node* value) {
+        auto scope = scopes_.back().id;
+        if (assigned_in_[index] == scope) {
+            std::swap(values_[index], value);
+            return value;
+        }
+        log_.push_back(LogEntry{index, values_[index], assigned_in_[index]});
+        values_[index] = value;
+        assigned_in_[index] = scope;
+        return nullptr;
+    }
+
+    /// Assigns the value of `var` in the top most scope.
+    /// @param var the variable
+    /// @param value the new value node
+    /// @returns the old value if `var` was assigned in the top most scope, otherwise nullptr
+    Node* Set(const sem::Variable* var, Node* value) { return Set(IndexOf(var), value); }
+
+    /// @param index the index of the variable
+    /// @returns the current value node of the variable
+    Node* Get(uint32_t index) const { return values_[index]; }
+
+    /// @param var the variable
+    /// @returns the current value node of `var`, or nullptr if `var` has not been assigned
+    Node* Get(const sem::Variable* var) const {
+        auto it = indices_.find(var);
+        return it != indices_.end() ? values_[it->second] : nullptr;
+    }
+
+    /// @param var the variable
+    /// @returns the index of `var`, assigning the next index if `var` has not been seen before
+    uint32_t IndexOf(const sem::Variable* var) {
+        auto res = indices_.emplace(var, Count());
+        if (res.second) {
+            vars_.push_back(var);
+            values_.push_back(nullptr);
+            assigned_in_.push_back(kNoScope);
+            locals_in_scope_.Resize(vars_.size());
+        }
+        return res.first->second;
+    }
+
+    /// @param index the index of the variable
+    /// @returns the variable with the given index
+    const sem::Variable* Variable(uint32_t index) const { return vars_[index]; }
+
+    /// @returns the number of variables that have been given an index. Variables are indexed in
+    /// the order that they were first assigned, which for local variables is their declaration.
+    uint32_t Count() const { return static_cast<uint32_t>(vars_.size()); }
+
+    /// @returns the assignments made in the top most scope, ordered by variable index
+    utils::Vector<Assignment, 8> Top() const {
+        utils::Vector<Assignment, 8> assignments;
+        for (size_t i = scopes_.back().log_start; i < log_.size(); i++) {
+            auto index = log_[i].index;
+            assignments.Push(Assignment{index, values_[index]});
+        }
+        std::sort(assignments.begin(), assignments.end(),
+                  [](const Assignment& a, const Assignment& b) { return a.index < b.index; });
+        return assignments;
+    }
+
+    /// Adds a local read-write variable to the set of variables in scope.
+    /// @param var the variable
+    void AddLocal(const sem::Variable* var) {
+        auto index = IndexOf(var);
+        if (!locals_in_scope_[index]) {
+            locals_in_scope_[index] = true;
+            locals_.push_back(index);
+        }
+    }
+
+    /// Removes a local read-write variable from the set of variables in scope.
+    /// @param var the variable
+    void RemoveLocal(const sem::Variable* var) {
+        auto it = indices_.find(var);
+        if (it == indices_.end() || !locals_in_scope_[it->second]) {
+            return;
+        }
+        locals_in_scope_[it->second] = false;
+        // Variables are usually removed in the reverse order that they were added.
+        auto rit = std::find(locals_.rbegin(), locals_.rend(), it->second);
+        locals_.erase(std::next(rit).base());
+    }
+
+    /// @param index the index of the variable
+    /// @returns true if the variable is a local read-write variable that is in scope
+    bool IsLocal(uint32_t index) { return locals_in_scope_[index]; }
+
+    /// @returns the indices of the local read-write variables that are in scope, in declaration
+    /// order. Includes pointer parameters.
+    const std::vector<uint32_t>& Locals() const { return locals_; }
+
+  private:
+    /// The identifier of a scope that is never assigned to a pushed scope
+    static constexpr uint32_t kNoScope = 0xffffffff;
+
+    /// A scope on the stack
+    struct Scope {
+        /// The unique identifier of the scope
+        uint32_t id;
+        /// The start of the entries in #log_ that were made by this scope
+        size_t log_start;
+    };
+
+    /// The value of a variable that was overwritten by the first assignment in a scope
+    struct LogEntry {
+        /// The index of the variable
+        uint32_t index;
+        /// The overwritten value node
+        Node* value;
+        /// The identifier of the scope that assigned the overwritten value
+        uint32_t assigned_in;
+    };
+
+    std::unordered_map<const sem::Variable*, uint32_t> indices_;
+    std::vector<const sem::Variable*> vars_;
+    std::vector<Node*> values_;
+    std::vector<uint32_t> assigned_in_;
+    std::vector<Scope> scopes_;
+    std::vector<LogEntry> log_;
+    uint32_t next_scope_id_ = 0;
+    utils::Bitset<0> locals_in_scope_;
+    std::vector<uint32_t> locals_;
+};
+
 /// ParameterInfo holds information about the uniformity requirements and effects for a particular
 /// function parameter.
 struct ParameterInfo {
@@ -163,7 +339,7 @@ struct FunctionInfo {
             if (sem->Type()->Is<sem::Pointer>()) {
                 node_init = CreateNode("ptrparam_" + name + "_init");
                 parameters[i].pointer_return_value = CreateNode("ptrparam_" + name + "_return");
-                local_var_decls.insert(sem);
+                variables.AddLocal(sem);
             } else {
                 node_init = CreateNode("param_" + name);
             }
@@ -196,21 +372,21 @@ struct FunctionInfo {
     /// Special `Value_return` node.
     Node* value_return;
 
-    /// Map from variables to their value nodes in the graph, scoped with respect to control flow.
-    ScopeStack<const sem::Variable*, Node*> variables;
-
-    /// The set of a local read-write vars that are in scope at any given point in the process.
-    /// Includes pointer parameters.
-    std::unordered_set<const sem::Variable*> local_var_decls;
+    /// Map from variables to their value nodes in the graph, scoped with respect to control flow,
+    /// and the set of local read-write variables that are in scope.
+    VariableScopes variables;
 
     /// LoopSwitchInfo tracks information about the value of variables for a control flow construct.
     struct LoopSwitchInfo {
         /// The type of this control flow construct.
         std::string type;
-        /// The input values for local variables at the start of this construct.
-        std::unordered_map<const sem::Variable*, Node*> var_in_nodes;
-        /// The exit values for local variables at the end of this construct.
-        std::unordered_map<const sem::Variable*, Node*> var_exit_nodes;
+        /// The index of the first variable declared inside this construct. Variables with a lower
+        /// index were declared before the construct.
+        uint32_t first_inner_var = 0;
+        /// The input values for local variables at the start of this construct, by variable index.
+        std::vector<Node*> var_in_nodes;
+        /// The exit values for local variables at the end of this construct, by variable index.
+        std::vector<Node*> var_exit_nodes;
     };
 
     /// Map from control flow statements to the corresponding LoopSwitchInfo structure.
@@ -221,7 +397,7 @@ struct FunctionInfo {
     /// @param ast the optional AST node that this node corresponds to
     /// @returns the new node
     Node* CreateNode([[maybe_unused]] std::string tag, const ast::Node* ast = nullptr) {
-        auto* node = nodes.Create(ast);
+        auto* node = nodes.Create(static_cast<uint32_t>(nodes.Count()), ast);
 
 #if TINT_DUMP_UNIFORMITY_GRAPH
         // Make the tag unique and set it.
@@ -254,10 +430,21 @@ struct FunctionInfo {
 /// module.
 class UniformityGraph {
   public:
+    /// Map of analyzed function results.
+    using FunctionInfoMap = std::unordered_map<const ast::Function*, FunctionInfo>;
+
     /// Constructor.
     /// @param builder the program to analyze
-    explicit UniformityGraph(ProgramBuilder* builder)
-        : builder_(builder), sem_(builder->Sem()), diagnostics_(builder->Diagnostics()) {}
+    /// @param functions the map of analyzed function results, which may be shared by the
+    /// UniformityGraphs that analyze the functions of `builder` concurrently
+    /// @param diagnostics the list that diagnostics are added to
+    UniformityGraph(const ProgramBuilder* builder,
+                    FunctionInfoMap& functions,
+                    diag::List& diagnostics)
+        : builder_(builder),
+          sem_(builder->Sem()),
+          diagnostics_(diagnostics),
+          functions_(functions) {}
 
     /// Destructor.
     ~UniformityGraph() {}
@@ -265,20 +452,32 @@ class UniformityGraph {
     /// Build and analyze the graph to determine whether the program satisfies the uniformity
     /// constraints of WGSL.
     /// @param dependency_graph the dependency-ordered module-scope declarations
+    /// @param max_threads the maximum number of threads used to analyze the functions, or 0 to use
+    /// the number of hardware threads
     /// @returns true if all uniformity constraints are satisfied, otherise false
-    bool Build(const DependencyGraph& dependency_graph) {
+    bool Build(const DependencyGraph& dependency_graph, size_t max_threads) {
 #if TINT_DUMP_UNIFORMITY_GRAPH
         std::cout << "digraph G {\n";
         std::cout << "rankdir=BT\n";
+        max_threads = 1;  // The graph of each function is dumped as it is processed.
 #endif
 
         // Process all functions in the module.
         bool success = true;
-        for (auto* decl : dependency_graph.ordered_globals) {
-            if (auto* func = decl->As<ast::Function>()) {
-                if (!ProcessFunction(func)) {
-                    success = false;
-                    break;
+        if (max_threads == 0) {
+            max_threads = std::thread::hardware_concurrency();
+        }
+        if (max_threads > 1) {
+            success = ProcessFunctionsConcurrently(dependency_graph, max_threads);
+        } else {
+            for (auto* decl : dependency_graph.ordered_globals) {
+                if (auto* func = decl->As<ast::Function>()) {
+                    functions_.emplace(func, FunctionInfo(func, builder_));
+                    if (!ProcessFunction(func)) {
+                        MakeError(*current_function_, current_function_->may_be_non_uniform);
+                        success = false;
+                        break;
+                    }
                 }
             }
         }
@@ -296,7 +495,7 @@ class UniformityGraph {
     diag::List& diagnostics_;
 
     /// Map of analyzed function results.
-    std::unordered_map<const ast::Function*, FunctionInfo> functions_;
+    FunctionInfoMap& functions_;
 
     /// The function currently being analyzed.
     FunctionInfo* current_function_;
@@ -309,11 +508,155 @@ class UniformityGraph {
         return current_function_->CreateNode(std::move(tag), ast);
     }
 
-    /// Process a function.
+    /// Creates the LoopSwitchInfo for a loop or switch statement of the current function.
+    /// @param stmt the loop or switch statement
+    /// @param type the type of the control flow construct
+    /// @param first_inner_var the index of the first variable declared inside the construct
+    /// @returns the new LoopSwitchInfo
+    FunctionInfo::LoopSwitchInfo& StartLoopSwitch(const sem::Statement* stmt,
+                                                  const char* type,
+                                                  uint32_t first_inner_var) {
+        auto num_vars = current_function_->variables.Count();
+        auto& info = current_function_->loop_switch_infos[stmt];
+        info.type = type;
+        info.first_inner_var = first_inner_var;
+        info.var_in_nodes.assign(num_vars, nullptr);
+        info.var_exit_nodes.assign(num_vars, nullptr);
+        return info;
+    }
+
+    /// Creates an input node for each local variable in scope, and sets it as the variable's value.
+    /// @param info the LoopSwitchInfo of the loop
+    /// @param suffix the suffix of the input node tags
+    void CreateLoopInputNodes(FunctionInfo::LoopSwitchInfo& info, const char* suffix) {
+        auto& variables = current_function_->variables;
+        for (auto index : variables.Locals()) {
+            auto* var = variables.Variable(index);
+            auto name = builder_->Symbols().NameFor(var->Declaration()->symbol);
+            auto* in_node = CreateNode(name + suffix);
+            in_node->AddEdge(variables.Get(index));
+            info.var_in_nodes[index] = in_node;
+            variables.Set(index, in_node);
+        }
+    }
+
+    /// Adds an edge from the exit node of each local variable in scope to its current value,
+    /// creating the exit nodes as required.
+    /// @param info the LoopSwitchInfo of the loop or switch
+    /// @param num_vars the variables with an index equal or greater than `num_vars` are skipped
+    void PropagateToExitNodes(FunctionInfo::LoopSwitchInfo& info, uint32_t num_vars) {
+        auto& variables = current_function_->variables;
+        for (auto index : variables.Locals()) {
+            if (index >= num_vars) {
+                continue;
+            }
+            auto*& exit_node = info.var_exit_nodes[index];
+            if (!exit_node) {
+                auto* var = variables.Variable(index);
+                auto name = builder_->Symbols().NameFor(var->Declaration()->symbol);
+                exit_node = CreateNode(name + "_value_" + info.type + "_exit");
+            }
+            exit_node->AddEdge(variables.Get(index));
+        }
+    }
+
+    /// Sets the value of each variable that has an exit node to its exit node.
+    /// @param info the LoopSwitchInfo of the loop or switch
+    void SetExitNodeValues(const FunctionInfo::LoopSwitchInfo& info) {
+        for (uint32_t index = 0; index < info.var_exit_nodes.size(); index++) {
+            if (auto* exit_node = info.var_exit_nodes[index]) {
+                current_function_->variables.Set(index, exit_node);
+            }
+        }
+    }
+
+    /// Analyzes the functions of the module on up to `max_threads` threads.
+    /// The functions are split into waves, where each function only calls functions of earlier
+    /// waves, and the functions of each wave are processed concurrently. All the functions are
+    /// processed, except those that call a function with a uniformity issue, and the issue of the
+    /// first function in dependency order is reported. This is the issue that sequential
+    /// processing would have stopped at, so the diagnostics do not depend on thread scheduling.
+    /// @param dependency_graph the dependency-ordered module-scope declarations
+    /// @param max_threads the maximum number of threads used to analyze the functions
+    /// @returns true if there are no uniformity issues, false otherwise
+    bool ProcessFunctionsConcurrently(const DependencyGraph& dependency_graph,
+                                      size_t max_threads) {
+        enum class Status : uint8_t { kSkipped, kSucceeded, kFailed };
+
+        // Assign each function to the wave after the last wave of the functions it calls.
+        // The FunctionInfos are all created up front, as the map is read by all the threads.
+        std::vector<const ast::Function*> funcs;
+        std::vector<std::vector<size_t>> callees;
+        std::unordered_map<const ast::Function*, size_t> func_indices;
+        std::vector<size_t> func_waves;
+        std::vector<std::vector<size_t>> waves;
+        for (auto* decl : dependency_graph.ordered_globals) {
+            if (auto* func = decl->As<ast::Function>()) {
+                size_t index = funcs.size();
+                size_t wave = 0;
+                callees.emplace_back();
+                auto deps = dependency_graph.global_dependencies.find(func);
+                if (deps != dependency_graph.global_dependencies.end()) {
+                    for (auto* dep : deps->second) {
+                        if (auto* callee = dep->As<ast::Function>()) {
+                            size_t callee_index = func_indices.at(callee);
+                            callees[index].emplace_back(callee_index);
+                            wave = std::max(wave, func_waves[callee_index] + 1);
+                        }
+                    }
+                }
+                if (wave == waves.size()) {
+                    waves.emplace_back();
+                }
+                waves[wave].emplace_back(index);
+                func_indices.emplace(func, index);
+                func_waves.emplace_back(wave);
+                funcs.emplace_back(func);
+                functions_.emplace(func, FunctionInfo(func, builder_));
+            }
+        }
+
+        // Functions are skipped if they call a function that has not been processed successfully,
+        // as the FunctionInfo of the callee is incomplete.
+        std::vector<Status> status(funcs.size(), Status::kSkipped);
+        std::vector<diag::List> thread_diagnostics(max_threads);
+        for (auto& wave : waves) {
+            // Each worker builds the graphs of its functions with its own UniformityGraph.
+            std::vector<std::optional<UniformityGraph>> graphs(max_threads);
+            utils::ParallelFor(wave.size(), max_threads, [&](size_t i, size_t worker) {
+                auto& graph = graphs[worker];
+                if (!graph) {
+                    graph.emplace(builder_, functions_, thread_diagnostics[worker]);
+                }
+                size_t index = wave[i];
+                bool callees_succeeded = std::all_of(
+                    callees[index].begin(), callees[index].end(),
+                    [&](size_t callee) { return status[callee] == Status::kSucceeded; });
+                if (callees_succeeded) {
+                    status[index] =
+                        graph->ProcessFunction(funcs[index]) ? Status::kSucceeded : Status::kFailed;
+                }
+            });
+        }
+
+        for (auto& diagnostics : thread_diagnostics) {
+            diagnostics_.add(diagnostics);
+        }
+        for (size_t i = 0; i < funcs.size(); i++) {
+            if (status[i] == Status::kFailed) {
+                auto& info = functions_.at(funcs[i]);
+                MakeError(info, info.may_be_non_uniform);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Process a function. The FunctionInfo of `func` must already be in #functions_.
+    /// Uniformity issues are not reported, and are left for the caller to report with MakeError().
     /// @param func the function to process
     /// @returns true if there are no uniformity issues, false otherwise
     bool ProcessFunction(const ast::Function* func) {
-        functions_.emplace(func, FunctionInfo(func, builder_));
         current_function_ = &functions_.at(func);
 
         // Process function body.
@@ -337,13 +680,12 @@ class UniformityGraph {
 
         // Look at which nodes are reachable from "RequiredToBeUniform".
         {
-            utils::UniqueVector<Node*> reachable;
+            utils::Bitset<0> reachable;
             Traverse(current_function_->required_to_be_uniform, &reachable);
-            if (reachable.contains(current_function_->may_be_non_uniform)) {
-                MakeError(*current_function_, current_function_->may_be_non_uniform);
+            if (reachable[current_function_->may_be_non_uniform->index]) {
                 return false;
             }
-            if (reachable.contains(current_function_->cf_start)) {
+            if (reachable[current_function_->cf_start->index]) {
                 current_function_->callsite_tag = CallSiteRequiredToBeUniform;
             }
 
@@ -351,7 +693,7 @@ class UniformityGraph {
             // was reachable.
             for (size_t i = 0; i < func->params.Length(); i++) {
                 auto* param = func->params[i];
-                if (reachable.contains(current_function_->variables.Get(sem_.Get(param)))) {
+                if (reachable[current_function_->variables.Get(sem_.Get(param))->index]) {
                     current_function_->parameters[i].tag = ParameterRequiredToBeUniform;
                 }
             }
@@ -359,9 +701,9 @@ class UniformityGraph {
 
         // Look at which nodes are reachable from "CF_return"
         {
-            utils::UniqueVector<Node*> reachable;
+            utils::Bitset<0> reachable;
             Traverse(current_function_->cf_return, &reachable);
-            if (reachable.contains(current_function_->may_be_non_uniform)) {
+            if (reachable[current_function_->may_be_non_uniform->index]) {
                 current_function_->function_tag = SubsequentControlFlowMayBeNonUniform;
             }
 
@@ -369,7 +711,7 @@ class UniformityGraph {
             // each parameter node that was reachable.
             for (size_t i = 0; i < func->params.Length(); i++) {
                 auto* param = func->params[i];
-                if (reachable.contains(current_function_->variables.Get(sem_.Get(param)))) {
+                if (reachable[current_function_->variables.Get(sem_.Get(param))->index]) {
                     current_function_->parameters[i].tag =
                         ParameterRequiredToBeUniformForSubsequentControlFlow;
                 }
@@ -378,9 +720,9 @@ class UniformityGraph {
 
         // If "Value_return" exists, look at which nodes are reachable from it
         if (current_function_->value_return) {
-            utils::UniqueVector<Node*> reachable;
+            utils::Bitset<0> reachable;
             Traverse(current_function_->value_return, &reachable);
-            if (reachable.contains(current_function_->may_be_non_uniform)) {
+            if (reachable[current_function_->may_be_non_uniform->index]) {
                 current_function_->function_tag = ReturnValueMayBeNonUniform;
             }
 
@@ -388,7 +730,7 @@ class UniformityGraph {
             // parameter node that was reachable.
             for (size_t i = 0; i < func->params.Length(); i++) {
                 auto* param = func->params[i];
-                if (reachable.contains(current_function_->variables.Get(sem_.Get(param)))) {
+                if (reachable[current_function_->variables.Get(sem_.Get(param))->index]) {
                     current_function_->parameters[i].tag =
                         ParameterRequiredToBeUniformForReturnValue;
                 }
@@ -404,16 +746,16 @@ class UniformityGraph {
             // Reset "visited" state for all nodes.
             current_function_->ResetVisited();
 
-            utils::UniqueVector<Node*> reachable;
+            utils::Bitset<0> reachable;
             Traverse(current_function_->parameters[i].pointer_return_value, &reachable);
-            if (reachable.contains(current_function_->may_be_non_uniform)) {
+            if (reachable[current_function_->may_be_non_uniform->index]) {
                 current_function_->parameters[i].pointer_may_become_non_uniform = true;
             }
 
             // Check every other parameter to see if they feed into this parameter's final value.
             for (size_t j = 0; j < func->params.Length(); j++) {
                 auto* param_source = sem_.Get<sem::Parameter>(func->params[j]);
-                if (reachable.contains(current_function_->parameters[j].init_value)) {
+                if (reachable[current_function_->parameters[j].init_value->index]) {
                     current_function_->parameters[i].pointer_param_output_sources.push_back(
                         param_source);
                 }
@@ -443,7 +785,7 @@ class UniformityGraph {
             },
 
             [&](const ast::BlockStatement* b) {
-                std::unordered_map<const sem::Variable*, Node*> scoped_assignments;
+                utils::Vector<VariableScopes::Assignment, 8> scoped_assignments;
                 {
                     // Push a new scope for variable assignments in the block.
                     current_function_->variables.Push();
@@ -467,7 +809,7 @@ class UniformityGraph {
                         }
                     }
 
-                    scoped_assignments = std::move(current_function_->variables.Top());
+                    scoped_assignments = current_function_->variables.Top();
                 }
 
                 // Propagate all variables assignments to the containing scope if the behavior is
@@ -475,14 +817,14 @@ class UniformityGraph {
                 auto& behaviors = sem_.Get(b)->Behaviors();
                 if (behaviors.Contains(sem::Behavior::kNext) ||
                     behaviors.Contains(sem::Behavior::kFallthrough)) {
-                    for (auto var : scoped_assignments) {
-                        current_function_->variables.Set(var.first, var.second);
+                    for (auto& assignment : scoped_assignments) {
+                        current_function_->variables.Set(assignment.index, assignment.value);
                     }
                 }
 
                 // Remove any variables declared in this scope from the set of in-scope variables.
                 for (auto* d : sem_.Get<sem::BlockStatement>(b)->Decls()) {
-                    current_function_->local_var_decls.erase(sem_.Get<sem::LocalVariable>(d));
+                    current_function_->variables.RemoveLocal(sem_.Get<sem::LocalVariable>(d));
                 }
 
                 return cf;
@@ -496,22 +838,9 @@ class UniformityGraph {
                 TINT_ASSERT(Resolver, current_function_->loop_switch_infos.count(parent));
                 auto& info = current_function_->loop_switch_infos.at(parent);
 
-                // Propagate variable values to the loop/switch exit nodes.
-                for (auto* var : current_function_->local_var_decls) {
-                    // Skip variables that were declared inside this loop/switch.
-                    if (auto* lv = var->As<sem::LocalVariable>();
-                        lv &&
-                        lv->Statement()->FindFirstParent([&](auto* s) { return s == parent; })) {
-                        continue;
-                    }
-
-                    // Add an edge from the variable exit node to its value at this point.
-                    auto* exit_node = utils::GetOrCreate(info.var_exit_nodes, var, [&]() {
-                        auto name = builder_->Symbols().NameFor(var->Declaration()->symbol);
-                        return CreateNode(name + "_value_" + info.type + "_exit");
-                    });
-                    exit_node->AddEdge(current_function_->variables.Get(var));
-                }
+                // Propagate variable values to the loop/switch exit nodes, skipping variables that
+                // were declared inside this loop/switch.
+                PropagateToExitNodes(info, info.first_inner_var);
 
                 return cf;
             },
@@ -543,18 +872,18 @@ class UniformityGraph {
                 auto& info = current_function_->loop_switch_infos.at(parent);
 
                 // Propagate assignments to the loop input nodes.
-                for (auto* var : current_function_->local_var_decls) {
+                auto& variables = current_function_->variables;
+                for (auto index : variables.Locals()) {
                     // Skip variables that were declared inside this loop.
-                    if (auto* lv = var->As<sem::LocalVariable>();
-                        lv &&
-                        lv->Statement()->FindFirstParent([&](auto* s) { return s == parent; })) {
+                    if (index >= info.first_inner_var) {
                         continue;
                     }
 
                     // Add an edge from the variable's loop input node to its value at this point.
-                    TINT_ASSERT(Resolver, info.var_in_nodes.count(var));
-                    auto* in_node = info.var_in_nodes.at(var);
-                    auto* out_node = current_function_->variables.Get(var);
+                    TINT_ASSERT(Resolver, index < info.var_in_nodes.size());
+                    auto* in_node = info.var_in_nodes[index];
+                    TINT_ASSERT(Resolver, in_node);
+                    auto* out_node = variables.Get(index);
                     if (out_node != in_node) {
                         in_node->AddEdge(out_node);
                     }
@@ -571,23 +900,16 @@ class UniformityGraph {
                 auto* cfx = CreateNode("loop_start");
 
                 // Insert the initializer before the loop.
+                // Variables declared by the initializer are considered to be inside the loop.
+                auto first_inner_var = current_function_->variables.Count();
                 auto* cf_init = cf;
                 if (f->initializer) {
                     cf_init = ProcessStatement(cf, f->initializer);
                 }
                 auto* cf_start = cf_init;
 
-                auto& info = current_function_->loop_switch_infos[sem_loop];
-                info.type = "forloop";
-
-                // Create input nodes for any variables declared before this loop.
-                for (auto* v : current_function_->local_var_decls) {
-                    auto name = builder_->Symbols().NameFor(v->Declaration()->symbol);
-                    auto* in_node = CreateNode(name + "_value_forloop_in");
-                    in_node->AddEdge(current_function_->variables.Get(v));
-                    info.var_in_nodes[v] = in_node;
-                    current_function_->variables.Set(v, in_node);
-                }
+                auto& info = StartLoopSwitch(sem_loop, "forloop", first_inner_var);
+                CreateLoopInputNodes(info, "_value_forloop_in");
 
                 // Insert the condition at the start of the loop body.
                 if (f->condition) {
@@ -597,14 +919,9 @@ class UniformityGraph {
                     cf_condition_end->AddEdge(v);
                     cf_start = cf_condition_end;
 
-                    // Propagate assignments to the loop exit nodes.
-                    for (auto* var : current_function_->local_var_decls) {
-                        auto* exit_node = utils::GetOrCreate(info.var_exit_nodes, var, [&]() {
-                            auto name = builder_->Symbols().NameFor(var->Declaration()->symbol);
-                            return CreateNode(name + "_value_" + info.type + "_exit");
-                        });
-                        exit_node->AddEdge(current_function_->variables.Get(var));
-                    }
+                    // Propagate assignments to the loop exit nodes, including the variables
+                    // declared by the initializer.
+                    PropagateToExitNodes(info, static_cast<uint32_t>(info.var_exit_nodes.size()));
                 }
                 auto* cf1 = ProcessStatement(cf_start, f->body);
 
@@ -618,18 +935,16 @@ class UniformityGraph {
                 cfx->AddEdge(cf);
 
                 // Add edges from variable loop input nodes to their values at the end of the loop.
-                for (auto v : info.var_in_nodes) {
-                    auto* in_node = v.second;
-                    auto* out_node = current_function_->variables.Get(v.first);
-                    if (out_node != in_node) {
+                for (uint32_t index = 0; index < info.var_in_nodes.size(); index++) {
+                    auto* in_node = info.var_in_nodes[index];
+                    auto* out_node = current_function_->variables.Get(index);
+                    if (in_node && out_node != in_node) {
                         in_node->AddEdge(out_node);
                     }
                 }
 
                 // Set each variable's exit node as its value in the outer scope.
-                for (auto v : info.var_exit_nodes) {
-                    current_function_->variables.Set(v.first, v.second);
-                }
+                SetExitNodeValues(info);
 
                 current_function_->loop_switch_infos.erase(sem_loop);
 
@@ -646,17 +961,9 @@ class UniformityGraph {
 
                 auto* cf_start = cf;
 
-                auto& info = current_function_->loop_switch_infos[sem_loop];
-                info.type = "whileloop";
-
-                // Create input nodes for any variables declared before this loop.
-                for (auto* v : current_function_->local_var_decls) {
-                    auto name = builder_->Symbols().NameFor(v->Declaration()->symbol);
-                    auto* in_node = CreateNode(name + "_value_forloop_in");
-                    in_node->AddEdge(current_function_->variables.Get(v));
-                    info.var_in_nodes[v] = in_node;
-                    current_function_->variables.Set(v, in_node);
-                }
+                auto& info = StartLoopSwitch(sem_loop, "whileloop",
+                                             current_function_->variables.Count());
+                CreateLoopInputNodes(info, "_value_forloop_in");
 
                 // Insert the condition at the start of the loop body.
                 {
@@ -668,30 +975,22 @@ class UniformityGraph {
                 }
 
                 // Propagate assignments to the loop exit nodes.
-                for (auto* var : current_function_->local_var_decls) {
-                    auto* exit_node = utils::GetOrCreate(info.var_exit_nodes, var, [&]() {
-                        auto name = builder_->Symbols().NameFor(var->Declaration()->symbol);
-                        return CreateNode(name + "_value_" + info.type + "_exit");
-                    });
-                    exit_node->AddEdge(current_function_->variables.Get(var));
-                }
+                PropagateToExitNodes(info, info.first_inner_var);
                 auto* cf1 = ProcessStatement(cf_start, w->body);
                 cfx->AddEdge(cf1);
                 cfx->AddEdge(cf);
 
                 // Add edges from variable loop input nodes to their values at the end of the loop.
-                for (auto v : info.var_in_nodes) {
-                    auto* in_node = v.second;
-                    auto* out_node = current_function_->variables.Get(v.first);
-                    if (out_node != in_node) {
+                for (uint32_t index = 0; index < info.var_in_nodes.size(); index++) {
+                    auto* in_node = info.var_in_nodes[index];
+                    auto* out_node = current_function_->variables.Get(index);
+                    if (in_node && out_node != in_node) {
                         in_node->AddEdge(out_node);
                     }
                 }
 
                 // Set each variable's exit node as its value in the outer scope.
-                for (auto v : info.var_exit_nodes) {
-                    current_function_->variables.Set(v.first, v.second);
-                }
+                SetExitNodeValues(info);
 
                 current_function_->loop_switch_infos.erase(sem_loop);
 
@@ -711,15 +1010,15 @@ class UniformityGraph {
                 v->affects_control_flow = true;
                 v->AddEdge(v_cond);
 
-                std::unordered_map<const sem::Variable*, Node*> true_vars;
-                std::unordered_map<const sem::Variable*, Node*> false_vars;
+                utils::Vector<VariableScopes::Assignment, 8> true_vars;
+                utils::Vector<VariableScopes::Assignment, 8> false_vars;
 
                 // Helper to process a statement with a new scope for variable assignments.
                 // Populates `assigned_vars` with new nodes for any variables that are assigned in
                 // this statement.
                 auto process_in_scope =
                     [&](Node* cf_in, const ast::Statement* s,
-                        std::unordered_map<const sem::Variable*, Node*>& assigned_vars) {
+                        utils::Vector<VariableScopes::Assignment, 8>& assigned_vars) {
                         // Push a new scope for variable assignments.
                         current_function_->variables.Push();
 
@@ -747,34 +1046,44 @@ class UniformityGraph {
                 }
 
                 // Update values for any variables assigned in the if or else blocks.
-                for (auto* var : current_function_->local_var_decls) {
-                    // Skip variables not assigned in either block.
-                    if (true_vars.count(var) == 0 && false_vars.count(var) == 0) {
+                // The assignments of both blocks are ordered by variable index, so they are merged
+                // in a single pass.
+                auto& variables = current_function_->variables;
+                auto* true_it = true_vars.begin();
+                auto* false_it = false_vars.begin();
+                while (true_it != true_vars.end() || false_it != false_vars.end()) {
+                    auto index = std::min(
+                        true_it != true_vars.end() ? true_it->index : variables.Count(),
+                        false_it != false_vars.end() ? false_it->index : variables.Count());
+                    Node* true_value = nullptr;
+                    if (true_it != true_vars.end() && true_it->index == index) {
+                        true_value = (true_it++)->value;
+                    }
+                    Node* false_value = nullptr;
+                    if (false_it != false_vars.end() && false_it->index == index) {
+                        false_value = (false_it++)->value;
+                    }
+
+                    // Skip variables that are not in scope.
+                    if (!variables.IsLocal(index)) {
                         continue;
                     }
 
                     // Create an exit node for the variable.
+                    auto* var = variables.Variable(index);
                     auto name = builder_->Symbols().NameFor(var->Declaration()->symbol);
                     auto* out_node = CreateNode(name + "_value_if_exit");
 
                     // Add edges to the assigned value or the initial value.
                     // Only add edges if the behavior for that block contains 'Next'.
                     if (true_has_next) {
-                        if (true_vars.count(var)) {
-                            out_node->AddEdge(true_vars.at(var));
-                        } else {
-                            out_node->AddEdge(current_function_->variables.Get(var));
-                        }
+                        out_node->AddEdge(true_value ? true_value : variables.Get(index));
                     }
                     if (false_has_next) {
-                        if (false_vars.count(var)) {
-                            out_node->AddEdge(false_vars.at(var));
-                        } else {
-                            out_node->AddEdge(current_function_->variables.Get(var));
-                        }
+                        out_node->AddEdge(false_value ? false_value : variables.Get(index));
                     }
 
-                    current_function_->variables.Set(var, out_node);
+                    variables.Set(index, out_node);
                 }
 
                 if (sem_if->Behaviors() != sem::Behaviors{sem::Behavior::kNext}) {
@@ -804,17 +1113,9 @@ class UniformityGraph {
                 auto* sem_loop = sem_.Get(l);
                 auto* cfx = CreateNode("loop_start");
 
-                auto& info = current_function_->loop_switch_infos[sem_loop];
-                info.type = "loop";
-
-                // Create input nodes for any variables declared before this loop.
-                for (auto* v : current_function_->local_var_decls) {
-                    auto name = builder_->Symbols().NameFor(v->Declaration()->symbol);
-                    auto* in_node = CreateNode(name + "_value_loop_in");
-                    in_node->AddEdge(current_function_->variables.Get(v));
-                    info.var_in_nodes[v] = in_node;
-                    current_function_->variables.Set(v, in_node);
-                }
+                auto& info =
+                    StartLoopSwitch(sem_loop, "loop", current_function_->variables.Count());
+                CreateLoopInputNodes(info, "_value_loop_in");
 
                 auto* cf1 = ProcessStatement(cfx, l->body);
                 if (l->continuing) {
@@ -826,18 +1127,16 @@ class UniformityGraph {
                 cfx->AddEdge(cf);
 
                 // Add edges from variable loop input nodes to their values at the end of the loop.
-                for (auto v : info.var_in_nodes) {
-                    auto* in_node = v.second;
-                    auto* out_node = current_function_->variables.Get(v.first);
-                    if (out_node != in_node) {
+                for (uint32_t index = 0; index < info.var_in_nodes.size(); index++) {
+                    auto* in_node = info.var_in_nodes[index];
+                    auto* out_node = current_function_->variables.Get(index);
+                    if (in_node && out_node != in_node) {
                         in_node->AddEdge(out_node);
                     }
                 }
 
                 // Set each variable's exit node as its value in the outer scope.
-                for (auto v : info.var_exit_nodes) {
-                    current_function_->variables.Set(v.first, v.second);
-                }
+                SetExitNodeValues(info);
 
                 current_function_->loop_switch_infos.erase(sem_loop);
 
@@ -886,8 +1185,8 @@ class UniformityGraph {
                     cf_end = CreateNode("switch_CFend");
                 }
 
-                auto& info = current_function_->loop_switch_infos[sem_switch];
-                info.type = "switch";
+                auto& info =
+                    StartLoopSwitch(sem_switch, "switch", current_function_->variables.Count());
 
                 auto* cf_n = v;
                 bool previous_case_has_fallthrough = false;
@@ -909,24 +1208,9 @@ class UniformityGraph {
                         sem_case->Behaviors().Contains(sem::Behavior::kFallthrough);
                     if (!has_fallthrough) {
                         if (sem_case->Behaviors().Contains(sem::Behavior::kNext)) {
-                            // Propagate variable values to the switch exit nodes.
-                            for (auto* var : current_function_->local_var_decls) {
-                                // Skip variables that were declared inside the switch.
-                                if (auto* lv = var->As<sem::LocalVariable>();
-                                    lv && lv->Statement()->FindFirstParent(
-                                              [&](auto* st) { return st == sem_switch; })) {
-                                    continue;
-                                }
-
-                                // Add an edge from the variable exit node to its new value.
-                                auto* exit_node =
-                                    utils::GetOrCreate(info.var_exit_nodes, var, [&]() {
-                                        auto name =
-                                            builder_->Symbols().NameFor(var->Declaration()->symbol);
-                                        return CreateNode(name + "_value_" + info.type + "_exit");
-                                    });
-                                exit_node->AddEdge(current_function_->variables.Get(var));
-                            }
+                            // Propagate variable values to the switch exit nodes, skipping
+                            // variables that were declared inside the switch.
+                            PropagateToExitNodes(info, info.first_inner_var);
                         }
                         current_function_->variables.Pop();
                     }
@@ -934,9 +1218,7 @@ class UniformityGraph {
                 }
 
                 // Update nodes for any variables assigned in the switch statement.
-                for (auto var : info.var_exit_nodes) {
-                    current_function_->variables.Set(var.first, var.second);
-                }
+                SetExitNodeValues(info);
 
                 return cf_end ? cf_end : cf;
             },
@@ -953,7 +1235,7 @@ class UniformityGraph {
                 current_function_->variables.Set(sem_.Get(decl->variable), node);
 
                 if (decl->variable->Is<ast::Var>()) {
-                    current_function_->local_var_decls.insert(
+                    current_function_->variables.AddLocal(
                         sem_.Get<sem::LocalVariable>(decl->variable));
                 }
 
@@ -1352,24 +1634,27 @@ class UniformityGraph {
         return {cf_after, result};
     }
 
-    /// Traverse a graph starting at `source`, inserting all visited nodes into `reachable` and
-    /// recording which node they were reached from.
+    /// Traverse a graph starting at `source`, setting the bit of each visited node in `reachable`
+    /// and recording which node they were reached from.
     /// @param source the starting node
-    /// @param reachable the set of reachable nodes to populate, if required
-    void Traverse(Node* source, utils::UniqueVector<Node*>* reachable = nullptr) {
-        std::vector<Node*> to_visit{source};
+    /// @param reachable the bitset of reachable nodes, indexed by node index, to populate if
+    /// required. Must be a node of the current function if `reachable` is not nullptr.
+    void Traverse(Node* source, utils::Bitset<0>* reachable = nullptr) {
+        if (reachable) {
+            reachable->Resize(current_function_->nodes.Count());
+        }
 
-        while (!to_visit.empty()) {
-            auto* node = to_visit.back();
-            to_visit.pop_back();
+        utils::Vector<Node*, 64> to_visit{source};
+        while (!to_visit.IsEmpty()) {
+            auto* node = to_visit.Pop();
 
             if (reachable) {
-                reachable->add(node);
+                (*reachable)[node->index] = true;
             }
             for (auto* to : node->edges) {
                 if (to->visited_from == nullptr) {
                     to->visited_from = node;
-                    to_visit.push_back(to);
+                    to_visit.Push(to);
                 }
             }
         }
@@ -1636,9 +1921,12 @@ class UniformityGraph {
 
 }  // namespace
 
-bool AnalyzeUniformity(ProgramBuilder* builder, const DependencyGraph& dependency_graph) {
-    UniformityGraph graph(builder);
-    return graph.Build(dependency_graph);
+bool AnalyzeUniformity(ProgramBuilder* builder,
+                       const DependencyGraph& dependency_graph,
+                       size_t max_threads /* = 1 */) {
+    UniformityGraph::FunctionInfoMap functions;
+    UniformityGraph graph(builder, functions, builder->Diagnostics());
+    return graph.Build(dependency_graph, max_threads);
 }
 
 }  // namespace tint::resolver
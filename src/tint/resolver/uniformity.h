@@ -15,6 +15,8 @@
 #ifndef SRC_TINT_RESOLVER_UNIFORMITY_H_
 #define SRC_TINT_RESOLVER_UNIFORMITY_H_
 
+#include <cstddef>
+
 // Forward declarations.
 namespace tint {
 namespace resolver {
@@ -28,8 +30,13 @@ namespace tint::resolver {
 /// Analyze the uniformity of a program.
 /// @param builder the program to analyze
 /// @param dependency_graph the dependency-ordered module-scope declarations
+/// @param max_threads the maximum number of threads used to analyze the functions of the program,
+/// or 0 to use the number of hardware threads. If greater than 1, functions that do not call each
+/// other are analyzed concurrently.
 /// @returns true if there are no uniformity issues, false otherwise
-bool AnalyzeUniformity(ProgramBuilder* builder, const resolver::DependencyGraph& dependency_graph);
+bool AnalyzeUniformity(ProgramBuilder* builder,
+                       const resolver::DependencyGraph& dependency_graph,
+                       size_t max_threads = 1);
 
 }  // namespace tint::resolver
 
@@ -19,6 +19,7 @@
 
 #include "src/tint/program_builder.h"
 #include "src/tint/reader/wgsl/parser.h"
+#include "src/tint/reader/wgsl/parser_impl.h"
 #include "src/tint/resolver/uniformity.h"
 
 #include "gmock/gmock.h"
@@ -6854,5 +6855,93 @@ test:6:7 note: reading from read_write storage buffer 'non_uniform_value' may re
 )");
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Concurrent analysis.
+////////////////////////////////////////////////////////////////////////////////
+
+class UniformityAnalysisConcurrencyTest : public ::testing::TestWithParam<size_t> {
+  protected:
+    /// Parse and resolve a WGSL shader, analyzing uniformity on up to GetParam() threads.
+    /// @param src the WGSL source code
+    /// @returns the formatted diagnostics
+    std::string Run(const std::string& src) {
+        auto file = std::make_unique<Source::File>("test", src);
+        reader::wgsl::ParserImpl parser(file.get());
+        parser.builder().SetResolverMaxThreads(GetParam());
+        parser.Parse();
+        auto program = parser.program();
+        EXPECT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+        diag::Formatter::Style style;
+        style.print_newline_at_end = false;
+        return diag::Formatter(style).format(program.Diagnostics());
+    }
+};
+
+TEST_P(UniformityAnalysisConcurrencyTest, FirstErrorInDependencyOrder) {
+    // `caller` is analyzed in a later wave than `lone`, but comes first in dependency order, so
+    // its error is the one that is reported.
+    std::string src = R"(
+@group(0) @binding(0) var<storage, read_write> non_uniform : i32;
+
+fn leaf(x : i32) {
+  if (x == 0) {
+    workgroupBarrier();
+  }
+}
+
+fn caller() {
+  leaf(non_uniform);
+}
+
+fn lone() {
+  if (non_uniform == 0) {
+    workgroupBarrier();
+  }
+}
+)";
+    for (int i = 0; i < 64; i++) {
+        auto n = std::to_string(i);
+        src += "fn filler" + n + "(a : i32) -> i32 {\n";
+        src += "  if (a == " + n + ") {\n";
+        src += "    workgroupBarrier();\n";
+        src += "  }\n";
+        auto callee = i > 0 ? "filler" + std::to_string(i / 2) + "(a)" : "1";
+        src += "  return a + " + callee + ";\n";
+        src += "}\n";
+    }
+
+    EXPECT_EQ(Run(src),
+              R"(test:11:8 warning: parameter 'x' of 'leaf' must be uniform
+  leaf(non_uniform);
+       ^^^^^^^^^^^
+
+test:6:5 note: 'workgroupBarrier' must only be called from uniform control flow
+    workgroupBarrier();
+    ^^^^^^^^^^^^^^^^
+
+test:11:8 note: reading from read_write storage buffer 'non_uniform' may result in a non-uniform value
+  leaf(non_uniform);
+       ^^^^^^^^^^^
+)");
+}
+
+TEST_P(UniformityAnalysisConcurrencyTest, NoError) {
+    std::string src;
+    for (int i = 0; i < 64; i++) {
+        auto n = std::to_string(i);
+        src += "fn func" + n + "(a : i32) -> i32 {\n";
+        src += "  workgroupBarrier();\n";
+        auto callee = i > 0 ? "func" + std::to_string(i / 3) + "(a)" : "1";
+        src += "  return a + " + callee + ";\n";
+        src += "}\n";
+    }
+    EXPECT_EQ(Run(src), "");
+}
+
+INSTANTIATE_TEST_SUITE_P(UniformityAnalysisTest,
+                         UniformityAnalysisConcurrencyTest,
+                         ::testing::Values(0u, 1u, 2u, 8u));
+
 }  // namespace
 }  // namespace tint::resolver
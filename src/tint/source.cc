@@ -74,55 +74,58 @@ bool ParseLineBreak(std::string_view str, size_t i, bool* is_line_break, size_t*
     return true;
 }
 
-std::vector<std::string_view> SplitLines(std::string_view str) {
-    std::vector<std::string_view> lines;
-
-    size_t lineStart = 0;
-    for (size_t i = 0; i < str.size();) {
+/// @returns the line of `str` that begins at `offset`, and the offset of the following line
+std::pair<std::string_view, size_t> NextLine(std::string_view str, size_t offset) {
+    for (size_t i = offset; i < str.size();) {
         bool is_line_break{};
         size_t line_break_size{};
         // We don't handle decode errors from ParseLineBreak. Instead, we rely on
         // the Lexer to do so.
         ParseLineBreak(str, i, &is_line_break, &line_break_size);
         if (is_line_break) {
-            lines.push_back(str.substr(lineStart, i - lineStart));
-            i += line_break_size;
-            lineStart = i;
-        } else {
-            ++i;
+            return {str.substr(offset, i - offset), i + line_break_size};
         }
+        ++i;
     }
-    if (lineStart < str.size()) {
-        lines.push_back(str.substr(lineStart));
-    }
-
-    return lines;
+    return {str.substr(offset), str.size()};
 }
 
-std::vector<std::string_view> CopyRelativeStringViews(const std::vector<std::string_view>& src_list,
-                                                      const std::string_view& src_view,
-                                                      const std::string_view& dst_view) {
-    std::vector<std::string_view> out(src_list.size());
-    for (size_t i = 0; i < src_list.size(); i++) {
-        auto offset = static_cast<size_t>(&src_list[i].front() - &src_view.front());
-        auto count = src_list[i].length();
-        out[i] = dst_view.substr(offset, count);
+std::vector<std::string_view> SplitLines(std::string_view str) {
+    std::vector<std::string_view> lines;
+    for (size_t offset = 0; offset < str.size();) {
+        auto [line, next_offset] = NextLine(str, offset);
+        lines.push_back(line);
+        offset = next_offset;
     }
-    return out;
+    return lines;
 }
 
 }  // namespace
 
 Source::FileContent::FileContent(const std::string& body)
-    : data(body), data_view(data), lines(SplitLines(data_view)) {}
+    : FileContent(std::make_shared<const std::string>(body)) {}
+
+Source::FileContent::FileContent(std::string&& body)
+    : FileContent(std::make_shared<const std::string>(std::move(body))) {}
+
+Source::FileContent::FileContent(std::shared_ptr<const std::string> body)
+    : data(std::move(body)), data_view(*data) {}
 
-Source::FileContent::FileContent(const FileContent& rhs)
-    : data(rhs.data),
-      data_view(data),
-      lines(CopyRelativeStringViews(rhs.lines, rhs.data_view, data_view)) {}
+Source::FileContent::FileContent(const FileContent& rhs) : data(rhs.data), data_view(*data) {}
 
 Source::FileContent::~FileContent() = default;
 
+const std::vector<std::string_view>& Source::FileContent::Lines() const {
+    std::call_once(lines_once_, [&] { lines_ = SplitLines(data_view); });
+    return lines_;
+}
+
+std::string_view Source::FileContent::LineAt(size_t offset, size_t* next_offset) const {
+    auto [line, next] = NextLine(data_view, offset);
+    *next_offset = next;
+    return line;
+}
+
 Source::File::~File() = default;
 
 std::ostream& operator<<(std::ostream& out, const Source& source) {
@@ -146,11 +149,12 @@ std::ostream& operator<<(std::ostream& out, const Source& source) {
                 }
             };
 
+            auto& lines = source.file->content.Lines();
             for (size_t line = rng.begin.line; line <= rng.end.line; line++) {
-                if (line < source.file->content.lines.size() + 1) {
-                    auto len = source.file->content.lines[line - 1].size();
+                if (line < lines.size() + 1) {
+                    auto len = lines[line - 1].size();
 
-                    out << source.file->content.lines[line - 1];
+                    out << lines[line - 1];
 
                     out << std::endl;
 
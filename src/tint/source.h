@@ -17,9 +17,12 @@
 #define SRC_TINT_SOURCE_H_
 
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace tint {
@@ -28,25 +31,50 @@ namespace tint {
 class Source {
   public:
     /// FileContent describes the content of a source file encoded using utf-8.
+    /// The content is shared between copies of the FileContent, and the content is only split
+    /// into lines when Lines() is first called.
     class FileContent {
       public:
         /// Constructs the FileContent with the given file content.
         /// @param data the file contents
         explicit FileContent(const std::string& data);
 
-        /// Copy constructor
+        /// Constructs the FileContent, taking ownership of the given file content.
+        /// @param data the file contents
+        explicit FileContent(std::string&& data);
+
+        /// Constructs the FileContent, sharing ownership of the given file content.
+        /// @param data the file contents
+        explicit FileContent(std::shared_ptr<const std::string> data);
+
+        /// Copy constructor. The file content is shared with `rhs`.
         /// @param rhs the FileContent to copy
         FileContent(const FileContent& rhs);
 
         /// Destructor
         ~FileContent();
 
+        /// @returns #data split by lines. The lines are found on the first call.
+        const std::vector<std::string_view>& Lines() const;
+
+        /// Returns the line that begins at the byte offset `offset` of #data_view, without
+        /// building the line table.
+        /// @param offset the byte offset of the start of the line
+        /// @param next_offset set to the byte offset of the start of the following line. This is
+        /// `data_view.size()` if the returned line is the last line.
+        /// @returns the line, excluding its line break
+        std::string_view LineAt(size_t offset, size_t* next_offset) const;
+
         /// The original un-split file content
-        const std::string data;
+        const std::shared_ptr<const std::string> data;
         /// A string_view over #data
         const std::string_view data_view;
-        /// #data split by lines
-        const std::vector<std::string_view> lines;
+
+      private:
+        /// Guards the construction of #lines_
+        mutable std::once_flag lines_once_;
+        /// #data split by lines, built by Lines()
+        mutable std::vector<std::string_view> lines_;
     };
 
     /// File describes a source file, including path and content.
@@ -57,6 +85,17 @@ class Source {
         /// @param c the file contents
         inline File(const std::string& p, const std::string& c) : path(p), content(c) {}
 
+        /// Constructs the File with the given file path, taking ownership of the content.
+        /// @param p the path for this file
+        /// @param c the file contents
+        inline File(const std::string& p, std::string&& c) : path(p), content(std::move(c)) {}
+
+        /// Constructs the File with the given file path, sharing ownership of the content.
+        /// @param p the path for this file
+        /// @param c the file contents
+        inline File(const std::string& p, std::shared_ptr<const std::string> c)
+            : path(p), content(std::move(c)) {}
+
         /// Copy constructor
         File(const File&) = default;
 
@@ -222,7 +261,7 @@ std::ostream& operator<<(std::ostream& out, const Source& source);
 /// @param content the file content to write
 /// @returns out so calls can be chained
 inline std::ostream& operator<<(std::ostream& out, const Source::FileContent& content) {
-    out << content.data;
+    out << content.data_view;
     return out;
 }
 
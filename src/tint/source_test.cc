@@ -15,6 +15,7 @@
 #include "src/tint/source.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -30,36 +31,71 @@ using SourceFileContentTest = testing::Test;
 
 TEST_F(SourceFileContentTest, Ctor) {
     Source::FileContent fc(kSource);
-    EXPECT_EQ(fc.data, kSource);
+    EXPECT_EQ(*fc.data, kSource);
     EXPECT_EQ(fc.data_view, kSource);
-    ASSERT_EQ(fc.lines.size(), 3u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
-    EXPECT_EQ(fc.lines[2], "line three");
+    ASSERT_EQ(fc.Lines().size(), 3u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "line three");
 }
 
 TEST_F(SourceFileContentTest, CopyCtor) {
     auto src = std::make_unique<Source::FileContent>(kSource);
     Source::FileContent fc{*src};
     src.reset();
-    EXPECT_EQ(fc.data, kSource);
+    EXPECT_EQ(*fc.data, kSource);
     EXPECT_EQ(fc.data_view, kSource);
-    ASSERT_EQ(fc.lines.size(), 3u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
-    EXPECT_EQ(fc.lines[2], "line three");
+    ASSERT_EQ(fc.Lines().size(), 3u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "line three");
 }
 
 TEST_F(SourceFileContentTest, MoveCtor) {
     auto src = std::make_unique<Source::FileContent>(kSource);
     Source::FileContent fc{std::move(*src)};
     src.reset();
-    EXPECT_EQ(fc.data, kSource);
+    EXPECT_EQ(*fc.data, kSource);
     EXPECT_EQ(fc.data_view, kSource);
-    ASSERT_EQ(fc.lines.size(), 3u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
-    EXPECT_EQ(fc.lines[2], "line three");
+    ASSERT_EQ(fc.Lines().size(), 3u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "line three");
+}
+
+TEST_F(SourceFileContentTest, CopyCtorSharesData) {
+    Source::FileContent src(kSource);
+    Source::FileContent fc{src};
+    EXPECT_EQ(fc.data, src.data);
+    EXPECT_EQ(fc.data_view.data(), src.data_view.data());
+}
+
+TEST_F(SourceFileContentTest, SharedDataCtor) {
+    auto data = std::make_shared<const std::string>(kSource);
+    Source::FileContent fc(data);
+    EXPECT_EQ(fc.data, data);
+    EXPECT_EQ(fc.data_view, kSource);
+    ASSERT_EQ(fc.Lines().size(), 3u);
+    EXPECT_EQ(fc.Lines()[2], "line three");
+}
+
+TEST_F(SourceFileContentTest, FileSharedDataCtor) {
+    auto data = std::make_shared<const std::string>(kSource);
+    Source::File file("path", data);
+    EXPECT_EQ(file.path, "path");
+    EXPECT_EQ(file.content.data, data);
+    EXPECT_EQ(file.content.data_view, kSource);
+}
+
+TEST_F(SourceFileContentTest, LineAt) {
+    Source::FileContent fc(kSource);
+    size_t offset = 0;
+    EXPECT_EQ(fc.LineAt(offset, &offset), "line one");
+    EXPECT_EQ(offset, 9u);
+    EXPECT_EQ(fc.LineAt(offset, &offset), "line two");
+    EXPECT_EQ(offset, 18u);
+    EXPECT_EQ(fc.LineAt(offset, &offset), "line three");
+    EXPECT_EQ(offset, fc.data_view.size());
 }
 
 // Line break code points
@@ -78,9 +114,9 @@ TEST_P(LineBreakTest, Single) {
     src += "line two";
 
     Source::FileContent fc(src);
-    EXPECT_EQ(fc.lines.size(), 2u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
+    EXPECT_EQ(fc.Lines().size(), 2u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
 }
 TEST_P(LineBreakTest, Double) {
     std::string src = "line one";
@@ -89,10 +125,22 @@ TEST_P(LineBreakTest, Double) {
     src += "line two";
 
     Source::FileContent fc(src);
-    EXPECT_EQ(fc.lines.size(), 3u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "");
-    EXPECT_EQ(fc.lines[2], "line two");
+    EXPECT_EQ(fc.Lines().size(), 3u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "");
+    EXPECT_EQ(fc.Lines()[2], "line two");
+}
+TEST_P(LineBreakTest, LineAt) {
+    std::string src = "line one";
+    src += GetParam();
+    src += "line two";
+
+    Source::FileContent fc(src);
+    size_t offset = 0;
+    EXPECT_EQ(fc.LineAt(offset, &offset), "line one");
+    EXPECT_EQ(offset, 8u + std::string(GetParam()).size());
+    EXPECT_EQ(fc.LineAt(offset, &offset), "line two");
+    EXPECT_EQ(offset, src.size());
 }
 INSTANTIATE_TEST_SUITE_P(SourceFileContentTest,
                          LineBreakTest,
@@ -14,72 +14,212 @@
 
 #include "src/tint/symbol_table.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
 #include "src/tint/debug.h"
 
 namespace tint {
+namespace {
+
+/// The minimum size in bytes of the blocks that hold the interned names
+constexpr size_t kBlockSize = 4096;
+
+/// The maximum number of names that a new layer of names copies from the small layers below it,
+/// which bounds the number of layers that a lookup visits without copying large layers.
+constexpr size_t kMaxCopiedNames = 256;
+
+}  // namespace
+
+/// The interned names of a SymbolTable. The names form a chain of layers: each layer holds the
+/// names registered after it was created, and overlays the shared, immutable layers below it.
+struct SymbolTable::Names {
+    /// Constructor
+    Names() = default;
+
+    /// Constructor. The new layer overlays `below`, which is never modified again. The names of
+    /// small layers are copied into the new layer, so that chains of clones that each register a
+    /// few names do not grow the chain by a layer per clone. The bottom layer is never copied.
+    /// @param below the shared layers to overlay
+    explicit Names(std::shared_ptr<const Names> below) {
+        while (below->parent && names.size() + below->names.size() <= kMaxCopiedNames) {
+            names.insert(names.begin(), below->names.begin(), below->names.end());
+            values.insert(below->values.begin(), below->values.end());
+            blocks.insert(blocks.end(), below->blocks.begin(), below->blocks.end());
+            auto next_below = below->parent;
+            below = std::move(next_below);
+        }
+        base = below->Count();
+        parent = std::move(below);
+    }
+
+    /// @returns the number of names held by this layer and the layers below it
+    uint32_t Count() const { return base + static_cast<uint32_t>(names.size()); }
+
+    /// @param name the name to look up
+    /// @returns the symbol value of `name`, or 0 if the name has not been registered
+    uint32_t Find(std::string_view name) const {
+        for (auto* layer = this; layer; layer = layer->parent.get()) {
+            if (auto it = layer->values.find(name); it != layer->values.end()) {
+                return it->second;
+            }
+        }
+        return 0;
+    }
+
+    /// @param index the zero-based registration index of the symbol, less than Count()
+    /// @returns the name of the symbol
+    std::string_view NameAt(uint32_t index) const {
+        auto* layer = this;
+        while (index < layer->base) {
+            layer = layer->parent.get();
+        }
+        return layer->names[index - layer->base];
+    }
+
+    /// Copies `name` into the blocks
+    /// @param name the name to intern
+    /// @returns a view of the interned copy of `name`, valid for the lifetime of the blocks
+    std::string_view Intern(std::string_view name) {
+        if (name.size() > remaining) {
+            remaining = std::max(name.size(), kBlockSize);
+            blocks.emplace_back(new char[remaining]);
+            next = blocks.back().get();
+        }
+        memcpy(next, name.data(), name.size());
+        std::string_view interned(next, name.size());
+        next += name.size();
+        remaining -= name.size();
+        return interned;
+    }
+
+    /// The layers that this layer overlays, or null for the bottom layer
+    std::shared_ptr<const Names> parent;
+    /// The number of names held by the layers below this layer
+    uint32_t base = 0;
+    /// The names of the symbols of this layer, indexed by the symbol value minus `base` minus one
+    std::vector<std::string_view> names;
+    /// The symbol value of each name of this layer
+    std::unordered_map<std::string_view, uint32_t> values;
+    /// The blocks of memory holding the names of this layer
+    std::vector<std::shared_ptr<char[]>> blocks;
+    /// The start of the unused memory of the last block
+    char* next = nullptr;
+    /// The number of unused bytes in the last block
+    size_t remaining = 0;
+    /// True once the layer has been shared with another table. Shared layers are never modified
+    /// again: the tables that hold them register new names into a new layer on top, so that
+    /// tables used on different threads never write to names that another thread may read. The
+    /// flag is never cleared, so ownership does not depend on the lifetime of the other tables.
+    std::atomic<bool> shared{false};
+};
 
 SymbolTable::SymbolTable(tint::ProgramID program_id) : program_id_(program_id) {}
 
-SymbolTable::SymbolTable(const SymbolTable&) = default;
+SymbolTable::SymbolTable(const SymbolTable& other, tint::ProgramID program_id)
+    : names_(other.names_), program_id_(program_id) {
+    MarkShared();
+}
+
+SymbolTable::SymbolTable(const SymbolTable& other)
+    : names_(other.names_), program_id_(other.program_id_) {
+    MarkShared();
+}
 
 SymbolTable::SymbolTable(SymbolTable&&) = default;
 
 SymbolTable::~SymbolTable() = default;
 
-SymbolTable& SymbolTable::operator=(const SymbolTable& other) = default;
+SymbolTable& SymbolTable::operator=(const SymbolTable& other) {
+    names_ = other.names_;
+    program_id_ = other.program_id_;
+    MarkShared();
+    return *this;
+}
 
 SymbolTable& SymbolTable::operator=(SymbolTable&&) = default;
 
-Symbol SymbolTable::Register(const std::string& name) {
+Symbol SymbolTable::Register(std::string_view name) {
     TINT_ASSERT(Symbol, !name.empty());
 
-    auto it = name_to_symbol_.find(name);
-    if (it != name_to_symbol_.end()) {
-        return it->second;
+    if (auto sym = Get(name); sym.IsValid()) {
+        return sym;
     }
 
-#if TINT_SYMBOL_STORE_DEBUG_NAME
-    Symbol sym(next_symbol_, program_id_, name);
-#else
-    Symbol sym(next_symbol_, program_id_);
-#endif
-    ++next_symbol_;
-
-    name_to_symbol_[name] = sym;
-    symbol_to_name_[sym] = name;
-
-    return sym;
+    auto& names = MutableNames();
+    auto interned = names.Intern(name);
+    names.names.emplace_back(interned);
+    auto value = names.Count();
+    names.values.emplace(interned, value);
+    return SymbolAt(value - 1);
 }
 
-Symbol SymbolTable::Get(const std::string& name) const {
-    auto it = name_to_symbol_.find(name);
-    return it != name_to_symbol_.end() ? it->second : Symbol();
+Symbol SymbolTable::Get(std::string_view name) const {
+    if (names_) {
+        if (auto value = names_->Find(name); value != 0) {
+            return SymbolAt(value - 1);
+        }
+    }
+    return Symbol();
 }
 
 std::string SymbolTable::NameFor(const Symbol symbol) const {
     TINT_ASSERT_PROGRAM_IDS_EQUAL(Symbol, program_id_, symbol);
-    auto it = symbol_to_name_.find(symbol);
-    if (it == symbol_to_name_.end()) {
+    auto value = symbol.value();
+    if (value == 0 || value > Count()) {
         return symbol.to_str();
     }
 
-    return it->second;
+    return std::string(NameAt(value - 1));
 }
 
-Symbol SymbolTable::New(std::string prefix /* = "" */) {
+Symbol SymbolTable::New(std::string_view prefix /* = "" */) {
     if (prefix.empty()) {
         prefix = "tint_symbol";
     }
-    auto it = name_to_symbol_.find(prefix);
-    if (it == name_to_symbol_.end()) {
+    if (!Get(prefix).IsValid()) {
         return Register(prefix);
     }
     std::string name;
     size_t i = 1;
     do {
-        name = prefix + "_" + std::to_string(i++);
-    } while (name_to_symbol_.count(name));
+        name = std::string(prefix) + "_" + std::to_string(i++);
+    } while (Get(name).IsValid());
     return Register(name);
 }
 
+uint32_t SymbolTable::Count() const {
+    return names_ ? names_->Count() : 0;
+}
+
+Symbol SymbolTable::SymbolAt(uint32_t index) const {
+#if TINT_SYMBOL_STORE_DEBUG_NAME
+    return Symbol(index + 1, program_id_, std::string(NameAt(index)));
+#else
+    return Symbol(index + 1, program_id_);
+#endif
+}
+
+std::string_view SymbolTable::NameAt(uint32_t index) const {
+    return names_->NameAt(index);
+}
+
+void SymbolTable::MarkShared() {
+    if (names_) {
+        names_->shared.store(true, std::memory_order_release);
+    }
+}
+
+SymbolTable::Names& SymbolTable::MutableNames() {
+    if (!names_) {
+        names_ = std::make_shared<Names>();
+    } else if (names_->shared.load(std::memory_order_acquire)) {
+        names_ = std::make_shared<Names>(std::shared_ptr<const Names>(names_));
+    }
+    return *names_;
+}
+
 }  // namespace tint
@@ -15,22 +15,36 @@
 #ifndef SRC_TINT_SYMBOL_TABLE_H_
 #define SRC_TINT_SYMBOL_TABLE_H_
 
+#include <memory>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
 #include "src/tint/symbol.h"
 
 namespace tint {
 
-/// Holds mappings from symbols to their associated string names
+/// Holds mappings from symbols to their associated string names.
+///
+/// Names are interned into blocks of memory that are never moved or freed while the table lives,
+/// and are looked up with `std::string_view` keys, so registering an existing name does not
+/// allocate. Copies of a symbol table share the interned names, so copying the symbols of a program
+/// does not copy each name. Shared names are immutable: a table registers new names into a layer of
+/// its own on top of the shared names, so tables that share names can be used on different threads,
+/// and registering a name into a copy does not copy the names that it shares.
 class SymbolTable {
   public:
     /// Constructor
     /// @param program_id the identifier of the program that owns this symbol
     /// table
     explicit SymbolTable(tint::ProgramID program_id);
+    /// Constructor
+    /// @param other the symbol table to copy the symbols of. The symbols of the new table have
+    /// the same values and names as those of `other`, and the names are shared with `other`.
+    /// @param program_id the identifier of the program that owns this symbol table
+    SymbolTable(const SymbolTable& other, tint::ProgramID program_id);
     /// Copy constructor
-    SymbolTable(const SymbolTable&);
+    /// @param other the symbol table to copy. The names are shared with `other`.
+    SymbolTable(const SymbolTable& other);
     /// Move Constructor
     SymbolTable(SymbolTable&&);
     /// Destructor
@@ -48,12 +62,12 @@ class SymbolTable {
     /// Registers a name into the symbol table, returning the Symbol.
     /// @param name the name to register
     /// @returns the symbol representing the given name
-    Symbol Register(const std::string& name);
+    Symbol Register(std::string_view name);
 
     /// Returns the symbol for the given `name`
     /// @param name the name to lookup
     /// @returns the symbol for the name or symbol::kInvalid if not found.
-    Symbol Get(const std::string& name) const;
+    Symbol Get(std::string_view name) const;
 
     /// Returns the name for the given symbol
     /// @param symbol the symbol to retrieve the name for
@@ -66,27 +80,47 @@ class SymbolTable {
     /// @returns a new, unnamed symbol with the given name. If the name is already
     /// taken then this will be suffixed with an underscore and a unique numerical
     /// value
-    Symbol New(std::string name = "");
+    Symbol New(std::string_view name = "");
 
-    /// Foreach calls the callback function `F` for each symbol in the table.
+    /// Foreach calls the callback function `F` for each symbol in the table, in the order the
+    /// symbols were registered.
     /// @param callback must be a function or function-like object with the
-    /// signature: `void(Symbol, const std::string&)`
+    /// signature: `void(Symbol, std::string_view)`
     template <typename F>
     void Foreach(F&& callback) const {
-        for (auto it : symbol_to_name_) {
-            callback(it.first, it.second);
+        for (uint32_t i = 0, n = Count(); i < n; i++) {
+            callback(SymbolAt(i), NameAt(i));
         }
     }
 
+    /// @returns the number of symbols in the table
+    uint32_t Count() const;
+
+    /// @returns true if the table holds no symbols
+    bool IsEmpty() const { return Count() == 0; }
+
     /// @returns the identifier of the Program that owns this symbol table.
     tint::ProgramID ProgramID() const { return program_id_; }
 
   private:
-    // The value to be associated to the next registered symbol table entry.
-    uint32_t next_symbol_ = 1;
+    struct Names;
+
+    /// @returns the symbol with the zero-based registration index `index`
+    Symbol SymbolAt(uint32_t index) const;
+
+    /// @returns the name of the symbol with the zero-based registration index `index`
+    std::string_view NameAt(uint32_t index) const;
+
+    /// Marks the names of this table as shared, so that neither this table nor the tables that
+    /// share the names modify them again.
+    void MarkShared();
+
+    /// @returns the layer of names that this table registers new names into, adding a new layer
+    /// on top of the names of this table if they have been shared with another table
+    Names& MutableNames();
 
-    std::unordered_map<Symbol, std::string> symbol_to_name_;
-    std::unordered_map<std::string, Symbol> name_to_symbol_;
+    /// The interned names, shared between copies of the table. Null until a name is registered.
+    std::shared_ptr<Names> names_;
     tint::ProgramID program_id_;
 };
 
@@ -14,6 +14,11 @@
 
 #include "src/tint/symbol_table.h"
 
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest-spi.h"
 
 namespace tint {
@@ -49,6 +54,180 @@ TEST_F(SymbolTableTest, ReturnsBlankForMissingSymbol) {
     EXPECT_EQ("$2", s.NameFor(Symbol(2, program_id)));
 }
 
+TEST_F(SymbolTableTest, RegistersStringView) {
+    auto program_id = ProgramID::New();
+    SymbolTable s{program_id};
+    std::string source = "name another_name";
+    auto sym = s.Register(std::string_view(source).substr(0, 4));
+    EXPECT_EQ(Symbol(1, program_id), sym);
+    source = "xxxx";
+    EXPECT_EQ("name", s.NameFor(sym));
+    EXPECT_EQ(sym, s.Get("name"));
+    EXPECT_FALSE(s.Get("another_name").IsValid());
+}
+
+TEST_F(SymbolTableTest, NewSuffixesTakenNames) {
+    auto program_id = ProgramID::New();
+    SymbolTable s{program_id};
+    EXPECT_EQ("name", s.NameFor(s.New("name")));
+    EXPECT_EQ("name_1", s.NameFor(s.New("name")));
+    EXPECT_EQ("name_2", s.NameFor(s.New("name")));
+    EXPECT_EQ("tint_symbol", s.NameFor(s.New()));
+}
+
+TEST_F(SymbolTableTest, CopiesShareNamesUntilRegister) {
+    auto program_id = ProgramID::New();
+    SymbolTable a{program_id};
+    auto name = a.Register("name");
+    SymbolTable b{a};
+    EXPECT_EQ(name, b.Get("name"));
+
+    auto b_only = b.Register("b_only");
+    auto a_only = a.Register("a_only");
+    EXPECT_EQ(Symbol(2, program_id), b_only);
+    EXPECT_EQ(Symbol(2, program_id), a_only);
+    EXPECT_EQ("b_only", b.NameFor(b_only));
+    EXPECT_EQ("a_only", a.NameFor(a_only));
+    EXPECT_FALSE(a.Get("b_only").IsValid());
+    EXPECT_FALSE(b.Get("a_only").IsValid());
+    EXPECT_EQ("name", a.NameFor(name));
+    EXPECT_EQ("name", b.NameFor(name));
+}
+
+TEST_F(SymbolTableTest, ShareWithProgramID) {
+    auto a_id = ProgramID::New();
+    auto b_id = ProgramID::New();
+    SymbolTable a{a_id};
+    a.Register("x");
+    a.Register("y");
+    SymbolTable b{a, b_id};
+    EXPECT_EQ(b_id, b.ProgramID());
+    EXPECT_EQ(Symbol(2, b_id), b.Get("y"));
+    EXPECT_EQ("x", b.NameFor(Symbol(1, b_id)));
+    EXPECT_EQ(Symbol(3, b_id), b.Register("z"));
+    EXPECT_EQ(2u, a.Count());
+    EXPECT_EQ(3u, b.Count());
+}
+
+TEST_F(SymbolTableTest, SourceCopiesNamesAfterCopyIsDestroyed) {
+    auto program_id = ProgramID::New();
+    SymbolTable a{program_id};
+    auto x = a.Register("x");
+    {
+        SymbolTable b{a, ProgramID::New()};
+        EXPECT_EQ(1u, b.Count());
+    }
+    auto y = a.Register("y");
+    EXPECT_EQ("x", a.NameFor(x));
+    EXPECT_EQ("y", a.NameFor(y));
+    EXPECT_EQ(2u, a.Count());
+}
+
+TEST_F(SymbolTableTest, ChainOfCopies) {
+    auto program_id = ProgramID::New();
+    SymbolTable a{program_id};
+    for (int i = 0; i < 1000; i++) {
+        a.Register("a_" + std::to_string(i));
+    }
+    std::vector<SymbolTable> tables;
+    tables.reserve(51);
+    tables.emplace_back(a, ProgramID::New());
+    for (int generation = 0; generation < 50; generation++) {
+        // Register more names than a new layer copies from the layers below it every few copies.
+        int count = generation % 5 == 0 ? 300 : 3;
+        auto& table = tables.back();
+        for (int i = 0; i < count; i++) {
+            table.Register("g" + std::to_string(generation) + "_" + std::to_string(i));
+        }
+        tables.emplace_back(table, ProgramID::New());
+    }
+
+    EXPECT_EQ(1000u, a.Count());
+    uint32_t expected_count = 1000;
+    for (int generation = 0; generation < 50; generation++) {
+        expected_count += generation % 5 == 0 ? 300 : 3;
+        EXPECT_EQ(expected_count, tables[static_cast<size_t>(generation)].Count());
+    }
+
+    auto& last = tables.back();
+    EXPECT_EQ(expected_count, last.Count());
+    EXPECT_EQ(Symbol(1, last.ProgramID()), last.Get("a_0"));
+    EXPECT_EQ(Symbol(1001, last.ProgramID()), last.Get("g0_0"));
+    EXPECT_EQ(Symbol(1301, last.ProgramID()), last.Get("g1_0"));
+    EXPECT_EQ("g49_2", last.NameFor(Symbol(expected_count, last.ProgramID())));
+    EXPECT_FALSE(tables[9].Get("g10_0").IsValid());
+    EXPECT_EQ(Symbol(expected_count + 1, last.ProgramID()), last.Register("a_0_new"));
+
+    uint32_t expected_value = 1;
+    last.Foreach([&](Symbol sym, std::string_view name) {
+        EXPECT_EQ(expected_value++, sym.value());
+        EXPECT_EQ(sym, last.Get(name));
+    });
+    EXPECT_EQ(expected_count + 2, expected_value);
+}
+
+TEST_F(SymbolTableTest, RegisterInSharedTablesOnThreads) {
+    auto program_id = ProgramID::New();
+    SymbolTable a{program_id};
+    for (int i = 0; i < 100; i++) {
+        a.Register("shared_" + std::to_string(i));
+    }
+
+    constexpr int kNumThreads = 4;
+    std::vector<SymbolTable> tables;
+    for (int t = 0; t < kNumThreads; t++) {
+        tables.emplace_back(a, ProgramID::New());
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; t++) {
+        threads.emplace_back([&tables, t] {
+            auto& table = tables[static_cast<size_t>(t)];
+            for (int i = 0; i < 100; i++) {
+                table.Register("thread" + std::to_string(t) + "_" + std::to_string(i));
+                table.Get("shared_" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(100u, a.Count());
+    for (int t = 0; t < kNumThreads; t++) {
+        auto& table = tables[static_cast<size_t>(t)];
+        EXPECT_EQ(200u, table.Count());
+        EXPECT_EQ("shared_99", table.NameFor(Symbol(100, table.ProgramID())));
+        EXPECT_EQ("thread" + std::to_string(t) + "_0",
+                  table.NameFor(Symbol(101, table.ProgramID())));
+    }
+}
+
+TEST_F(SymbolTableTest, ForeachInRegistrationOrder) {
+    auto program_id = ProgramID::New();
+    SymbolTable s{program_id};
+    s.Register("c");
+    s.Register("a");
+    s.Register("b");
+    std::string names;
+    uint32_t expected_value = 1;
+    s.Foreach([&](Symbol sym, std::string_view name) {
+        EXPECT_EQ(expected_value++, sym.value());
+        names += name;
+    });
+    EXPECT_EQ("cab", names);
+}
+
+TEST_F(SymbolTableTest, InternsLongNames) {
+    auto program_id = ProgramID::New();
+    SymbolTable s{program_id};
+    std::string long_name(10000, 'a');
+    auto short_sym = s.Register("short");
+    auto long_sym = s.Register(long_name);
+    EXPECT_EQ(long_name, s.NameFor(long_sym));
+    EXPECT_EQ("short", s.NameFor(short_sym));
+    EXPECT_EQ(long_sym, s.Get(long_name));
+}
+
 TEST_F(SymbolTableTest, AssertsForBlankString) {
     EXPECT_FATAL_FAILURE(
         {
@@ -14,6 +14,8 @@
 
 #include "src/tint/transform/fold_trivial_single_use_lets.h"
 
+#include <utility>
+
 #include "src/tint/program_builder.h"
 #include "src/tint/sem/block_statement.h"
 #include "src/tint/sem/function.h"
@@ -48,7 +50,12 @@ FoldTrivialSingleUseLets::FoldTrivialSingleUseLets() = default;
 
 FoldTrivialSingleUseLets::~FoldTrivialSingleUseLets() = default;
 
-void FoldTrivialSingleUseLets::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
+Transform::ApplyResult FoldTrivialSingleUseLets::Apply(const Program* program,
+                                                       const DataMap&,
+                                                       DataMap&) const {
+    ProgramBuilder builder;
+    CloneContext ctx(&builder, program);
+    bool made_changes = false;
     for (auto* node : ctx.src->ASTNodes().Objects()) {
         if (auto* block = node->As<ast::BlockStatement>()) {
             auto& stmts = block->statements;
@@ -70,6 +77,7 @@ void FoldTrivialSingleUseLets::Run(CloneContext& ctx, const DataMap&, DataMap&)
                             auto* user_expr = user->Declaration();
                             ctx.Remove(stmts, let_decl);
                             ctx.Replace(user_expr, ctx.Clone(let->constructor));
+                            made_changes = true;
                         }
                         if (!AsTrivialLetDecl(stmts[i])) {
                             // Stop if we hit a statement that isn't the single use of the
@@ -82,7 +90,12 @@ void FoldTrivialSingleUseLets::Run(CloneContext& ctx, const DataMap&, DataMap&)
         }
     }
 
+    if (!made_changes) {
+        return SkipTransform;
+    }
+
     ctx.Clone();
+    return Program(std::move(builder));
 }
 
 }  // namespace tint::transform
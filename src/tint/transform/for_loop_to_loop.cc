@@ -33,7 +33,10 @@ bool ForLoopToLoop::ShouldRun(const Program* program, const DataMap&) const {
     return false;
 }
 
-void ForLoopToLoop::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
+void ForLoopToLoop::Rewrite(CloneContext& ctx,
+                            const DataMap&,
+                            DataMap&,
+                            const std::function<void()>& clone) const {
     ctx.ReplaceAll([&](const ast::ForLoopStatement* for_loop) -> const ast::Statement* {
         utils::Vector<const ast::Statement*, 8> stmts;
         if (auto* cond = for_loop->condition) {
@@ -47,26 +50,28 @@ void ForLoopToLoop::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
             // if (!condition) { break; }
             stmts.Push(ctx.dst->If(not_cond, break_body));
         }
-        for (auto* stmt : for_loop->body->statements) {
-            stmts.Push(ctx.Clone(stmt));
+        // Clone the statements as a list, and the initializer and continuing statements with null
+        // checks, so that statements removed by a transform fused with this one stay removed.
+        for (auto* stmt : ctx.Clone(for_loop->body->statements)) {
+            stmts.Push(stmt);
         }
 
         const ast::BlockStatement* continuing = nullptr;
-        if (auto* cont = for_loop->continuing) {
-            continuing = ctx.dst->Block(ctx.Clone(cont));
+        if (auto* cont = ctx.Clone(for_loop->continuing)) {
+            continuing = ctx.dst->Block(cont);
         }
 
         auto* body = ctx.dst->Block(stmts);
         auto* loop = ctx.dst->create<ast::LoopStatement>(body, continuing);
 
-        if (auto* init = for_loop->initializer) {
-            return ctx.dst->Block(ctx.Clone(init), loop);
+        if (auto* init = ctx.Clone(for_loop->initializer)) {
+            return ctx.dst->Block(init, loop);
         }
 
         return loop;
     });
 
-    ctx.Clone();
+    clone();
 }
 
 }  // namespace tint::transform
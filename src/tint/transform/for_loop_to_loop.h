@@ -15,13 +15,13 @@
 #ifndef SRC_TINT_TRANSFORM_FOR_LOOP_TO_LOOP_H_
 #define SRC_TINT_TRANSFORM_FOR_LOOP_TO_LOOP_H_
 
-#include "src/tint/transform/transform.h"
+#include "src/tint/transform/fused.h"
 
 namespace tint::transform {
 
 /// ForLoopToLoop is a Transform that converts a for-loop statement into a loop
 /// statement. This is required by the SPIR-V writer.
-class ForLoopToLoop final : public Castable<ForLoopToLoop, Transform> {
+class ForLoopToLoop final : public Castable<ForLoopToLoop, FusableTransform> {
   public:
     /// Constructor
     ForLoopToLoop();
@@ -34,14 +34,15 @@ class ForLoopToLoop final : public Castable<ForLoopToLoop, Transform> {
     /// @returns true if this transform should be run for the given program
     bool ShouldRun(const Program* program, const DataMap& data = {}) const override;
 
-  protected:
-    /// Runs the transform using the CloneContext built for transforming a
-    /// program. Run() is responsible for calling Clone() on the CloneContext.
-    /// @param ctx the CloneContext primed with the input program and
-    /// ProgramBuilder
+    /// Registers the rewrites of the transform with `ctx`, and then calls `clone`.
+    /// @param ctx the CloneContext primed with the input program and ProgramBuilder
     /// @param inputs optional extra transform-specific input data
     /// @param outputs optional extra transform-specific output data
-    void Run(CloneContext& ctx, const DataMap& inputs, DataMap& outputs) const override;
+    /// @param clone the function that clones the program
+    void Rewrite(CloneContext& ctx,
+                 const DataMap& inputs,
+                 DataMap& outputs,
+                 const std::function<void()>& clone) const override;
 };
 
 }  // namespace tint::transform
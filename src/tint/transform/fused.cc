@@ -0,0 +1,106 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/transform/fused.h"
+
+#include <utility>
+
+#include "src/tint/program_builder.h"
+
+TINT_INSTANTIATE_TYPEINFO(tint::transform::FusableTransform);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Fused);
+
+namespace tint::transform {
+namespace {
+
+/// Registers the rewrites of `transforms[index]` and the transforms that follow it with `ctx`,
+/// and then clones the program.
+void RewriteAndClone(CloneContext& ctx,
+                     const std::vector<const FusableTransform*>& transforms,
+                     size_t index,
+                     const DataMap& inputs,
+                     DataMap& outputs) {
+    if (index == transforms.size()) {
+        ctx.Clone();
+        return;
+    }
+    transforms[index]->Rewrite(ctx, inputs, outputs, [&] {
+        RewriteAndClone(ctx, transforms, index + 1, inputs, outputs);
+    });
+}
+
+}  // namespace
+
+FusableTransform::FusableTransform() = default;
+
+FusableTransform::~FusableTransform() = default;
+
+bool FusableTransform::MayAddModuleScopeDeclarations(const Program*, const DataMap&) const {
+    return false;
+}
+
+void FusableTransform::Run(CloneContext& ctx, const DataMap& inputs, DataMap& outputs) const {
+    Rewrite(ctx, inputs, outputs, [&] { ctx.Clone(); });
+}
+
+Fused::Fused() = default;
+
+Fused::~Fused() = default;
+
+bool Fused::ShouldRun(const Program* program, const DataMap& data) const {
+    for (auto& transform : transforms_) {
+        if (transform->ShouldRun(program, data)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Transform::ApplyResult Fused::Apply(const Program* program,
+                                    const DataMap& inputs,
+                                    DataMap& outputs) const {
+    const Program* in = program;
+    ApplyResult out;
+
+    // The transforms to apply with the next clone of `in`.
+    std::vector<const FusableTransform*> pending;
+    auto clone = [&] {
+        ProgramBuilder builder;
+        CloneContext ctx(&builder, in);
+        RewriteAndClone(ctx, pending, 0, inputs, outputs);
+        pending.clear();
+        out = Program(std::move(builder));
+        in = &out.value();
+        return in->IsValid();
+    };
+
+    for (auto& transform : transforms_) {
+        if (!transform->ShouldRun(in, inputs)) {
+            continue;
+        }
+        pending.push_back(transform.get());
+        if (transform->MayAddModuleScopeDeclarations(in, inputs)) {
+            if (!clone()) {
+                return out;
+            }
+        }
+    }
+    if (!pending.empty()) {
+        clone();
+    }
+
+    return out;
+}
+
+}  // namespace tint::transform
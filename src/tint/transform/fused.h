@@ -0,0 +1,126 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_TRANSFORM_FUSED_H_
+#define SRC_TINT_TRANSFORM_FUSED_H_
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/tint/transform/transform.h"
+
+namespace tint::transform {
+
+/// FusableTransform is the base class for transforms that only rewrite the program with the
+/// replacement callbacks of the CloneContext, so that the Fused transform can apply several of
+/// them with a single clone of the program.
+///
+/// For the fused result to be the same as running the transforms one after the other, a
+/// FusableTransform must:
+/// * only match nodes of the source program, and not depend on the rewrites made by the
+///   transforms that precede it.
+/// * build its replacement nodes from the callbacks invoked by the clone, so that nodes removed
+///   by another transform are never rewritten.
+/// * clone the statement lists and statements of the nodes that it replaces with
+///   CloneContext::Clone(), and handle statements that clone to nullptr, so that the statements
+///   removed or inserted by another transform are kept that way.
+/// * not replace the same nodes, or register ReplaceAll() for the same types, as another
+///   transform that it is fused with.
+/// * return true from MayAddModuleScopeDeclarations() if it may declare new module-scope
+///   declarations while the program is cloned.
+class FusableTransform : public Castable<FusableTransform, Transform> {
+  public:
+    /// Constructor
+    FusableTransform();
+
+    /// Destructor
+    ~FusableTransform() override;
+
+    /// @param program the program to inspect
+    /// @param data optional extra transform-specific input data
+    /// @returns true if the transform may add module-scope declarations when run on `program`.
+    /// Declarations are added in the order that they are created, so Fused does not clone
+    /// anything after such a transform in the same pass. Returns false by default.
+    virtual bool MayAddModuleScopeDeclarations(const Program* program,
+                                               const DataMap& data = {}) const;
+
+    /// Registers the rewrites of the transform with `ctx`, and then calls `clone`.
+    /// `clone` registers the rewrites of the transforms fused after this one, and clones the
+    /// program. State referenced by the replacement callbacks can therefore be held on the stack
+    /// of Rewrite().
+    /// @param ctx the CloneContext primed with the input program and ProgramBuilder
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @param clone the function that clones the program
+    virtual void Rewrite(CloneContext& ctx,
+                         const DataMap& inputs,
+                         DataMap& outputs,
+                         const std::function<void()>& clone) const = 0;
+
+  protected:
+    /// Runs the transform on its own, calling Rewrite() with a `clone` function that calls
+    /// Clone() on the CloneContext.
+    /// @param ctx the CloneContext primed with the input program and ProgramBuilder
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    void Run(CloneContext& ctx, const DataMap& inputs, DataMap& outputs) const override;
+};
+
+/// Fused is a Transform that applies a sequence of FusableTransforms, producing the same program
+/// as running them in order with a Manager. Instead of cloning and resolving the program once
+/// for each transform, the rewrites of the transforms are registered with a single CloneContext
+/// and applied with one clone.
+/// A transform that may add module-scope declarations ends the clone, and the transforms after
+/// it are applied with another clone of its output.
+class Fused final : public Castable<Fused, Transform> {
+  public:
+    /// Constructor
+    Fused();
+
+    /// Destructor
+    ~Fused() override;
+
+    /// Add a transform of type `T`, constructed with the provided arguments.
+    /// @param args the arguments to forward to the `T` constructor
+    template <typename T, typename... ARGS>
+    void Add(ARGS&&... args) {
+        static_assert(std::is_base_of<FusableTransform, T>::value,
+                      "T does not derive from FusableTransform");
+        transforms_.emplace_back(std::make_unique<T>(std::forward<ARGS>(args)...));
+    }
+
+    /// @param program the program to inspect
+    /// @param data optional extra transform-specific input data
+    /// @returns true if any of the fused transforms should be run for the given program
+    bool ShouldRun(const Program* program, const DataMap& data = {}) const override;
+
+    /// Runs the fused transforms on `program`, returning the transformed program.
+    /// @param program the source program to transform
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns the transformed program, or SkipTransform if none of the transforms need to run
+    ApplyResult Apply(const Program* program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const override;
+
+  private:
+    std::vector<std::unique_ptr<FusableTransform>> transforms_;
+};
+
+}  // namespace tint::transform
+
+#endif  // SRC_TINT_TRANSFORM_FUSED_H_
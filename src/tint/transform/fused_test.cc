@@ -0,0 +1,220 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/transform/fused.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "src/tint/program_builder.h"
+#include "src/tint/transform/for_loop_to_loop.h"
+#include "src/tint/transform/remove_phonies.h"
+#include "src/tint/transform/test_helper.h"
+#include "src/tint/transform/vectorize_scalar_matrix_constructors.h"
+#include "src/tint/transform/while_to_loop.h"
+
+namespace tint::transform {
+namespace {
+
+class FusedTest : public TransformTest {
+  protected:
+    /// @param fused the transform to inspect
+    /// @param src the input WGSL source
+    /// @returns true if `fused` should be run for the program parsed from `src`
+    bool ShouldRun(const Fused& fused, std::string src) {
+        Source::File file("test", std::move(src));
+        auto program = reader::wgsl::Parse(&file);
+        EXPECT_TRUE(program.IsValid()) << program.Diagnostics().str();
+        return fused.ShouldRun(&program);
+    }
+};
+
+/// DeclareHelper is a FusableTransform that declares an empty function the first time that a
+/// variable declaration statement is cloned.
+class DeclareHelper final : public Castable<DeclareHelper, FusableTransform> {
+  public:
+    bool MayAddModuleScopeDeclarations(const Program*, const DataMap&) const override {
+        return true;
+    }
+
+    void Rewrite(CloneContext& ctx,
+                 const DataMap&,
+                 DataMap&,
+                 const std::function<void()>& clone) const override {
+        bool declared = false;
+        ctx.ReplaceAll([&](const ast::VariableDeclStatement*) -> const ast::Statement* {
+            if (!declared) {
+                ctx.dst->Func(ctx.dst->Symbols().New("helper"), utils::Empty, ctx.dst->ty.void_(),
+                              utils::Empty);
+                declared = true;
+            }
+            return nullptr;
+        });
+        clone();
+    }
+};
+
+TEST_F(FusedTest, ShouldRunEmptyModule) {
+    auto* src = R"()";
+
+    Fused fused;
+    fused.Add<RemovePhonies>();
+    fused.Add<WhileToLoop>();
+
+    EXPECT_FALSE(ShouldRun(fused, src));
+}
+
+TEST_F(FusedTest, ShouldRunHasWhile) {
+    auto* src = R"(
+fn f() {
+  while (true) {
+    break;
+  }
+}
+)";
+
+    Fused fused;
+    fused.Add<RemovePhonies>();
+    fused.Add<WhileToLoop>();
+
+    EXPECT_TRUE(ShouldRun(fused, src));
+}
+
+TEST_F(FusedTest, NoTransforms) {
+    auto* src = R"(
+fn f() {
+  _ = 1;
+}
+)";
+
+    auto fused = std::make_unique<Fused>();
+    auto got = Run(src, std::move(fused));
+
+    EXPECT_EQ(src, str(got));
+}
+
+TEST_F(FusedTest, MatchesSequentialTransforms) {
+    auto* src = R"(
+fn g() -> i32 {
+  return 1;
+}
+
+fn f(a : f32) {
+  _ = g();
+  for (var i = 0; (i < 4); i++) {
+    var m = mat2x2<f32>(a, 0.0, 0.0, a);
+    while ((i < g())) {
+      _ = mat2x2<f32>(a, a, a, a);
+      break;
+    }
+  }
+  for (_ = 1; (a < 2.0); _ = 2) {
+    break;
+  }
+}
+)";
+
+    auto* expect = R"(
+fn g() -> i32 {
+  return 1;
+}
+
+fn f(a : f32) {
+  g();
+  {
+    var i = 0;
+    loop {
+      if (!((i < 4))) {
+        break;
+      }
+      var m = mat2x2<f32>(vec2<f32>(a, 0.0), vec2<f32>(0.0, a));
+      loop {
+        if (!((i < g()))) {
+          break;
+        }
+        break;
+      }
+
+      continuing {
+        i++;
+      }
+    }
+  }
+  loop {
+    if (!((a < 2.0))) {
+      break;
+    }
+    break;
+  }
+}
+)";
+
+    auto fused = std::make_unique<Fused>();
+    fused->Add<RemovePhonies>();
+    fused->Add<VectorizeScalarMatrixConstructors>();
+    fused->Add<ForLoopToLoop>();
+    fused->Add<WhileToLoop>();
+    auto got = Run(src, std::move(fused));
+
+    EXPECT_EQ(expect, str(got));
+    EXPECT_EQ(str(Run<RemovePhonies, VectorizeScalarMatrixConstructors, ForLoopToLoop,
+                      WhileToLoop>(src)),
+              str(got));
+}
+
+TEST_F(FusedTest, ModuleScopeDeclarationsKeepSequentialOrder) {
+    auto* src = R"(
+fn g() -> i32 {
+  return 1;
+}
+
+fn f() {
+  var v = 1;
+  _ = (g() + g());
+}
+)";
+
+    // RemovePhonies declares the sink before DeclareHelper declares its helper, as it would if
+    // the transforms were run one after the other.
+    auto* expect = R"(
+fn g() -> i32 {
+  return 1;
+}
+
+fn phony_sink(p0 : i32, p1 : i32) {
+}
+
+fn helper() {
+}
+
+fn f() {
+  var v = 1;
+  phony_sink(g(), g());
+}
+)";
+
+    auto fused = std::make_unique<Fused>();
+    fused->Add<RemovePhonies>();
+    fused->Add<DeclareHelper>();
+    auto got = Run(src, std::move(fused));
+
+    EXPECT_EQ(expect, str(got));
+    EXPECT_EQ(str(Run<RemovePhonies, DeclareHelper>(src)), str(got));
+}
+
+}  // namespace
+}  // namespace tint::transform
+
+TINT_INSTANTIATE_TYPEINFO(tint::transform::DeclareHelper);
@@ -14,6 +14,12 @@
 
 #include "src/tint/transform/manager.h"
 
+#include <chrono>
+#include <utility>
+
+#include "src/tint/transform/single_entry_point.h"
+#include "src/tint/utils/parallel_for.h"
+
 /// If set to 1 then the transform::Manager will dump the WGSL of the program
 /// before and after each transform. Helpful for debugging bad output.
 #define TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM 0
@@ -25,13 +31,25 @@
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Config);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Statistics);
 
 namespace tint::transform {
 
+Manager::Config::Config(bool collect) : collect_statistics(collect) {}
+Manager::Config::Config(const Config&) = default;
+Manager::Config::~Config() = default;
+
+Manager::Statistics::Statistics() = default;
+Manager::Statistics::Statistics(const Statistics&) = default;
+Manager::Statistics::~Statistics() = default;
+
 Manager::Manager() = default;
 Manager::~Manager() = default;
 
-Output Manager::Run(const Program* program, const DataMap& data) const {
+Transform::ApplyResult Manager::Apply(const Program* program,
+                                      const DataMap& inputs,
+                                      DataMap& outputs) const {
     const Program* in = program;
 
 #if TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
@@ -46,19 +64,51 @@ Output Manager::Run(const Program* program, const DataMap& data) const {
     };
 #endif
 
-    Output out;
+    Statistics* statistics = nullptr;
+    if (auto* cfg = inputs.Get<Config>(); cfg && cfg->collect_statistics) {
+        statistics = outputs.Get<Statistics>();
+        if (!statistics) {
+            outputs.Add<Statistics>();
+            statistics = outputs.Get<Statistics>();
+        }
+    }
+
+    ApplyResult out;
     for (const auto& transform : transforms_) {
-        if (!transform->ShouldRun(in, data)) {
+        if (!transform->ShouldRun(in, inputs)) {
             TINT_IF_PRINT_PROGRAM(std::cout << "Skipping " << transform->TypeInfo().name
                                             << std::endl);
             continue;
         }
         TINT_IF_PRINT_PROGRAM(print_program("Input to", transform.get()));
 
-        auto res = transform->Run(in, data);
-        out.program = std::move(res.program);
-        out.data.Add(std::move(res.data));
-        in = &out.program;
+        std::chrono::steady_clock::time_point start;
+        if (statistics) {
+            start = std::chrono::steady_clock::now();
+        }
+        auto res = transform->Apply(in, inputs, outputs);
+        if (statistics) {
+            auto end = std::chrono::steady_clock::now();
+            const Program* result = res ? &res.value() : in;
+            TransformStatistics transform_statistics;
+            transform_statistics.type = &transform->TypeInfo();
+            transform_statistics.duration =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+            transform_statistics.skipped = !res.has_value();
+            transform_statistics.ast_node_count = result->ASTNodes().Count();
+            transform_statistics.sem_node_count = result->SemNodes().Count();
+            transform_statistics.allocated_bytes =
+                result->ASTNodes().AllocatedBytes() + result->SemNodes().AllocatedBytes();
+            statistics->transforms.emplace_back(transform_statistics);
+        }
+
+        if (!res) {
+            TINT_IF_PRINT_PROGRAM(std::cout << "No changes made by " << transform->TypeInfo().name
+                                            << std::endl);
+            continue;
+        }
+        out = std::move(res);
+        in = &out.value();
         if (!in->IsValid()) {
             TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform.get()));
             return out;
@@ -69,11 +119,38 @@ Output Manager::Run(const Program* program, const DataMap& data) const {
         }
     }
 
-    if (program == in) {
-        out.program = program->Clone();
-    }
-
     return out;
 }
 
+std::vector<Output> Manager::RunForEntryPoints(const Program* program,
+                                               const std::vector<std::string>& entry_points,
+                                               const DataMap& data,
+                                               const EntryPointCallback& callback) const {
+    TINT_ASSERT(Transform, data.Get<SingleEntryPoint::Config>() == nullptr);
+
+    std::vector<Output> outputs(entry_points.size());
+    const SingleEntryPoint single_entry_point;
+    const Transform& strip = single_entry_point;
+
+    // The input program is only read, so the entry points can be processed without any other
+    // synchronization.
+    utils::ParallelFor(entry_points.size(), 0, [&](size_t i, size_t) {
+        DataMap single_entry_point_data;
+        single_entry_point_data.Add<SingleEntryPoint::Config>(entry_points[i]);
+        auto stripped = strip.Run(program, single_entry_point_data);
+
+        Output& out = outputs[i];
+        if (!stripped.program.IsValid()) {
+            out = std::move(stripped);
+            return;
+        }
+        out = Run(&stripped.program, data);
+        if (callback && out.program.IsValid()) {
+            callback(i, out);
+        }
+    });
+
+    return outputs;
+}
+
 }  // namespace tint::transform
@@ -15,7 +15,10 @@
 #ifndef SRC_TINT_TRANSFORM_MANAGER_H_
 #define SRC_TINT_TRANSFORM_MANAGER_H_
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -29,6 +32,61 @@ namespace tint::transform {
 /// the error can be retrieved with the Output's diagnostics.
 class Manager final : public Castable<Manager, Transform> {
   public:
+    /// Statistics about a transform run by a Manager
+    struct TransformStatistics {
+        /// The type of the transform that was run. The type is kept instead of the transform, as
+        /// the statistics may outlive the Manager that owns the transform.
+        const tint::TypeInfo* type = nullptr;
+        /// The wall time spent running the transform
+        std::chrono::nanoseconds duration{};
+        /// True if the transform returned SkipTransform, in which case the node counts are those
+        /// of its unmodified input program
+        bool skipped = false;
+        /// The number of AST nodes of the output program
+        size_t ast_node_count = 0;
+        /// The number of semantic nodes of the output program
+        size_t sem_node_count = 0;
+        /// The number of bytes allocated for the AST and semantic nodes of the output program
+        size_t allocated_bytes = 0;
+    };
+
+    /// Configuration options for the Manager
+    struct Config final : public Castable<Config, transform::Data> {
+        /// Constructor
+        /// @param collect_statistics true to collect statistics about the transforms run
+        explicit Config(bool collect_statistics = false);
+
+        /// Copy constructor
+        Config(const Config&);
+
+        /// Destructor
+        ~Config() override;
+
+        /// Set to `true` to time the transforms and count the nodes of their output programs,
+        /// reporting them in the Statistics of the output DataMap. Statistics are not collected
+        /// by default, as they add to the cost of every transform.
+        bool collect_statistics = false;
+    };
+
+    /// Statistics produced by the Manager about the transforms it ran, when requested with a
+    /// Config in the input DataMap.
+    /// The Manager adds the Statistics to the output DataMap of each run, or appends to the
+    /// Statistics already there, so a Manager run as a transform of another Manager adds the
+    /// statistics of its own transforms before those of the outer Manager.
+    struct Statistics final : public Castable<Statistics, transform::Data> {
+        /// Constructor
+        Statistics();
+
+        /// Copy constructor
+        Statistics(const Statistics&);
+
+        /// Destructor
+        ~Statistics() override;
+
+        /// The statistics of each transform that was run, in the order they finished
+        std::vector<TransformStatistics> transforms;
+    };
+
     /// Constructor
     Manager();
     ~Manager() override;
@@ -47,11 +105,39 @@ class Manager final : public Castable<Manager, Transform> {
         transforms_.emplace_back(std::make_unique<T>(std::forward<ARGS>(args)...));
     }
 
-    /// Runs the transforms on `program`, returning the transformation result.
+    /// Runs the transforms on `program`, returning the transformed program.
+    /// Transforms that return SkipTransform are not cloned through: the next transform is applied
+    /// to the program produced by the last transform that made changes.
+    /// @param program the source program to transform
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns the transformed program, or SkipTransform if no transform modified `program`
+    ApplyResult Apply(const Program* program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const override;
+
+    /// Callback invoked by RunForEntryPoints() with the output for each entry point.
+    /// The first argument is the index of the entry point in the list of entry points.
+    using EntryPointCallback = std::function<void(size_t, Output&)>;
+
+    /// Runs the transforms for each of the entry points of `program`.
+    /// For each entry point, the SingleEntryPoint transform is applied to `program` to strip all
+    /// the other entry points, and then the transforms of this manager are run on the result.
+    /// The entry points are processed concurrently with utils::ParallelFor(), on up to
+    /// std::thread::hardware_concurrency() threads, one of which is the calling thread.
+    /// The transforms of this manager must therefore not hold any mutable state.
     /// @param program the source program to transform
-    /// @param data optional extra transform-specific input data
-    /// @returns the transformed program and diagnostics
-    Output Run(const Program* program, const DataMap& data = {}) const override;
+    /// @param entry_points the names of the entry points to generate a program for
+    /// @param data optional extra transform-specific input data, shared by all the entry points.
+    /// It must not contain a SingleEntryPoint::Config.
+    /// @param callback optional callback invoked with the output of each entry point, on the
+    /// thread that transformed it. This can be used to run a writer on the output concurrently.
+    /// The callback is not invoked for outputs that are not valid.
+    /// @returns the transformed programs and diagnostics, in the order of `entry_points`
+    std::vector<Output> RunForEntryPoints(const Program* program,
+                                          const std::vector<std::string>& entry_points,
+                                          const DataMap& data = {},
+                                          const EntryPointCallback& callback = {}) const;
 
   private:
     std::vector<std::unique_ptr<Transform>> transforms_;
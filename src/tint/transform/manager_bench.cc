@@ -0,0 +1,110 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "src/tint/bench/benchmark.h"
+#include "src/tint/transform/expand_compound_assignment.h"
+#include "src/tint/transform/fold_trivial_single_use_lets.h"
+#include "src/tint/transform/loop_to_for_loop.h"
+#include "src/tint/transform/manager.h"
+#include "src/tint/transform/promote_side_effects_to_decl.h"
+#include "src/tint/transform/remove_continue_in_switch.h"
+#include "src/tint/transform/remove_phonies.h"
+#include "src/tint/transform/simplify_pointers.h"
+#include "src/tint/transform/unshadow.h"
+#include "src/tint/transform/unwind_discard_functions.h"
+#include "src/tint/transform/vectorize_scalar_matrix_constructors.h"
+
+namespace tint::transform {
+namespace {
+
+/// AlwaysClone wraps a transform, producing a new program even when the wrapped transform makes
+/// no changes. This measures the cost of the pipeline when transforms cannot be skipped.
+class AlwaysClone final : public Transform {
+  public:
+    /// Constructor
+    /// @param transform the wrapped transform
+    explicit AlwaysClone(std::unique_ptr<Transform> transform)
+        : transform_(std::move(transform)) {}
+
+    /// @copydoc Transform::Apply
+    ApplyResult Apply(const Program* program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const override {
+        if (auto result = transform_->Apply(program, inputs, outputs)) {
+            return result;
+        }
+        return program->Clone();
+    }
+
+  private:
+    std::unique_ptr<Transform> transform_;
+};
+
+/// Adds the transforms shared by the backend sanitizers that don't require any configuration.
+/// @param manager the manager to add the transforms to
+/// @param always_clone if true, each transform is wrapped in an AlwaysClone
+void AddTransforms(Manager& manager, bool always_clone) {
+    auto add = [&](std::unique_ptr<Transform> transform) {
+        if (always_clone) {
+            transform = std::make_unique<AlwaysClone>(std::move(transform));
+        }
+        manager.append(std::move(transform));
+    };
+    add(std::make_unique<Unshadow>());
+    add(std::make_unique<SimplifyPointers>());
+    add(std::make_unique<FoldTrivialSingleUseLets>());
+    add(std::make_unique<LoopToForLoop>());
+    add(std::make_unique<ExpandCompoundAssignment>());
+    add(std::make_unique<PromoteSideEffectsToDecl>());
+    add(std::make_unique<UnwindDiscardFunctions>());
+    add(std::make_unique<VectorizeScalarMatrixConstructors>());
+    add(std::make_unique<RemovePhonies>());
+    add(std::make_unique<RemoveContinueInSwitch>());
+}
+
+void RunTransforms(benchmark::State& state, std::string input_name, bool always_clone) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+
+    Manager manager;
+    AddTransforms(manager, always_clone);
+    for (auto _ : state) {
+        auto out = manager.Run(&program);
+        if (!out.program.IsValid()) {
+            state.SkipWithError(out.program.Diagnostics().str().c_str());
+        }
+    }
+}
+
+void RunTransforms(benchmark::State& state, std::string input_name) {
+    RunTransforms(state, input_name, /* always_clone */ false);
+}
+
+void RunTransformsAlwaysClone(benchmark::State& state, std::string input_name) {
+    RunTransforms(state, input_name, /* always_clone */ true);
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(RunTransforms);
+TINT_BENCHMARK_WGSL_PROGRAMS(RunTransformsAlwaysClone);
+
+}  // namespace
+}  // namespace tint::transform
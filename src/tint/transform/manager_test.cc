@@ -0,0 +1,329 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/transform/manager.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "src/tint/ast/module.h"
+#include "src/tint/transform/remove_phonies.h"
+#include "src/tint/transform/test_helper.h"
+#include "src/tint/transform/unshadow.h"
+
+namespace tint::transform {
+namespace {
+
+class ManagerTest : public TransformTest {
+  protected:
+    /// Parses `src` into a program that is kept alive for the duration of the test.
+    const Program* Parse(std::string src) {
+        file_ = std::make_unique<Source::File>("test", std::move(src));
+        program_ = reader::wgsl::Parse(file_.get());
+        EXPECT_TRUE(program_.IsValid()) << program_.Diagnostics().str();
+        return &program_;
+    }
+
+    /// @returns a DataMap holding a Manager::Config that enables statistics
+    static DataMap CollectStatistics() {
+        DataMap data;
+        data.Add<Manager::Config>(true);
+        return data;
+    }
+
+  private:
+    std::unique_ptr<Source::File> file_;
+    Program program_;
+};
+
+TEST_F(ManagerTest, Statistics) {
+    auto* src = R"(
+fn f(a : i32) {
+  {
+    let a = a;
+    _ = a;
+  }
+}
+)";
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    manager.Add<RemovePhonies>();
+    auto out = manager.Run(Parse(src), CollectStatistics());
+
+    auto* statistics = out.data.Get<Manager::Statistics>();
+    ASSERT_NE(statistics, nullptr);
+    auto& transforms = statistics->transforms;
+    ASSERT_EQ(transforms.size(), 2u);
+    EXPECT_TRUE(transforms[0].type->Is<Unshadow>());
+    EXPECT_FALSE(transforms[0].skipped);
+    EXPECT_GT(transforms[0].ast_node_count, 0u);
+    EXPECT_GT(transforms[0].allocated_bytes, 0u);
+    EXPECT_TRUE(transforms[1].type->Is<RemovePhonies>());
+    EXPECT_FALSE(transforms[1].skipped);
+    EXPECT_EQ(transforms[1].ast_node_count, out.program.ASTNodes().Count());
+    EXPECT_EQ(transforms[1].sem_node_count, out.program.SemNodes().Count());
+    EXPECT_GT(transforms[1].allocated_bytes, 0u);
+}
+
+TEST_F(ManagerTest, Statistics_NotCollectedByDefault) {
+    auto* src = R"(
+fn f(a : i32) {
+  {
+    let a = a;
+    _ = a;
+  }
+}
+)";
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    manager.Add<RemovePhonies>();
+    auto out = manager.Run(Parse(src));
+
+    EXPECT_EQ(out.data.Get<Manager::Statistics>(), nullptr);
+}
+
+TEST_F(ManagerTest, Statistics_SkippedTransform) {
+    auto* src = R"(
+fn f() {
+  let a = 1;
+  _ = a;
+}
+)";
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    manager.Add<RemovePhonies>();
+    const Program* program = Parse(src);
+    auto out = manager.Run(program, CollectStatistics());
+
+    // Unshadow makes no changes as there is no shadowing.
+    auto* statistics = out.data.Get<Manager::Statistics>();
+    ASSERT_NE(statistics, nullptr);
+    auto& transforms = statistics->transforms;
+    ASSERT_EQ(transforms.size(), 2u);
+    EXPECT_TRUE(transforms[0].type->Is<Unshadow>());
+    EXPECT_TRUE(transforms[0].skipped);
+    EXPECT_EQ(transforms[0].ast_node_count, program->ASTNodes().Count());
+    EXPECT_TRUE(transforms[1].type->Is<RemovePhonies>());
+    EXPECT_FALSE(transforms[1].skipped);
+    EXPECT_EQ(transforms[1].ast_node_count, out.program.ASTNodes().Count());
+}
+
+TEST_F(ManagerTest, Statistics_NestedManager) {
+    auto* src = R"(
+fn f(a : i32) {
+  {
+    let a = a;
+    _ = a;
+  }
+}
+)";
+
+    auto inner = std::make_unique<Manager>();
+    inner->Add<Unshadow>();
+    Manager manager;
+    manager.append(std::move(inner));
+    manager.Add<RemovePhonies>();
+    auto out = manager.Run(Parse(src), CollectStatistics());
+
+    // The inner manager's transforms are recorded before the inner manager itself.
+    auto* statistics = out.data.Get<Manager::Statistics>();
+    ASSERT_NE(statistics, nullptr);
+    auto& transforms = statistics->transforms;
+    ASSERT_EQ(transforms.size(), 3u);
+    EXPECT_TRUE(transforms[0].type->Is<Unshadow>());
+    EXPECT_TRUE(transforms[1].type->Is<Manager>());
+    EXPECT_TRUE(transforms[2].type->Is<RemovePhonies>());
+}
+
+TEST_F(ManagerTest, Apply_NoChanges) {
+    auto* src = R"(
+fn f() {
+  let a = 1;
+}
+)";
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    manager.Add<RemovePhonies>();
+
+    DataMap outputs;
+    auto result = manager.Apply(Parse(src), {}, outputs);
+    EXPECT_FALSE(result.has_value());
+
+    // Run() still returns a copy of the input program.
+    auto out = manager.Run(Parse(src));
+    EXPECT_EQ(src, str(out));
+}
+
+TEST_F(ManagerTest, Apply_SomeChanges) {
+    auto* src = R"(
+fn f(a : i32) {
+  {
+    let a = a;
+  }
+}
+)";
+
+    auto* expect = R"(
+fn f(a : i32) {
+  {
+    let a_1 = a;
+  }
+}
+)";
+
+    Manager manager;
+    manager.Add<RemovePhonies>();
+    manager.Add<Unshadow>();
+
+    DataMap outputs;
+    auto result = manager.Apply(Parse(src), {}, outputs);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(expect, transform::str(result.value()));
+}
+
+TEST_F(ManagerTest, RunForEntryPoints) {
+    auto* src = R"(
+var<private> a : f32;
+
+var<private> b : f32;
+
+@vertex
+fn vs() -> @builtin(position) vec4<f32> {
+  let a = a;
+  return vec4<f32>(a);
+}
+
+@fragment
+fn fs() -> @location(0) vec4<f32> {
+  let b = b;
+  return vec4<f32>(b);
+}
+)";
+
+    auto* expect_vs = R"(
+var<private> a : f32;
+
+@vertex
+fn vs() -> @builtin(position) vec4<f32> {
+  let a_1 = a;
+  return vec4<f32>(a_1);
+}
+)";
+
+    auto* expect_fs = R"(
+var<private> b : f32;
+
+@fragment
+fn fs() -> @location(0) vec4<f32> {
+  let b_1 = b;
+  return vec4<f32>(b_1);
+}
+)";
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    auto outputs = manager.RunForEntryPoints(Parse(src), {"vs", "fs"});
+
+    ASSERT_EQ(outputs.size(), 2u);
+    EXPECT_EQ(expect_vs, str(outputs[0]));
+    EXPECT_EQ(expect_fs, str(outputs[1]));
+}
+
+TEST_F(ManagerTest, RunForEntryPoints_NoTransforms) {
+    auto* src = R"(
+@compute @workgroup_size(1)
+fn a() {
+}
+
+@compute @workgroup_size(1)
+fn b() {
+}
+)";
+
+    auto* expect = R"(
+@compute @workgroup_size(1)
+fn b() {
+}
+)";
+
+    Manager manager;
+    auto outputs = manager.RunForEntryPoints(Parse(src), {"b"});
+
+    ASSERT_EQ(outputs.size(), 1u);
+    EXPECT_EQ(expect, str(outputs[0]));
+}
+
+TEST_F(ManagerTest, RunForEntryPoints_InvalidEntryPoint) {
+    auto* src = R"(
+@compute @workgroup_size(1)
+fn main() {
+}
+)";
+
+    auto* expect = R"(
+@compute @workgroup_size(1)
+fn main() {
+}
+)";
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    auto outputs = manager.RunForEntryPoints(Parse(src), {"missing", "main"});
+
+    ASSERT_EQ(outputs.size(), 2u);
+    EXPECT_EQ("error: entry point 'missing' not found", str(outputs[0]));
+    EXPECT_EQ(expect, str(outputs[1]));
+}
+
+TEST_F(ManagerTest, RunForEntryPoints_Callback) {
+    std::string src;
+    std::vector<std::string> entry_points;
+    for (size_t i = 0; i < 32; i++) {
+        entry_points.push_back("ep" + std::to_string(i));
+        src += "@compute @workgroup_size(1) fn " + entry_points.back() + "() {}\n";
+    }
+    entry_points.push_back("missing");
+
+    std::mutex mutex;
+    std::vector<size_t> called(entry_points.size(), 0);
+    auto callback = [&](size_t index, Output& output) {
+        std::lock_guard<std::mutex> lock(mutex);
+        called[index]++;
+        EXPECT_EQ(output.program.AST().Functions().Length(), 1u);
+    };
+
+    Manager manager;
+    manager.Add<Unshadow>();
+    auto outputs = manager.RunForEntryPoints(Parse(src), entry_points, {}, callback);
+
+    ASSERT_EQ(outputs.size(), entry_points.size());
+    for (size_t i = 0; i < entry_points.size() - 1; i++) {
+        EXPECT_EQ(called[i], 1u) << entry_points[i];
+        ASSERT_TRUE(outputs[i].program.IsValid()) << entry_points[i];
+        auto* func = outputs[i].program.AST().Functions()[0];
+        EXPECT_EQ(outputs[i].program.Symbols().NameFor(func->symbol), entry_points[i]);
+    }
+    // The callback isn't called for invalid outputs.
+    EXPECT_EQ(called.back(), 0u);
+    EXPECT_FALSE(outputs.back().program.IsValid());
+}
+
+}  // namespace
+}  // namespace tint::transform
@@ -81,7 +81,31 @@ bool RemovePhonies::ShouldRun(const Program* program, const DataMap&) const {
     return false;
 }
 
-void RemovePhonies::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
+bool RemovePhonies::MayAddModuleScopeDeclarations(const Program* program, const DataMap&) const {
+    // A sink function is declared for phony assignments with more than one side effect, which
+    // requires more than one call.
+    for (auto* node : program->ASTNodes().Objects()) {
+        if (auto* stmt = node->As<ast::AssignmentStatement>()) {
+            if (stmt->lhs->Is<ast::PhonyExpression>()) {
+                size_t num_calls = 0;
+                diag::List diagnostics;
+                ast::TraverseExpressions(stmt->rhs, diagnostics, [&](const ast::CallExpression*) {
+                    num_calls++;
+                    return ast::TraverseAction::Descend;
+                });
+                if (num_calls > 1) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void RemovePhonies::Rewrite(CloneContext& ctx,
+                            const DataMap&,
+                            DataMap&,
+                            const std::function<void()>& clone) const {
     auto& sem = ctx.src->Sem();
 
     std::unordered_map<SinkSignature, Symbol, SinkSignature::Hasher> sinks;
@@ -169,7 +193,7 @@ void RemovePhonies::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
             });
     }
 
-    ctx.Clone();
+    clone();
 }
 
 }  // namespace tint::transform
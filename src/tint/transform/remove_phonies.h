@@ -18,14 +18,14 @@
 #include <string>
 #include <unordered_map>
 
-#include "src/tint/transform/transform.h"
+#include "src/tint/transform/fused.h"
 
 namespace tint::transform {
 
 /// RemovePhonies is a Transform that removes all phony-assignment statements,
 /// while preserving function call expressions in the RHS of the assignment that
 /// may have side-effects. It also removes calls to builtins that return a constant value.
-class RemovePhonies final : public Castable<RemovePhonies, Transform> {
+class RemovePhonies final : public Castable<RemovePhonies, FusableTransform> {
   public:
     /// Constructor
     RemovePhonies();
@@ -38,14 +38,21 @@ class RemovePhonies final : public Castable<RemovePhonies, Transform> {
     /// @returns true if this transform should be run for the given program
     bool ShouldRun(const Program* program, const DataMap& data = {}) const override;
 
-  protected:
-    /// Runs the transform using the CloneContext built for transforming a
-    /// program. Run() is responsible for calling Clone() on the CloneContext.
-    /// @param ctx the CloneContext primed with the input program and
-    /// ProgramBuilder
+    /// @param program the program to inspect
+    /// @param data optional extra transform-specific input data
+    /// @returns true if the transform may add module-scope declarations when run on `program`
+    bool MayAddModuleScopeDeclarations(const Program* program,
+                                       const DataMap& data = {}) const override;
+
+    /// Registers the rewrites of the transform with `ctx`, and then calls `clone`.
+    /// @param ctx the CloneContext primed with the input program and ProgramBuilder
     /// @param inputs optional extra transform-specific input data
     /// @param outputs optional extra transform-specific output data
-    void Run(CloneContext& ctx, const DataMap& inputs, DataMap& outputs) const override;
+    /// @param clone the function that clones the program
+    void Rewrite(CloneContext& ctx,
+                 const DataMap& inputs,
+                 DataMap& outputs,
+                 const std::function<void()>& clone) const override;
 };
 
 }  // namespace tint::transform
@@ -1252,7 +1252,9 @@ Renamer::Config::~Config() = default;
 Renamer::Renamer() = default;
 Renamer::~Renamer() = default;
 
-Output Renamer::Run(const Program* in, const DataMap& inputs) const {
+Transform::ApplyResult Renamer::Apply(const Program* in,
+                                      const DataMap& inputs,
+                                      DataMap& outputs) const {
     ProgramBuilder out;
     // Disable auto-cloning of symbols, since we want to rename them.
     CloneContext ctx(&out, in, false);
@@ -1353,7 +1355,8 @@ Output Renamer::Run(const Program* in, const DataMap& inputs) const {
     });
     ctx.Clone();
 
-    return Output(Program(std::move(out)), std::make_unique<Data>(std::move(remappings)));
+    outputs.Add<Data>(std::move(remappings));
+    return Program(std::move(out));
 }
 
 }  // namespace tint::transform
@@ -71,9 +71,19 @@ class TransformTestBase : public BASE {
     Output Run(std::string in,
                std::unique_ptr<transform::Transform> transform,
                const DataMap& data = {}) {
-        std::vector<std::unique_ptr<transform::Transform>> transforms;
-        transforms.emplace_back(std::move(transform));
-        return Run(std::move(in), std::move(transforms), data);
+        auto file = std::make_unique<Source::File>("test", in);
+        auto program = reader::wgsl::Parse(file.get());
+
+        // Keep this pointer alive after Transform() returns
+        files_.emplace_back(std::move(file));
+
+        if (!program.IsValid()) {
+            return Output(std::move(program));
+        }
+
+        Manager manager;
+        manager.append(std::move(transform));
+        return manager.Run(&program, data);
     }
 
     /// Transforms and returns the WGSL source `in`, transformed using
@@ -46,14 +46,24 @@ Transform::Transform() = default;
 Transform::~Transform() = default;
 
 Output Transform::Run(const Program* program, const DataMap& data /* = {} */) const {
-    ProgramBuilder builder;
-    CloneContext ctx(&builder, program);
     Output output;
-    Run(ctx, data, output.data);
-    output.program = Program(std::move(builder));
+    if (auto result = Apply(program, data, output.data)) {
+        output.program = std::move(result.value());
+    } else {
+        output.program = program->Clone();
+    }
     return output;
 }
 
+Transform::ApplyResult Transform::Apply(const Program* program,
+                                        const DataMap& inputs,
+                                        DataMap& outputs) const {
+    ProgramBuilder builder;
+    CloneContext ctx(&builder, program);
+    Run(ctx, inputs, outputs);
+    return Program(std::move(builder));
+}
+
 void Transform::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
     TINT_UNIMPLEMENTED(Transform, ctx.dst->Diagnostics())
         << "Transform::Run() unimplemented for " << TypeInfo().name;
@@ -16,6 +16,7 @@
 #define SRC_TINT_TRANSFORM_TRANSFORM_H_
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -158,11 +159,32 @@ class Transform : public Castable<Transform> {
     /// Destructor
     ~Transform() override;
 
+    /// The return type of Apply()
+    using ApplyResult = std::optional<Program>;
+
+    /// The value returned from Apply() to indicate that the transform does not modify the input
+    /// program
+    static constexpr std::nullopt_t SkipTransform = std::nullopt;
+
     /// Runs the transform on `program`, returning the transformation result.
+    /// If the transform does not modify `program`, the output holds a clone of `program`.
     /// @param program the source program to transform
     /// @param data optional extra transform-specific input data
     /// @returns the transformation result
-    virtual Output Run(const Program* program, const DataMap& data = {}) const;
+    Output Run(const Program* program, const DataMap& data = {}) const;
+
+    /// Runs the transform on `program`, returning the transformed program, or SkipTransform if
+    /// the transform does not modify `program`. Unlike Run(), this does not clone `program` when
+    /// there is nothing to change, which lets the Manager pass the program on to the next
+    /// transform as-is. The default implementation clones `program` with a CloneContext passed
+    /// to the protected Run() overload, and never returns SkipTransform.
+    /// @param program the source program to transform
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns the transformed program, or SkipTransform
+    virtual ApplyResult Apply(const Program* program,
+                              const DataMap& inputs,
+                              DataMap& outputs) const;
 
     /// @param program the program to inspect
     /// @param data optional extra transform-specific input data
@@ -107,6 +107,22 @@ Unshadow::Unshadow() = default;
 
 Unshadow::~Unshadow() = default;
 
+Transform::ApplyResult Unshadow::Apply(const Program* program,
+                                       const DataMap& inputs,
+                                       DataMap& outputs) const {
+    auto& sem = program->Sem();
+    for (auto* node : program->ASTNodes().Objects()) {
+        if (auto* v = node->As<ast::Variable>()) {
+            auto* local = sem.Get<sem::LocalVariable>(v);
+            auto* param = sem.Get<sem::Parameter>(v);
+            if ((local && local->Shadows()) || (param && param->Shadows())) {
+                return Transform::Apply(program, inputs, outputs);
+            }
+        }
+    }
+    return SkipTransform;
+}
+
 void Unshadow::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
     State(ctx).Run();
 }
@@ -29,6 +29,12 @@ class Unshadow final : public Castable<Unshadow, Transform> {
     /// Destructor
     ~Unshadow() override;
 
+    /// @copydoc Transform::Apply
+    /// Returns SkipTransform if no variable shadows another.
+    ApplyResult Apply(const Program* program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const override;
+
   protected:
     struct State;
 
@@ -46,7 +46,25 @@ bool VectorizeScalarMatrixConstructors::ShouldRun(const Program* program, const
     return false;
 }
 
-void VectorizeScalarMatrixConstructors::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
+bool VectorizeScalarMatrixConstructors::MayAddModuleScopeDeclarations(const Program* program,
+                                                                      const DataMap&) const {
+    // A helper function is declared for matrices constructed from a single scalar.
+    for (auto* node : program->ASTNodes().Objects()) {
+        if (auto* expr = node->As<ast::CallExpression>()) {
+            auto* call = program->Sem().Get(expr)->UnwrapMaterialize()->As<sem::Call>();
+            if (call && call->Target()->Is<sem::TypeConstructor>() &&
+                call->Type()->Is<sem::Matrix>() && call->Arguments().Length() == 1) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void VectorizeScalarMatrixConstructors::Rewrite(CloneContext& ctx,
+                                                const DataMap&,
+                                                DataMap&,
+                                                const std::function<void()>& clone) const {
     std::unordered_map<const sem::Matrix*, Symbol> scalar_ctors;
 
     ctx.ReplaceAll([&](const ast::CallExpression* expr) -> const ast::CallExpression* {
@@ -128,7 +146,7 @@ void VectorizeScalarMatrixConstructors::Run(CloneContext& ctx, const DataMap&, D
         return nullptr;
     });
 
-    ctx.Clone();
+    clone();
 }
 
 }  // namespace tint::transform
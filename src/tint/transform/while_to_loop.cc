@@ -34,7 +34,10 @@ bool WhileToLoop::ShouldRun(const Program* program, const DataMap&) const {
     return false;
 }
 
-void WhileToLoop::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
+void WhileToLoop::Rewrite(CloneContext& ctx,
+                          const DataMap&,
+                          DataMap&,
+                          const std::function<void()>& clone) const {
     ctx.ReplaceAll([&](const ast::WhileStatement* w) -> const ast::Statement* {
         utils::Vector<const ast::Statement*, 16> stmts;
         auto* cond = w->condition;
@@ -49,8 +52,10 @@ void WhileToLoop::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
         // if (!condition) { break; }
         stmts.Push(ctx.dst->If(not_cond, break_body));
 
-        for (auto* stmt : w->body->statements) {
-            stmts.Push(ctx.Clone(stmt));
+        // Clone the statements as a list, so that statements removed by a transform fused with
+        // this one stay removed.
+        for (auto* stmt : ctx.Clone(w->body->statements)) {
+            stmts.Push(stmt);
         }
 
         const ast::BlockStatement* continuing = nullptr;
@@ -61,7 +66,7 @@ void WhileToLoop::Run(CloneContext& ctx, const DataMap&, DataMap&) const {
         return loop;
     });
 
-    ctx.Clone();
+    clone();
 }
 
 }  // namespace tint::transform
@@ -15,13 +15,13 @@
 #ifndef SRC_TINT_TRANSFORM_WHILE_TO_LOOP_H_
 #define SRC_TINT_TRANSFORM_WHILE_TO_LOOP_H_
 
-#include "src/tint/transform/transform.h"
+#include "src/tint/transform/fused.h"
 
 namespace tint::transform {
 
 /// WhileToLoop is a Transform that converts a while statement into a loop
 /// statement. This is required by the SPIR-V writer.
-class WhileToLoop final : public Castable<WhileToLoop, Transform> {
+class WhileToLoop final : public Castable<WhileToLoop, FusableTransform> {
   public:
     /// Constructor
     WhileToLoop();
@@ -34,14 +34,15 @@ class WhileToLoop final : public Castable<WhileToLoop, Transform> {
     /// @returns true if this transform should be run for the given program
     bool ShouldRun(const Program* program, const DataMap& data = {}) const override;
 
-  protected:
-    /// Runs the transform using the CloneContext built for transforming a
-    /// program. Run() is responsible for calling Clone() on the CloneContext.
-    /// @param ctx the CloneContext primed with the input program and
-    /// ProgramBuilder
+    /// Registers the rewrites of the transform with `ctx`, and then calls `clone`.
+    /// @param ctx the CloneContext primed with the input program and ProgramBuilder
     /// @param inputs optional extra transform-specific input data
     /// @param outputs optional extra transform-specific output data
-    void Run(CloneContext& ctx, const DataMap& inputs, DataMap& outputs) const override;
+    /// @param clone the function that clones the program
+    void Rewrite(CloneContext& ctx,
+                 const DataMap& inputs,
+                 DataMap& outputs,
+                 const std::function<void()>& clone) const override;
 };
 
 }  // namespace tint::transform
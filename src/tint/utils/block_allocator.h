@@ -199,6 +199,10 @@ class BlockAllocator {
     /// @returns the total number of allocated objects.
     size_t Count() const { return data.count; }
 
+    /// @returns the total number of bytes allocated from the heap for the blocks holding the
+    /// objects.
+    size_t AllocatedBytes() const { return data.block.count * sizeof(Block); }
+
   private:
     BlockAllocator(const BlockAllocator&) = delete;
     BlockAllocator& operator=(const BlockAllocator&) = delete;
@@ -223,6 +227,7 @@ class BlockAllocator {
             }
             block.current->next = nullptr;
             block.current_offset = 0;
+            block.count++;
             if (prev_block) {
                 prev_block->next = block.current;
             } else {
@@ -271,6 +276,8 @@ class BlockAllocator {
             /// Initialized with BLOCK_SIZE so that the first allocation triggers a block
             /// allocation.
             size_t current_offset = BLOCK_SIZE;
+            /// The number of blocks in the linked list
+            size_t count = 0;
         } block;
 
         struct {
@@ -61,6 +61,24 @@ TEST_F(BlockAllocatorTest, Count) {
     }
 }
 
+TEST_F(BlockAllocatorTest, AllocatedBytes) {
+    using Allocator = BlockAllocator<int, 1024>;
+
+    Allocator allocator;
+    EXPECT_EQ(allocator.AllocatedBytes(), 0u);
+    allocator.Create(123);
+    size_t block_size = allocator.AllocatedBytes();
+    EXPECT_GE(block_size, 1024u);
+    for (size_t i = 0; i < 1000; i++) {
+        allocator.Create(123);
+    }
+    EXPECT_GE(allocator.AllocatedBytes(), 1000 * sizeof(int));
+    EXPECT_EQ(allocator.AllocatedBytes() % block_size, 0u);
+
+    allocator.Reset();
+    EXPECT_EQ(allocator.AllocatedBytes(), 0u);
+}
+
 TEST_F(BlockAllocatorTest, ObjectLifetime) {
     using Allocator = BlockAllocator<LifetimeCounter>;
 
@@ -0,0 +1,147 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/utils/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace tint::utils {
+namespace {
+
+/// ThreadPool runs tasks on threads that are created on demand and then wait for the next task.
+/// The pool is never destroyed, so its threads live until the process exits.
+class ThreadPool {
+  public:
+    /// @returns the pool shared by all the calls to ParallelFor()
+    static ThreadPool& Get() {
+        static ThreadPool* pool = new ThreadPool();
+        return *pool;
+    }
+
+    /// Runs `task` on a thread of the pool. A new thread is created if there are more pending
+    /// tasks than idle threads.
+    /// @param task the task to run
+    void Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+            if (tasks_.size() > idle_threads_) {
+                std::thread(&ThreadPool::Loop, this).detach();
+            }
+        }
+        task_available_.notify_one();
+    }
+
+  private:
+    void Loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            idle_threads_++;
+            task_available_.wait(lock, [this] { return !tasks_.empty(); });
+            idle_threads_--;
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::deque<std::function<void()>> tasks_;
+    size_t idle_threads_ = 0;
+};
+
+/// The state of a ParallelFor() call, shared with the tasks posted to the pool. It is kept alive by
+/// the tasks that haven't run yet, after ParallelFor() has returned.
+struct State {
+    /// Calls `fn` for the items that haven't been started yet.
+    /// @param worker the index of the worker
+    void Work(size_t worker) {
+        for (size_t i = next++; i < count; i = next++) {
+            (*fn)(i, worker);
+        }
+    }
+
+    std::atomic<size_t> next{0};
+    size_t count = 0;
+    /// Only dereferenced while ParallelFor() hasn't returned.
+    const std::function<void(size_t, size_t)>* fn = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t running_workers = 0;
+};
+
+}  // namespace
+
+size_t ParallelForWorkerCount(size_t count, size_t max_threads) {
+    if (max_threads == 0) {
+        max_threads = std::thread::hardware_concurrency();
+    }
+    return std::min(count, std::max<size_t>(max_threads, 1));
+}
+
+void ParallelFor(size_t count,
+                 size_t max_threads,
+                 const std::function<void(size_t i, size_t worker)>& fn) {
+    size_t num_workers = ParallelForWorkerCount(count, max_threads);
+    if (num_workers <= 1) {
+        for (size_t i = 0; i < count; i++) {
+            fn(i, 0);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<State>();
+    state->count = count;
+    state->fn = &fn;
+
+    auto& pool = ThreadPool::Get();
+    for (size_t worker = 1; worker < num_workers; worker++) {
+        pool.Post([state, worker] {
+            {
+                // Items are only claimed once, so all the items have been started if `next` has
+                // reached `count`, and `fn` may already be gone.
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->next >= state->count) {
+                    return;
+                }
+                state->running_workers++;
+            }
+            state->Work(worker);
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->running_workers--;
+            }
+            state->done.notify_one();
+        });
+    }
+
+    state->Work(0);
+
+    // All the items have been started. Wait for the workers that are still processing theirs.
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&] { return state->running_workers == 0; });
+}
+
+}  // namespace tint::utils
@@ -0,0 +1,45 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_UTILS_PARALLEL_FOR_H_
+#define SRC_TINT_UTILS_PARALLEL_FOR_H_
+
+#include <cstddef>
+#include <functional>
+
+namespace tint::utils {
+
+/// @param count the number of items
+/// @param max_threads the maximum number of threads, or 0 to use the number of hardware threads
+/// @returns the number of workers that ParallelFor() uses for `count` items and `max_threads`
+size_t ParallelForWorkerCount(size_t count, size_t max_threads);
+
+/// ParallelFor calls `fn(i, worker)` once for every `i` in [0, `count`), spreading the calls over
+/// up to `max_threads` workers, and returns once all the calls have returned. Each worker takes
+/// the next item that hasn't been started yet, in increasing order of `i`.
+///
+/// `worker` is the index of the worker making the call, in [0, ParallelForWorkerCount()). Worker 0
+/// is the calling thread, and the other workers run on threads that are reused across calls to
+/// ParallelFor(). As the calling thread processes items itself, and only waits for the workers
+/// that have started, ParallelFor() can be called from within `fn`.
+/// @param count the number of items
+/// @param max_threads the maximum number of threads, or 0 to use the number of hardware threads
+/// @param fn the function called for each item
+void ParallelFor(size_t count,
+                 size_t max_threads,
+                 const std::function<void(size_t i, size_t worker)>& fn);
+
+}  // namespace tint::utils
+
+#endif  // SRC_TINT_UTILS_PARALLEL_FOR_H_
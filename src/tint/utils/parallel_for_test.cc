@@ -0,0 +1,76 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/utils/parallel_for.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tint::utils {
+namespace {
+
+TEST(ParallelForTest, WorkerCount) {
+    EXPECT_EQ(ParallelForWorkerCount(0, 4), 0u);
+    EXPECT_EQ(ParallelForWorkerCount(2, 4), 2u);
+    EXPECT_EQ(ParallelForWorkerCount(8, 4), 4u);
+    EXPECT_EQ(ParallelForWorkerCount(8, 1), 1u);
+    EXPECT_GE(ParallelForWorkerCount(8, 0), 1u);
+}
+
+TEST(ParallelForTest, NoItems) {
+    ParallelFor(0, 4, [](size_t, size_t) { FAIL(); });
+}
+
+TEST(ParallelForTest, SingleThreadRunsInOrderOnCaller) {
+    std::vector<size_t> items;
+    auto caller = std::this_thread::get_id();
+    ParallelFor(5, 1, [&](size_t i, size_t worker) {
+        EXPECT_EQ(worker, 0u);
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        items.emplace_back(i);
+    });
+    EXPECT_EQ(items, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(ParallelForTest, CallsEachItemOnce) {
+    for (size_t max_threads : {0u, 2u, 8u}) {
+        std::vector<std::atomic<int>> calls(100);
+        std::atomic<bool> bad_worker{false};
+        size_t num_workers = ParallelForWorkerCount(calls.size(), max_threads);
+        ParallelFor(calls.size(), max_threads, [&](size_t i, size_t worker) {
+            calls[i]++;
+            if (worker >= num_workers) {
+                bad_worker = true;
+            }
+        });
+        for (auto& c : calls) {
+            EXPECT_EQ(c, 1);
+        }
+        EXPECT_FALSE(bad_worker);
+    }
+}
+
+TEST(ParallelForTest, Nested) {
+    std::atomic<size_t> calls{0};
+    ParallelFor(8, 4, [&](size_t, size_t) {
+        ParallelFor(8, 4, [&](size_t, size_t) { calls++; });
+    });
+    EXPECT_EQ(calls, 64u);
+}
+
+}  // namespace
+}  // namespace tint::utils
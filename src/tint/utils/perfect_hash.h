@@ -0,0 +1,44 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_UTILS_PERFECT_HASH_H_
+#define SRC_TINT_UTILS_PERFECT_HASH_H_
+
+#include <stdint.h>
+#include <string_view>
+
+namespace tint::utils {
+
+/// PerfectHash returns the 32-bit FNV-1a hash of `str`, with the offset basis perturbed by
+/// `seed`. The high bits are folded into the low bits, as the low bits of a FNV-1a hash only
+/// depend on the low bits of the seed and of the characters. Lookup tables for a fixed set of
+/// strings pick a seed for which no two strings of the set hash to the same slot, so that a lookup
+/// is a single hash and string comparison.
+/// @note this function must be kept in sync with perfectHash() in tools/src/cmd/gen, which
+/// chooses the seeds of the tables of the generated enum parsers.
+/// @param str the string to hash
+/// @param seed the hash seed
+/// @returns the hash of `str`
+constexpr uint32_t PerfectHash(std::string_view str, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : str) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+}  // namespace tint::utils
+
+#endif  // SRC_TINT_UTILS_PERFECT_HASH_H_
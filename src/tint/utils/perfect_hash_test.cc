@@ -0,0 +1,37 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/utils/perfect_hash.h"
+
+#include "gtest/gtest.h"
+
+namespace tint::utils {
+namespace {
+
+TEST(PerfectHashTest, Compiletime) {
+    static_assert(PerfectHash("", 0) == 0x811c1cd9u);
+    static_assert(PerfectHash("hello world", 0) == 0xd58bea2cu);
+    static_assert(PerfectHash("hello world", 1) == 0x5f48a120u);
+    static_assert(PerfectHash("123456789", 42) == 0x5e960524u);
+}
+
+TEST(PerfectHashTest, Runtime) {
+    EXPECT_EQ(PerfectHash("", 0), 0x811c1cd9u);
+    EXPECT_EQ(PerfectHash("hello world", 0), 0xd58bea2cu);
+    EXPECT_EQ(PerfectHash("hello world", 1), 0x5f48a120u);
+    EXPECT_EQ(PerfectHash("123456789", 42), 0x5e960524u);
+}
+
+}  // namespace
+}  // namespace tint::utils
@@ -14,49 +14,295 @@
 
 #include "src/tint/writer/float_to_string.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
-#include <functional>
-#include <iomanip>
-#include <limits>
-#include <sstream>
 
 #include "src/tint/debug.h"
 
 namespace tint::writer {
+namespace {
 
-std::string FloatToString(float f) {
-    // Try printing the float in fixed point, with a smallish limit on the
-    // precision
-    std::stringstream fixed;
-    fixed.flags(fixed.flags() | std::ios_base::showpoint | std::ios_base::fixed);
-    fixed.precision(9);
-    fixed << f;
-
-    // If this string can be parsed without loss of information, use it
-    auto float_equal_no_warning = std::equal_to<float>();
-    if (float_equal_no_warning(std::stof(fixed.str()), f)) {
-        auto str = fixed.str();
-        while (str.length() >= 2 && str[str.size() - 1] == '0' && str[str.size() - 2] != '.') {
-            str.pop_back();
+/// An unsigned integer of up to 256 bits. Used to convert floats that are too large or too small
+/// for 64-bit arithmetic to decimal, without loss of precision.
+class BigUint {
+  public:
+    /// Constructor
+    /// @param value the initial value
+    explicit BigUint(uint64_t value) {
+        limbs_[0] = static_cast<uint32_t>(value);
+        limbs_[1] = static_cast<uint32_t>(value >> 32);
+    }
+
+    /// Multiplies the integer by `m`
+    /// @param m the multiplier
+    void Mul(uint32_t m) {
+        uint64_t carry = 0;
+        for (auto& limb : limbs_) {
+            uint64_t v = static_cast<uint64_t>(limb) * m + carry;
+            limb = static_cast<uint32_t>(v);
+            carry = v >> 32;
+        }
+    }
+
+    /// Divides the integer by `d`
+    /// @param d the divisor
+    /// @returns the remainder
+    uint32_t Div(uint32_t d) {
+        uint64_t rem = 0;
+        for (size_t i = kNumLimbs; i-- > 0;) {
+            uint64_t v = (rem << 32) | limbs_[i];
+            limbs_[i] = static_cast<uint32_t>(v / d);
+            rem = v % d;
+        }
+        return static_cast<uint32_t>(rem);
+    }
+
+    /// @returns true if the integer is zero
+    bool IsZero() const {
+        return std::all_of(std::begin(limbs_), std::end(limbs_), [](uint32_t l) { return l == 0; });
+    }
+
+    /// @param i the bit index
+    /// @returns true if bit `i` is set
+    bool Bit(uint32_t i) const { return (Limb(i / 32) >> (i % 32)) & 1u; }
+
+    /// @param i the bit index
+    /// @returns true if any bit below bit `i` is set
+    bool AnyBitBelow(uint32_t i) const {
+        for (uint32_t l = 0; l < i / 32; l++) {
+            if (limbs_[l] != 0) {
+                return true;
+            }
+        }
+        return (Limb(i / 32) & ((1u << (i % 32)) - 1u)) != 0;
+    }
+
+    /// @param i the number of bits to shift by
+    /// @returns the integer shifted right by `i` bits, truncated to 64 bits
+    uint64_t ShiftedRight(uint32_t i) const {
+        uint32_t shift = i % 32;
+        uint64_t lo = Limb(i / 32) | (static_cast<uint64_t>(Limb(i / 32 + 1)) << 32);
+        uint64_t hi = Limb(i / 32 + 2);
+        return (lo >> shift) | (shift ? hi << (64 - shift) : 0);
+    }
+
+  private:
+    static constexpr uint32_t kNumLimbs = 8;
+
+    uint32_t Limb(uint32_t l) const { return l < kNumLimbs ? limbs_[l] : 0; }
+
+    /// The 32-bit digits of the integer, least significant first
+    uint32_t limbs_[kNumLimbs] = {};
+};
+
+/// Appends the decimal digits of `value` to `out`, left-padded with '0's to `width` digits
+void AppendDecimal(std::string& out, uint64_t value, size_t width = 1) {
+    char digits[20];
+    size_t n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    if (width > n) {
+        out.append(width - n, '0');
+    }
+    while (n > 0) {
+        out += digits[--n];
+    }
+}
+
+/// Appends the lower-case hexadecimal digits of `value` to `out`, left-padded with '0's to
+/// `width` digits
+void AppendHex(std::string& out, uint32_t value, size_t width) {
+    char digits[8];
+    size_t n = 0;
+    do {
+        digits[n++] = "0123456789abcdef"[value & 0xf];
+        value >>= 4;
+    } while (value != 0);
+    if (width > n) {
+        out.append(width - n, '0');
+    }
+    while (n > 0) {
+        out += digits[--n];
+    }
+}
+
+/// Appends the integer `significand * 2^exponent` to `out`
+void AppendInteger(std::string& out, uint32_t significand, int exponent) {
+    BigUint value(significand);
+    for (int e = exponent; e > 0; e -= 31) {
+        value.Mul(1u << std::min(e, 31));
+    }
+    // A float is less than 2^128, which has 39 decimal digits.
+    uint32_t chunks[5];
+    size_t n = 0;
+    do {
+        chunks[n++] = value.Div(1000000000);
+    } while (!value.IsZero());
+    AppendDecimal(out, chunks[--n]);
+    while (n > 0) {
+        AppendDecimal(out, chunks[--n], 9);
+    }
+}
+
+/// Appends `significand * 2^exponent` to `out` in fixed-point notation with 9 fractional digits,
+/// then removes the trailing zeros, leaving at least one fractional digit.
+/// This is equivalent to printing the number with std::fixed and a precision of 9.
+/// @param out the string to append to
+/// @param significand the significand of a non-zero float
+/// @param exponent the binary exponent of the float
+/// @param narrow_below true if the gap to the next float below is half the gap to the next float
+/// above, as it is at the bottom of each binade except the lowest
+/// @returns false, without appending anything, if the printed number would not be parsed as the
+/// same float
+bool AppendFixed(std::string& out, uint32_t significand, int exponent, bool narrow_below) {
+    if (exponent >= 0) {
+        AppendInteger(out, significand, exponent);
+        out += ".0";
+        return true;
+    }
+
+    // The number, scaled by 1e9, is n / 2^shift. Below 2^-40 it rounds to zero.
+    uint32_t shift = static_cast<uint32_t>(-exponent);
+    if (shift >= 64) {
+        return false;
+    }
+    uint64_t n = static_cast<uint64_t>(significand) * 1000000000u;
+    uint64_t q = n >> shift;
+    uint64_t rem = n - (q << shift);
+    uint64_t half = uint64_t{1} << (shift - 1);
+
+    // Round to nearest, ties to even, as printf() does.
+    bool round_up = rem > half || (rem == half && (q & 1) != 0);
+    if (round_up) {
+        q++;
+    }
+
+    // The printed number is parsed as the same float if it is less than half the gap to the
+    // neighbouring float away from the float, in units of 2^exponent / 1e9. A tie is parsed as
+    // the float with the even significand.
+    uint64_t error = round_up ? (uint64_t{1} << shift) - rem : rem;
+    uint64_t limit = (!round_up && narrow_below) ? 250000000u : 500000000u;
+    if (error > limit || (error == limit && (significand & 1) != 0)) {
+        return false;
+    }
+
+    AppendDecimal(out, q / 1000000000u);
+    out += '.';
+    AppendDecimal(out, q % 1000000000u, 9);
+    while (out[out.size() - 1] == '0' && out[out.size() - 2] != '.') {
+        out.pop_back();
+    }
+    return true;
+}
+
+/// Appends `significand * 2^exponent` to `out` with 9 significant digits, in the same format as
+/// printing the number with a precision of 9 and the default floating-point notation.
+/// Only called with numbers less than 2^-6, as all others are printed by AppendFixed().
+/// @param out the string to append to
+/// @param significand the significand of a non-zero float
+/// @param exponent the binary exponent of the float
+void AppendScientific(std::string& out, uint32_t significand, int exponent) {
+    constexpr uint32_t kPow10[] = {1,      10,      100,      1000,      10000,
+                                   100000, 1000000, 10000000, 100000000, 1000000000};
+    uint32_t shift = static_cast<uint32_t>(-exponent);
+
+    // Estimate the decimal exponent, then correct it so that the digits are in [1e8, 1e9).
+    int exp10 = static_cast<int>(
+        std::floor(std::log10(static_cast<double>(significand)) + exponent * 0.30102999566398120));
+    uint64_t digits = 0;
+    while (true) {
+        // digits = round(significand * 2^exponent * 10^(8 - exp10)), ties to even
+        BigUint value(significand);
+        for (int k = 8 - exp10; k > 0; k -= 9) {
+            value.Mul(kPow10[std::min(k, 9)]);
+        }
+        digits = value.ShiftedRight(shift);
+        if (value.Bit(shift - 1) && (value.AnyBitBelow(shift - 1) || (digits & 1) != 0)) {
+            digits++;
+        }
+        if (digits >= kPow10[9]) {
+            exp10++;
+        } else if (digits < kPow10[8]) {
+            exp10--;
+        } else {
+            break;
         }
+    }
 
-        return str;
+    std::string str;
+    AppendDecimal(str, digits);
+    while (str.size() > 1 && str.back() == '0') {
+        str.pop_back();
     }
 
-    // Resort to scientific, with the minimum precision needed to preserve the
-    // whole float
-    std::stringstream sci;
-    sci.precision(std::numeric_limits<float>::max_digits10);
-    sci << f;
-    return sci.str();
+    if (exp10 < -4) {
+        out += str[0];
+        if (str.size() > 1) {
+            out += '.';
+            out.append(str, 1, std::string::npos);
+        }
+        out += exp10 < 0 ? "e-" : "e+";
+        AppendDecimal(out, static_cast<uint64_t>(std::abs(exp10)), 2);
+    } else {
+        out += "0.";
+        out.append(static_cast<size_t>(-exp10 - 1), '0');
+        out += str;
+    }
+}
+
+}  // namespace
+
+std::string FloatToString(float f) {
+    uint32_t float_bits = 0u;
+    std::memcpy(&float_bits, &f, sizeof(float_bits));
+
+    const uint32_t kSignMask = 1u << 31;
+    const uint32_t kExponentMask = 0x7f800000;
+    const uint32_t kMantissaMask = 0x007fffff;
+    const int kMantissaBits = 23;
+
+    std::string out;
+    if (float_bits & kSignMask) {
+        out += '-';
+    }
+
+    const uint32_t biased_exponent = (float_bits & kExponentMask) >> kMantissaBits;
+    const uint32_t mantissa = float_bits & kMantissaMask;
+    if (biased_exponent == 0xff) {
+        out += mantissa ? "nan" : "inf";
+        return out;
+    }
+    if (biased_exponent == 0 && mantissa == 0) {
+        out += "0.0";
+        return out;
+    }
+
+    // The magnitude of the float is significand * 2^exponent.
+    // Subnormals share the exponent of the smallest normal numbers.
+    const uint32_t significand =
+        biased_exponent ? mantissa | (1u << kMantissaBits) : mantissa;
+    const int exponent =
+        static_cast<int>(std::max(biased_exponent, 1u)) - 127 - kMantissaBits;
+    const bool narrow_below = mantissa == 0 && biased_exponent > 1;
+
+    // Try printing the float in fixed point, with a smallish limit on the
+    // precision. Resort to scientific, with the minimum precision needed to
+    // preserve the whole float, if that would lose information.
+    if (!AppendFixed(out, significand, exponent, narrow_below)) {
+        AppendScientific(out, significand, exponent);
+    }
+    return out;
 }
 
 std::string FloatToBitPreservingString(float f) {
     // For the NaN case, avoid handling the number as a floating point value.
     // Some machines will modify the top bit in the mantissa of a NaN.
 
-    std::stringstream ss;
+    std::string out;
 
     uint32_t float_bits = 0u;
     std::memcpy(&float_bits, &f, sizeof(float_bits));
@@ -65,7 +311,7 @@ std::string FloatToBitPreservingString(float f) {
     const uint32_t kSignMask = 1u << 31;
     if (float_bits & kSignMask) {
         // If `f` is -0.0 print -0.0.
-        ss << '-';
+        out += '-';
         // Strip sign bit.
         float_bits = float_bits & (~kSignMask);
     }
@@ -74,7 +320,7 @@ std::string FloatToBitPreservingString(float f) {
         case FP_ZERO:
         case FP_NORMAL:
             std::memcpy(&f, &float_bits, sizeof(float_bits));
-            ss << FloatToString(f);
+            out += FloatToString(f);
             break;
 
         default: {
@@ -97,12 +343,12 @@ std::string FloatToBitPreservingString(float f) {
             int exponent = biased_exponent - kExponentBias;
             uint32_t mantissa = float_bits & kMantissaMask;
 
-            ss << "0x";
+            out += "0x";
 
             if (exponent == 128) {
                 if (mantissa == 0) {
                     //  Infinity case.
-                    ss << "1p+128";
+                    out += "1p+128";
                 } else {
                     //  NaN case.
                     //  Emit the mantissa bits as if they are left-justified after the
@@ -115,8 +361,9 @@ std::string FloatToBitPreservingString(float f) {
                         mantissa >>= 4;
                         mantissaNibbles--;
                     }
-                    ss << "1." << std::hex << std::setfill('0') << std::setw(mantissaNibbles)
-                       << mantissa << "p+128";
+                    out += "1.";
+                    AppendHex(out, mantissa, static_cast<size_t>(mantissaNibbles));
+                    out += "p+128";
                 }
             } else {
                 // Subnormal, and not zero.
@@ -129,7 +376,7 @@ std::string FloatToBitPreservingString(float f) {
                     exponent--;
                 }
                 // Emit the leading 1, and remove it from the mantissa.
-                ss << "1";
+                out += "1";
                 mantissa = mantissa ^ kTopBit;
                 mantissa <<= 1;
                 exponent++;
@@ -141,15 +388,16 @@ std::string FloatToBitPreservingString(float f) {
                         mantissa >>= 4;
                         mantissaNibbles--;
                     }
-                    ss << "." << std::hex << std::setfill('0') << std::setw(mantissaNibbles)
-                       << mantissa;
+                    out += ".";
+                    AppendHex(out, mantissa, static_cast<size_t>(mantissaNibbles));
                 }
                 // Emit the exponent
-                ss << "p" << std::showpos << std::dec << exponent;
+                out += exponent < 0 ? "p-" : "p+";
+                AppendDecimal(out, static_cast<uint64_t>(std::abs(exponent)));
             }
         }
     }
-    return ss.str();
+    return out;
 }
 
 }  // namespace tint::writer
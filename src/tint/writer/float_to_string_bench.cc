@@ -0,0 +1,61 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/writer/float_to_string.h"
+
+namespace tint::writer {
+namespace {
+
+/// @returns 1024 floats of the kinds found in shaders: small integers, weights in [0, 1) and
+/// values of larger and smaller magnitude.
+std::vector<float> MakeFloats() {
+    std::vector<float> floats;
+    for (int i = 0; i < 256; i++) {
+        floats.emplace_back(static_cast<float>(i));
+        floats.emplace_back(static_cast<float>(i) / 255.0f);
+        floats.emplace_back(static_cast<float>(i) * 1234.5678f);
+        floats.emplace_back(static_cast<float>(i) * 1.0e-7f);
+    }
+    return floats;
+}
+
+void FloatToStringLiterals(benchmark::State& state) {
+    auto floats = MakeFloats();
+    for (auto _ : state) {
+        for (auto f : floats) {
+            benchmark::DoNotOptimize(FloatToString(f));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * floats.size()));
+}
+
+void FloatToBitPreservingStringLiterals(benchmark::State& state) {
+    auto floats = MakeFloats();
+    for (auto _ : state) {
+        for (auto f : floats) {
+            benchmark::DoNotOptimize(FloatToBitPreservingString(f));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * floats.size()));
+}
+
+BENCHMARK(FloatToStringLiterals);
+BENCHMARK(FloatToBitPreservingStringLiterals);
+
+}  // namespace
+}  // namespace tint::writer
@@ -15,6 +15,7 @@
 #include "src/tint/writer/float_to_string.h"
 
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <limits>
 
@@ -93,6 +94,44 @@ TEST(FloatToStringTest, Precision) {
     EXPECT_EQ(FloatToString(1e-20f), "9.99999968e-21");
 }
 
+TEST(FloatToStringTest, Rounding) {
+    EXPECT_EQ(FloatToString(0.1f), "0.100000001");
+    EXPECT_EQ(FloatToString(1.0f / 3.0f), "0.333333343");
+    EXPECT_EQ(FloatToString(0.03125f), "0.03125");
+    EXPECT_EQ(FloatToString(-0.015625f), "-0.015625");
+    EXPECT_EQ(FloatToString(1.234567e-4f), "0.000123456703");
+    EXPECT_EQ(FloatToString(1.234567e-5f), "1.23456703e-05");
+}
+
+TEST(FloatToStringTest, LargeIntegers) {
+    EXPECT_EQ(FloatToString(16777216.0f), "16777216.0");
+    EXPECT_EQ(FloatToString(3e20f), "300000006012263202816.0");
+}
+
+TEST(FloatToStringTest, Subnormal) {
+    EXPECT_EQ(FloatToString(MakeFloat(0, 0, 1)), "1.40129846e-45");
+    EXPECT_EQ(FloatToString(MakeFloat(1, 0, 1)), "-1.40129846e-45");
+    EXPECT_EQ(FloatToString(MakeFloat(0, 1, 0)), "1.17549435e-38");
+}
+
+TEST(FloatToStringTest, NonFinite) {
+    EXPECT_EQ(FloatToString(MakeFloat(0, 255, 0)), "inf");
+    EXPECT_EQ(FloatToString(MakeFloat(1, 255, 0)), "-inf");
+}
+
+// Checks that the strings of a sample of floats, spread over every exponent, parse back to the
+// same float.
+TEST(FloatToStringTest, RoundTrip) {
+    for (uint32_t bits = 0; bits < 0x7f800000u; bits += 0x1003u) {
+        for (uint32_t sign : {0u, 1u}) {
+            float f = MakeFloat(sign, bits >> 23, bits);
+            auto str = FloatToString(f);
+            float parsed = std::strtof(str.c_str(), nullptr);
+            EXPECT_EQ(std::memcmp(&parsed, &f, sizeof(f)), 0) << str;
+        }
+    }
+}
+
 // FloatToBitPreservingString
 //
 // First replicate the tests for FloatToString
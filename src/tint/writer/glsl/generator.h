@@ -25,6 +25,7 @@
 #include "src/tint/ast/pipeline_stage.h"
 #include "src/tint/sem/binding_point.h"
 #include "src/tint/sem/sampler_texture_pair.h"
+#include "src/tint/transform/manager.h"
 #include "src/tint/writer/glsl/version.h"
 #include "src/tint/writer/text.h"
 
@@ -75,6 +76,10 @@ struct Options {
 
     /// The GLSL version to emit
     Version version;
+
+    /// Set to `true` to collect the statistics of the transforms run to sanitize the program,
+    /// which are returned in Result::transform_statistics.
+    bool collect_transform_statistics = false;
 };
 
 /// The result produced when generating GLSL.
@@ -99,6 +104,10 @@ struct Result {
 
     /// The list of entry points in the generated GLSL.
     std::vector<std::pair<std::string, ast::PipelineStage>> entry_points;
+
+    /// The statistics of the transforms run to sanitize the program before generating it, if
+    /// Options::collect_transform_statistics was set.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Generate GLSL for a program, according to a set of configuration options.
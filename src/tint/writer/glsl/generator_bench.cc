@@ -15,6 +15,9 @@
 #include <string>
 
 #include "src/tint/ast/module.h"
+#include "src/tint/writer/glsl/generator_impl.h"
+
+// Included after the internal headers, as it includes tint/tint.h.
 #include "src/tint/bench/benchmark.h"
 
 namespace tint::writer::glsl {
@@ -44,7 +47,32 @@ void GenerateGLSL(benchmark::State& state, std::string input_name) {
     }
 }
 
+void SanitizeGLSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+    std::vector<std::string> entry_points;
+    for (auto& fn : program.AST().Functions()) {
+        if (fn->IsEntryPoint()) {
+            entry_points.emplace_back(program.Symbols().NameFor(fn->symbol));
+        }
+    }
+
+    for (auto _ : state) {
+        for (auto& ep : entry_points) {
+            auto sanitized = Sanitize(&program, {}, ep);
+            if (!sanitized.program.IsValid()) {
+                state.SkipWithError(sanitized.program.Diagnostics().str().c_str());
+            }
+        }
+    }
+}
+
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateGLSL);
+TINT_BENCHMARK_WGSL_PROGRAMS(SanitizeGLSL);
 
 }  // namespace
 }  // namespace tint::writer::glsl
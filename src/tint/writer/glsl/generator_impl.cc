@@ -246,10 +246,17 @@ SanitizedResult Sanitize(const Program* in,
     data.Add<transform::CanonicalizeEntryPointIO::Config>(
         transform::CanonicalizeEntryPointIO::ShaderStyle::kGlsl);
 
+    if (options.collect_transform_statistics) {
+        data.Add<transform::Manager::Config>(/* collect_statistics */ true);
+    }
+
     auto out = manager.Run(in, data);
 
     SanitizedResult result;
     result.program = std::move(out.program);
+    if (auto* statistics = out.data.Get<transform::Manager::Statistics>()) {
+        result.transform_statistics = std::move(statistics->transforms);
+    }
     return result;
 }
 
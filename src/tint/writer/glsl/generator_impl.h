@@ -62,6 +62,8 @@ struct SanitizedResult {
 
     /// The sanitized program.
     Program program;
+    /// The statistics of the transforms run to sanitize the program.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Sanitize a program in preparation for generating GLSL.
@@ -24,6 +24,7 @@
 
 #include "src/tint/ast/pipeline_stage.h"
 #include "src/tint/sem/binding_point.h"
+#include "src/tint/transform/manager.h"
 #include "src/tint/writer/array_length_from_uniform_options.h"
 #include "src/tint/writer/text.h"
 
@@ -55,6 +56,9 @@ struct Options {
     /// Options used to specify a mapping of binding points to indices into a UBO
     /// from which to load buffer sizes.
     ArrayLengthFromUniformOptions array_length_from_uniform = {};
+    /// Set to `true` to collect the statistics of the transforms run to sanitize the program,
+    /// which are returned in Result::transform_statistics.
+    bool collect_transform_statistics = false;
 
     // NOTE: Update src/tint/fuzzers/data_builder.h when adding or changing any
     // struct members.
@@ -86,6 +90,10 @@ struct Result {
     /// Indices into the array_length_from_uniform binding that are statically
     /// used.
     std::unordered_set<uint32_t> used_array_length_from_uniform_indices;
+
+    /// The statistics of the transforms run to sanitize the program before generating it, if
+    /// Options::collect_transform_statistics was set.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Generate HLSL for a program, according to a set of configuration options.
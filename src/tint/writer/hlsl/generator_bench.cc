@@ -14,6 +14,9 @@
 
 #include <string>
 
+#include "src/tint/writer/hlsl/generator_impl.h"
+
+// Included after the internal headers, as it includes tint/tint.h.
 #include "src/tint/bench/benchmark.h"
 
 namespace tint::writer::hlsl {
@@ -34,7 +37,23 @@ void GenerateHLSL(benchmark::State& state, std::string input_name) {
     }
 }
 
+void SanitizeHLSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+    for (auto _ : state) {
+        auto sanitized = Sanitize(&program, {});
+        if (!sanitized.program.IsValid()) {
+            state.SkipWithError(sanitized.program.Diagnostics().str().c_str());
+        }
+    }
+}
+
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateHLSL);
+TINT_BENCHMARK_WGSL_PROGRAMS(SanitizeHLSL);
 
 }  // namespace
 }  // namespace tint::writer::hlsl
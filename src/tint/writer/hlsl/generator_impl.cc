@@ -255,10 +255,17 @@ SanitizedResult Sanitize(const Program* in, const Options& options) {
         transform::CanonicalizeEntryPointIO::ShaderStyle::kHlsl);
     data.Add<transform::NumWorkgroupsFromUniform::Config>(options.root_constant_binding_point);
 
+    if (options.collect_transform_statistics) {
+        data.Add<transform::Manager::Config>(/* collect_statistics */ true);
+    }
+
     auto out = manager.Run(in, data);
 
     SanitizedResult result;
     result.program = std::move(out.program);
+    if (auto* statistics = out.data.Get<transform::Manager::Statistics>()) {
+        result.transform_statistics = std::move(statistics->transforms);
+    }
     if (auto* res = out.data.Get<transform::ArrayLengthFromUniform::Result>()) {
         result.used_array_length_from_uniform_indices = std::move(res->used_size_indices);
     }
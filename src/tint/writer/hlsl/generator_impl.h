@@ -65,6 +65,8 @@ struct SanitizedResult {
     /// Indices into the array_length_from_uniform binding that are statically
     /// used.
     std::unordered_set<uint32_t> used_array_length_from_uniform_indices;
+    /// The statistics of the transforms run to sanitize the program.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Sanitize a program in preparation for generating HLSL.
@@ -21,6 +21,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "src/tint/transform/manager.h"
 #include "src/tint/writer/array_length_from_uniform_options.h"
 #include "src/tint/writer/text.h"
 
@@ -65,6 +66,10 @@ struct Options {
     /// from which to load buffer sizes.
     ArrayLengthFromUniformOptions array_length_from_uniform = {};
 
+    /// Set to `true` to collect the statistics of the transforms run to sanitize the program,
+    /// which are returned in Result::transform_statistics.
+    bool collect_transform_statistics = false;
+
     // NOTE: Update src/tint/fuzzers/data_builder.h when adding or changing any
     // struct members.
 };
@@ -103,6 +108,10 @@ struct Result {
     /// Indices into the array_length_from_uniform binding that are statically
     /// used.
     std::unordered_set<uint32_t> used_array_length_from_uniform_indices;
+
+    /// The statistics of the transforms run to sanitize the program before generating it, if
+    /// Options::collect_transform_statistics was set.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Generate MSL for a program, according to a set of configuration options. The
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -63,6 +64,7 @@
 #include "src/tint/transform/canonicalize_entry_point_io.h"
 #include "src/tint/transform/disable_uniformity_analysis.h"
 #include "src/tint/transform/expand_compound_assignment.h"
+#include "src/tint/transform/fused.h"
 #include "src/tint/transform/manager.h"
 #include "src/tint/transform/module_scope_var_to_entry_point_param.h"
 #include "src/tint/transform/promote_initializers_to_let.h"
@@ -223,8 +225,12 @@ SanitizedResult Sanitize(const Program* in, const Options& options) {
     manager.Add<transform::UnwindDiscardFunctions>();
     manager.Add<transform::PromoteInitializersToLet>();
 
-    manager.Add<transform::VectorizeScalarMatrixConstructors>();
-    manager.Add<transform::RemovePhonies>();
+    {  // Applied with a single clone of the program
+        auto fused = std::make_unique<transform::Fused>();
+        fused->Add<transform::VectorizeScalarMatrixConstructors>();
+        fused->Add<transform::RemovePhonies>();
+        manager.append(std::move(fused));
+    }
     manager.Add<transform::SimplifyPointers>();
     // ArrayLengthFromUniform must come after SimplifyPointers, as
     // it assumes that the form of the array length argument is &var.array.
@@ -232,10 +238,17 @@ SanitizedResult Sanitize(const Program* in, const Options& options) {
     manager.Add<transform::ModuleScopeVarToEntryPointParam>();
     data.Add<transform::ArrayLengthFromUniform::Config>(std::move(array_length_from_uniform_cfg));
     data.Add<transform::CanonicalizeEntryPointIO::Config>(std::move(entry_point_io_cfg));
+    if (options.collect_transform_statistics) {
+        data.Add<transform::Manager::Config>(/* collect_statistics */ true);
+    }
+
     auto out = manager.Run(in, data);
 
     SanitizedResult result;
     result.program = std::move(out.program);
+    if (auto* statistics = out.data.Get<transform::Manager::Statistics>()) {
+        result.transform_statistics = std::move(statistics->transforms);
+    }
     if (!result.program.IsValid()) {
         return result;
     }
@@ -0,0 +1,81 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/writer/multi_target.h"
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "src/tint/program.h"
+#include "src/tint/transform/disable_uniformity_analysis.h"
+#include "src/tint/utils/parallel_for.h"
+
+namespace tint::writer {
+
+MultiTargetResult GenerateMultiTarget(const Program* program, const MultiTargetOptions& options) {
+    // Every backend sanitizer starts with DisableUniformityAnalysis, which is skipped if the
+    // program has already been through it. Apply it once here, so that the backends share the
+    // result instead of each cloning and resolving the program again. The later transforms of
+    // the sanitizers are configured differently for each backend, so cannot be shared.
+    const Program* in = program;
+    std::optional<Program> shared;
+    if (program->IsValid()) {
+        transform::DisableUniformityAnalysis disable_uniformity_analysis;
+        transform::DataMap inputs;
+        transform::DataMap outputs;
+        if (disable_uniformity_analysis.ShouldRun(program, inputs)) {
+            shared = disable_uniformity_analysis.Apply(program, inputs, outputs);
+            // If the transform failed, let each backend report the error.
+            if (shared && shared->IsValid()) {
+                in = &shared.value();
+            }
+        }
+    }
+
+    MultiTargetResult result;
+    std::vector<std::function<void()>> targets;
+    (void)in;       // Unused if no backends are built.
+    (void)options;  // Unused if no backends are built.
+#if TINT_BUILD_SPV_WRITER
+    if (options.spirv) {
+        targets.emplace_back([&] { result.spirv = spirv::Generate(in, *options.spirv); });
+    }
+#endif  // TINT_BUILD_SPV_WRITER
+#if TINT_BUILD_MSL_WRITER
+    if (options.msl) {
+        targets.emplace_back([&] { result.msl = msl::Generate(in, *options.msl); });
+    }
+#endif  // TINT_BUILD_MSL_WRITER
+#if TINT_BUILD_HLSL_WRITER
+    if (options.hlsl) {
+        targets.emplace_back([&] { result.hlsl = hlsl::Generate(in, *options.hlsl); });
+    }
+#endif  // TINT_BUILD_HLSL_WRITER
+#if TINT_BUILD_GLSL_WRITER
+    if (options.glsl) {
+        targets.emplace_back(
+            [&] { result.glsl = glsl::Generate(in, *options.glsl, options.glsl_entry_point); });
+    }
+#endif  // TINT_BUILD_GLSL_WRITER
+
+    // The shared program is only read, and each target writes to its own result, so the targets
+    // can be generated without any other synchronization.
+    utils::ParallelFor(targets.size(), options.max_threads,
+                       [&](size_t i, size_t) { targets[i](); });
+
+    return result;
+}
+
+}  // namespace tint::writer
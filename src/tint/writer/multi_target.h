@@ -0,0 +1,111 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_WRITER_MULTI_TARGET_H_
+#define SRC_TINT_WRITER_MULTI_TARGET_H_
+
+#include <optional>
+#include <string>
+
+#if TINT_BUILD_SPV_WRITER
+#include "src/tint/writer/spirv/generator.h"
+#endif  // TINT_BUILD_SPV_WRITER
+
+#if TINT_BUILD_MSL_WRITER
+#include "src/tint/writer/msl/generator.h"
+#endif  // TINT_BUILD_MSL_WRITER
+
+#if TINT_BUILD_HLSL_WRITER
+#include "src/tint/writer/hlsl/generator.h"
+#endif  // TINT_BUILD_HLSL_WRITER
+
+#if TINT_BUILD_GLSL_WRITER
+#include "src/tint/writer/glsl/generator.h"
+#endif  // TINT_BUILD_GLSL_WRITER
+
+// Forward declarations
+namespace tint {
+class Program;
+}  // namespace tint
+
+namespace tint::writer {
+
+/// Configuration options used for GenerateMultiTarget(). Output is generated for each target
+/// that has its options set.
+struct MultiTargetOptions {
+#if TINT_BUILD_SPV_WRITER
+    /// The options used to generate SPIR-V
+    std::optional<spirv::Options> spirv;
+#endif  // TINT_BUILD_SPV_WRITER
+
+#if TINT_BUILD_MSL_WRITER
+    /// The options used to generate MSL
+    std::optional<msl::Options> msl;
+#endif  // TINT_BUILD_MSL_WRITER
+
+#if TINT_BUILD_HLSL_WRITER
+    /// The options used to generate HLSL
+    std::optional<hlsl::Options> hlsl;
+#endif  // TINT_BUILD_HLSL_WRITER
+
+#if TINT_BUILD_GLSL_WRITER
+    /// The options used to generate GLSL
+    std::optional<glsl::Options> glsl;
+    /// The entry point to generate GLSL for
+    std::string glsl_entry_point;
+#endif  // TINT_BUILD_GLSL_WRITER
+
+    /// The maximum number of threads used to generate the targets, or 0 to use the number of
+    /// hardware threads
+    size_t max_threads = 0;
+};
+
+/// The results produced by GenerateMultiTarget(). Each result is set if the options for its
+/// target were set.
+struct MultiTargetResult {
+#if TINT_BUILD_SPV_WRITER
+    /// The result of generating SPIR-V
+    std::optional<spirv::Result> spirv;
+#endif  // TINT_BUILD_SPV_WRITER
+
+#if TINT_BUILD_MSL_WRITER
+    /// The result of generating MSL
+    std::optional<msl::Result> msl;
+#endif  // TINT_BUILD_MSL_WRITER
+
+#if TINT_BUILD_HLSL_WRITER
+    /// The result of generating HLSL
+    std::optional<hlsl::Result> hlsl;
+#endif  // TINT_BUILD_HLSL_WRITER
+
+#if TINT_BUILD_GLSL_WRITER
+    /// The result of generating GLSL
+    std::optional<glsl::Result> glsl;
+#endif  // TINT_BUILD_GLSL_WRITER
+};
+
+/// Generates the output of several backends for a single program. The results are the same as
+/// calling the Generate() function of each backend.
+///
+/// The transforms that every backend's sanitizer starts with are applied to the program once,
+/// and the backends then sanitize and generate from the shared program concurrently, on up to
+/// `options.max_threads` threads.
+/// @param program the program to generate the targets for
+/// @param options the options of the targets to generate
+/// @returns the result of each generated target
+MultiTargetResult GenerateMultiTarget(const Program* program, const MultiTargetOptions& options);
+
+}  // namespace tint::writer
+
+#endif  // SRC_TINT_WRITER_MULTI_TARGET_H_
@@ -0,0 +1,97 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include "src/tint/ast/module.h"
+#include "src/tint/writer/multi_target.h"
+
+// Included after the internal headers, as it includes tint/tint.h.
+#include "src/tint/bench/benchmark.h"
+
+namespace tint::writer {
+namespace {
+
+/// @returns the options to generate every target that is built, for the first entry point of
+/// `program`
+MultiTargetOptions AllTargets(const Program& program) {
+    MultiTargetOptions options;
+#if TINT_BUILD_SPV_WRITER
+    options.spirv = spirv::Options{};
+#endif
+#if TINT_BUILD_MSL_WRITER
+    options.msl = msl::Options{};
+#endif
+#if TINT_BUILD_HLSL_WRITER
+    options.hlsl = hlsl::Options{};
+#endif
+#if TINT_BUILD_GLSL_WRITER
+    options.glsl = glsl::Options{};
+    for (auto* fn : program.AST().Functions()) {
+        if (fn->IsEntryPoint()) {
+            options.glsl_entry_point = program.Symbols().NameFor(fn->symbol);
+            break;
+        }
+    }
+#endif
+    (void)program;
+    return options;
+}
+
+void GenerateAllTargetsTogether(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+    auto options = AllTargets(program);
+    for (auto _ : state) {
+        auto result = GenerateMultiTarget(&program, options);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+/// Generates the same targets as GenerateAllTargetsTogether, calling the Generate() function of
+/// each backend in turn.
+void GenerateAllTargetsSeparately(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& program = std::get<bench::ProgramAndFile>(res).program;
+    auto options = AllTargets(program);
+    for (auto _ : state) {
+#if TINT_BUILD_SPV_WRITER
+        benchmark::DoNotOptimize(spirv::Generate(&program, *options.spirv));
+#endif
+#if TINT_BUILD_MSL_WRITER
+        benchmark::DoNotOptimize(msl::Generate(&program, *options.msl));
+#endif
+#if TINT_BUILD_HLSL_WRITER
+        benchmark::DoNotOptimize(hlsl::Generate(&program, *options.hlsl));
+#endif
+#if TINT_BUILD_GLSL_WRITER
+        benchmark::DoNotOptimize(
+            glsl::Generate(&program, *options.glsl, options.glsl_entry_point));
+#endif
+    }
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(GenerateAllTargetsTogether);
+TINT_BENCHMARK_WGSL_PROGRAMS(GenerateAllTargetsSeparately);
+
+}  // namespace
+}  // namespace tint::writer
@@ -0,0 +1,146 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/writer/multi_target.h"
+
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "src/tint/program_builder.h"
+
+namespace tint::writer {
+namespace {
+
+using namespace tint::number_suffixes;  // NOLINT
+
+/// @returns a program with a compute entry point that writes to a storage buffer
+Program MakeProgram() {
+    ProgramBuilder b;
+    b.GlobalVar("buffer", b.ty.array(b.ty.i32(), 4_u), ast::StorageClass::kStorage,
+                ast::Access::kReadWrite, b.GroupAndBinding(0, 0));
+    b.Func("main", utils::Empty, b.ty.void_(),
+           utils::Vector{
+               b.Decl(b.Var("x", b.ty.i32(), ast::StorageClass::kNone, b.Expr(2_i))),
+               b.CompoundAssign(b.IndexAccessor("buffer", 1_i), "x", ast::BinaryOp::kAdd),
+           },
+           utils::Vector{b.Stage(ast::PipelineStage::kCompute), b.WorkgroupSize(1_i)});
+    return Program(std::move(b));
+}
+
+TEST(MultiTargetTest, NoTargets) {
+    auto program = MakeProgram();
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    auto result = GenerateMultiTarget(&program, {});
+    (void)result;  // Unused if no backends are built.
+#if TINT_BUILD_SPV_WRITER
+    EXPECT_FALSE(result.spirv.has_value());
+#endif
+#if TINT_BUILD_MSL_WRITER
+    EXPECT_FALSE(result.msl.has_value());
+#endif
+#if TINT_BUILD_HLSL_WRITER
+    EXPECT_FALSE(result.hlsl.has_value());
+#endif
+#if TINT_BUILD_GLSL_WRITER
+    EXPECT_FALSE(result.glsl.has_value());
+#endif
+}
+
+/// The parameter is the maximum number of threads used to generate the targets
+using MultiTargetThreadsTest = testing::TestWithParam<size_t>;
+
+TEST_P(MultiTargetThreadsTest, MatchesSeparateGenerate) {
+    auto program = MakeProgram();
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    MultiTargetOptions options;
+    options.max_threads = GetParam();
+#if TINT_BUILD_SPV_WRITER
+    options.spirv = spirv::Options{};
+#endif
+#if TINT_BUILD_MSL_WRITER
+    options.msl = msl::Options{};
+#endif
+#if TINT_BUILD_HLSL_WRITER
+    options.hlsl = hlsl::Options{};
+#endif
+#if TINT_BUILD_GLSL_WRITER
+    options.glsl = glsl::Options{};
+    options.glsl_entry_point = "main";
+#endif
+
+    auto result = GenerateMultiTarget(&program, options);
+    (void)result;  // Unused if no backends are built.
+
+#if TINT_BUILD_SPV_WRITER
+    {
+        auto expected = spirv::Generate(&program, {});
+        ASSERT_TRUE(result.spirv.has_value());
+        EXPECT_TRUE(result.spirv->success) << result.spirv->error;
+        EXPECT_EQ(result.spirv->spirv, expected.spirv);
+    }
+#endif
+#if TINT_BUILD_MSL_WRITER
+    {
+        auto expected = msl::Generate(&program, {});
+        ASSERT_TRUE(result.msl.has_value());
+        EXPECT_TRUE(result.msl->success) << result.msl->error;
+        EXPECT_EQ(result.msl->msl, expected.msl);
+    }
+#endif
+#if TINT_BUILD_HLSL_WRITER
+    {
+        auto expected = hlsl::Generate(&program, {});
+        ASSERT_TRUE(result.hlsl.has_value());
+        EXPECT_TRUE(result.hlsl->success) << result.hlsl->error;
+        EXPECT_EQ(result.hlsl->hlsl, expected.hlsl);
+    }
+#endif
+#if TINT_BUILD_GLSL_WRITER
+    {
+        auto expected = glsl::Generate(&program, {}, "main");
+        ASSERT_TRUE(result.glsl.has_value());
+        EXPECT_TRUE(result.glsl->success) << result.glsl->error;
+        EXPECT_EQ(result.glsl->glsl, expected.glsl);
+    }
+#endif
+}
+
+// Generate the targets on a single thread, and with more threads than there are targets, whatever
+// the number of hardware threads.
+INSTANTIATE_TEST_SUITE_P(MultiTargetTest, MultiTargetThreadsTest, testing::Values(1u, 8u));
+
+TEST(MultiTargetTest, InvalidProgram) {
+    ProgramBuilder b;
+    b.Diagnostics().add_error(diag::System::Writer, "make the program invalid");
+    Program program(std::move(b));
+    ASSERT_FALSE(program.IsValid());
+
+    MultiTargetOptions options;
+#if TINT_BUILD_HLSL_WRITER
+    options.hlsl = hlsl::Options{};
+#endif
+
+    auto result = GenerateMultiTarget(&program, options);
+    (void)result;  // Unused if no backends are built.
+#if TINT_BUILD_HLSL_WRITER
+    ASSERT_TRUE(result.hlsl.has_value());
+    EXPECT_FALSE(result.hlsl->success);
+    EXPECT_EQ(result.hlsl->error, "input program is not valid");
+#endif
+}
+
+}  // namespace
+}  // namespace tint::writer
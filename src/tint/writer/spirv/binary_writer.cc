@@ -14,9 +14,6 @@
 
 #include "src/tint/writer/spirv/binary_writer.h"
 
-#include <cstring>
-#include <string>
-
 namespace tint::writer::spirv {
 namespace {
 
@@ -29,12 +26,35 @@ BinaryWriter::BinaryWriter() = default;
 BinaryWriter::~BinaryWriter() = default;
 
 void BinaryWriter::WriteBuilder(Builder* builder) {
+    // The sections of the builder are already encoded, so they are copied as-is.
     out_.reserve(builder->total_size());
-    builder->iterate([this](const Instruction& inst) { this->process_instruction(inst); });
+    WriteInstructions(builder->capabilities());
+    WriteInstructions(builder->extensions());
+    WriteInstructions(builder->ext_imports());
+    WriteInstructions(builder->memory_model());
+    WriteInstructions(builder->entry_points());
+    WriteInstructions(builder->execution_modes());
+    WriteInstructions(builder->debug());
+    WriteInstructions(builder->annots());
+    WriteInstructions(builder->types());
+    for (const auto& func : builder->functions()) {
+        WriteInstructions(func.declaration());
+        out_.push_back(2u << 16 | static_cast<uint32_t>(spv::Op::OpLabel));
+        out_.push_back(func.label_id());
+        WriteInstructions(func.variables());
+        WriteInstructions(func.instructions());
+        out_.push_back(1u << 16 | static_cast<uint32_t>(spv::Op::OpFunctionEnd));
+    }
 }
 
 void BinaryWriter::WriteInstruction(const Instruction& inst) {
-    process_instruction(inst);
+    InstructionList insts;
+    insts.push_back(inst);
+    WriteInstructions(insts);
+}
+
+void BinaryWriter::WriteInstructions(const InstructionList& insts) {
+    out_.insert(out_.end(), insts.words().begin(), insts.words().end());
 }
 
 void BinaryWriter::WriteHeader(uint32_t bound) {
@@ -45,31 +65,4 @@ void BinaryWriter::WriteHeader(uint32_t bound) {
     out_.push_back(0);
 }
 
-void BinaryWriter::process_instruction(const Instruction& inst) {
-    out_.push_back(inst.word_length() << 16 | static_cast<uint32_t>(inst.opcode()));
-    for (const auto& op : inst.operands()) {
-        process_op(op);
-    }
-}
-
-void BinaryWriter::process_op(const Operand& op) {
-    if (auto* i = std::get_if<uint32_t>(&op)) {
-        out_.push_back(*i);
-        return;
-    }
-    if (auto* f = std::get_if<float>(&op)) {
-        // Allocate space for the float
-        out_.push_back(0);
-        uint8_t* ptr = reinterpret_cast<uint8_t*>(out_.data() + (out_.size() - 1));
-        memcpy(ptr, f, 4);
-        return;
-    }
-    if (auto* str = std::get_if<std::string>(&op)) {
-        auto idx = out_.size();
-        out_.resize(out_.size() + OperandLength(op), 0);
-        memcpy(out_.data() + idx, str->c_str(), str->size() + 1);
-        return;
-    }
-}
-
 }  // namespace tint::writer::spirv
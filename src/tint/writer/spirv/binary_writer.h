@@ -42,6 +42,10 @@ class BinaryWriter {
     /// @param inst the instruction to assemble
     void WriteInstruction(const Instruction& inst);
 
+    /// Writes the given instructions into the binary.
+    /// @param insts the instructions to write
+    void WriteInstructions(const InstructionList& insts);
+
     /// @returns the assembled SPIR-V
     const std::vector<uint32_t>& result() const { return out_; }
 
@@ -49,9 +53,6 @@ class BinaryWriter {
     std::vector<uint32_t>& result() { return out_; }
 
   private:
-    void process_instruction(const Instruction& inst);
-    void process_op(const Operand& op);
-
     std::vector<uint32_t> out_;
 };
 
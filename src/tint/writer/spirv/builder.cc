@@ -55,15 +55,6 @@ using BuiltinType = sem::BuiltinType;
 
 const char kGLSLstd450[] = "GLSL.std.450";
 
-uint32_t size_of(const InstructionList& instructions) {
-    uint32_t size = 0;
-    for (const auto& inst : instructions) {
-        size += inst.word_length();
-    }
-
-    return size;
-}
-
 uint32_t pipeline_stage_to_execution_model(ast::PipelineStage stage) {
     SpvExecutionModel model = SpvExecutionModelVertex;
 
@@ -318,15 +309,15 @@ uint32_t Builder::total_size() const {
     // The 5 covers the magic, version, generator, id bound and reserved.
     uint32_t size = 5;
 
-    size += size_of(capabilities_);
-    size += size_of(extensions_);
-    size += size_of(ext_imports_);
-    size += size_of(memory_model_);
-    size += size_of(entry_points_);
-    size += size_of(execution_modes_);
-    size += size_of(debug_);
-    size += size_of(annotations_);
-    size += size_of(types_);
+    size += capabilities_.word_length();
+    size += extensions_.word_length();
+    size += ext_imports_.word_length();
+    size += memory_model_.word_length();
+    size += entry_points_.word_length();
+    size += execution_modes_.word_length();
+    size += debug_.word_length();
+    size += annotations_.word_length();
+    size += types_.word_length();
     for (const auto& func : functions_) {
         size += func.word_length();
     }
@@ -334,48 +325,15 @@ uint32_t Builder::total_size() const {
     return size;
 }
 
-void Builder::iterate(std::function<void(const Instruction&)> cb) const {
-    for (const auto& inst : capabilities_) {
-        cb(inst);
-    }
-    for (const auto& inst : extensions_) {
-        cb(inst);
-    }
-    for (const auto& inst : ext_imports_) {
-        cb(inst);
-    }
-    for (const auto& inst : memory_model_) {
-        cb(inst);
-    }
-    for (const auto& inst : entry_points_) {
-        cb(inst);
-    }
-    for (const auto& inst : execution_modes_) {
-        cb(inst);
-    }
-    for (const auto& inst : debug_) {
-        cb(inst);
-    }
-    for (const auto& inst : annotations_) {
-        cb(inst);
-    }
-    for (const auto& inst : types_) {
-        cb(inst);
-    }
-    for (const auto& func : functions_) {
-        func.iterate(cb);
-    }
-}
-
 void Builder::push_capability(uint32_t cap) {
     if (capability_set_.count(cap) == 0) {
         capability_set_.insert(cap);
-        capabilities_.push_back(Instruction{spv::Op::OpCapability, {Operand(cap)}});
+        capabilities_.push_back(spv::Op::OpCapability, {Operand(cap)});
     }
 }
 
 void Builder::push_extension(const char* extension) {
-    extensions_.push_back(Instruction{spv::Op::OpExtension, {Operand(extension)}});
+    extensions_.push_back(spv::Op::OpExtension, {Operand(extension)});
 }
 
 bool Builder::GenerateExtension(ast::Extension extension) {
@@ -616,11 +574,12 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
     PushScope();
     TINT_DEFER(PopScope());
 
-    auto definition_inst = Instruction{
+    // The OpFunction instruction, followed by the function parameters
+    InstructionList declaration;
+    declaration.push_back(
         spv::Op::OpFunction,
-        {Operand(ret_id), func_op, U32Operand(SpvFunctionControlMaskNone), Operand(func_type_id)}};
+        {Operand(ret_id), func_op, U32Operand(SpvFunctionControlMaskNone), Operand(func_type_id)});
 
-    InstructionList params;
     for (auto* param : func->Parameters()) {
         auto param_op = result_op();
         auto param_id = std::get<uint32_t>(param_op);
@@ -633,13 +592,12 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
         push_debug(
             spv::Op::OpName,
             {Operand(param_id), Operand(builder_.Symbols().NameFor(param->Declaration()->symbol))});
-        params.push_back(
-            Instruction{spv::Op::OpFunctionParameter, {Operand(param_type_id), param_op}});
+        declaration.push_back(spv::Op::OpFunctionParameter, {Operand(param_type_id), param_op});
 
         RegisterVariable(param, param_id);
     }
 
-    push_function(Function{definition_inst, result_op(), std::move(params)});
+    push_function(Function{std::move(declaration), result_op()});
 
     for (auto* stmt : func_ast->body->statements) {
         if (!GenerateStatement(stmt)) {
@@ -689,7 +647,7 @@ uint32_t Builder::GenerateFunctionTypeIfNeeded(const sem::Function* func) {
             ops.push_back(Operand(param_type_id));
         }
 
-        push_type(spv::Op::OpTypeFunction, std::move(ops));
+        push_type(spv::Op::OpTypeFunction, ops);
         return func_type_id;
     });
 }
@@ -868,7 +826,7 @@ bool Builder::GenerateGlobalVariable(const ast::Variable* v) {
         }
     }
 
-    push_type(spv::Op::OpVariable, std::move(ops));
+    push_type(spv::Op::OpVariable, ops);
 
     for (auto* attr : v->attributes) {
         bool ok = Switch(
@@ -1740,7 +1698,7 @@ uint32_t Builder::GenerateConstantIfNeeded(const sem::Constant* constant) {
                                   [&]() -> uint32_t {
                                       auto result = result_op();
                                       ops[kOpsResultIdx] = result;
-                                      push_type(spv::Op::OpConstantComposite, std::move(ops));
+                                      push_type(spv::Op::OpConstantComposite, ops);
                                       return std::get<uint32_t>(result);
                                   });
     };
@@ -2346,7 +2304,7 @@ uint32_t Builder::GenerateFunctionCall(const sem::Call* call, const sem::Functio
         ops.push_back(Operand(id));
     }
 
-    if (!push_function_inst(spv::Op::OpFunctionCall, std::move(ops))) {
+    if (!push_function_inst(spv::Op::OpFunctionCall, ops)) {
         return 0;
     }
 
@@ -4051,7 +4009,7 @@ bool Builder::GenerateStructType(const sem::Struct* struct_type, const Operand&
         ops.push_back(Operand(mem_id));
     }
 
-    push_type(spv::Op::OpTypeStruct, std::move(ops));
+    push_type(spv::Op::OpTypeStruct, ops);
     return true;
 }
 
@@ -4240,7 +4198,7 @@ SpvImageFormat Builder::convert_texel_format_to_spv(const ast::TexelFormat forma
     return SpvImageFormatUnknown;
 }
 
-bool Builder::push_function_inst(spv::Op op, const OperandList& operands) {
+bool Builder::push_function_inst(spv::Op op, OperandSpan operands) {
     if (functions_.empty()) {
         std::ostringstream ss;
         ss << "Internal error: trying to add SPIR-V instruction " << int(op)
@@ -4263,8 +4221,7 @@ bool Builder::InsideBasicBlock() const {
         // thing in the function is that entry block label.
         return true;
     }
-    const auto& inst = instructions.back();
-    switch (inst.opcode()) {
+    switch (instructions.back_opcode()) {
         case spv::Op::OpBranch:
         case spv::Op::OpBranchConditional:
         case spv::Op::OpSwitch:
@@ -18,6 +18,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "spirv/unified1/spirv.h"
@@ -102,11 +103,6 @@ class Builder {
         return id;
     }
 
-    /// Iterates over all the instructions in the correct order and calls the
-    /// given callback
-    /// @param cb the callback to execute
-    void iterate(std::function<void(const Instruction&)> cb) const;
-
     /// Adds an instruction to the list of capabilities, if the capability
     /// hasn't already been added.
     /// @param cap the capability to set
@@ -121,65 +117,57 @@ class Builder {
     /// Adds an instruction to the ext import
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_ext_import(spv::Op op, const OperandList& operands) {
-        ext_imports_.push_back(Instruction{op, operands});
-    }
+    void push_ext_import(spv::Op op, OperandSpan operands) { ext_imports_.push_back(op, operands); }
     /// @returns the ext imports
     const InstructionList& ext_imports() const { return ext_imports_; }
     /// Adds an instruction to the memory model
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_memory_model(spv::Op op, const OperandList& operands) {
-        memory_model_.push_back(Instruction{op, operands});
+    void push_memory_model(spv::Op op, OperandSpan operands) {
+        memory_model_.push_back(op, operands);
     }
     /// @returns the memory model
     const InstructionList& memory_model() const { return memory_model_; }
     /// Adds an instruction to the entry points
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_entry_point(spv::Op op, const OperandList& operands) {
-        entry_points_.push_back(Instruction{op, operands});
+    void push_entry_point(spv::Op op, OperandSpan operands) {
+        entry_points_.push_back(op, operands);
     }
     /// @returns the entry points
     const InstructionList& entry_points() const { return entry_points_; }
     /// Adds an instruction to the execution modes
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_execution_mode(spv::Op op, const OperandList& operands) {
-        execution_modes_.push_back(Instruction{op, operands});
+    void push_execution_mode(spv::Op op, OperandSpan operands) {
+        execution_modes_.push_back(op, operands);
     }
     /// @returns the execution modes
     const InstructionList& execution_modes() const { return execution_modes_; }
     /// Adds an instruction to the debug
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_debug(spv::Op op, const OperandList& operands) {
-        debug_.push_back(Instruction{op, operands});
-    }
+    void push_debug(spv::Op op, OperandSpan operands) { debug_.push_back(op, operands); }
     /// @returns the debug instructions
     const InstructionList& debug() const { return debug_; }
     /// Adds an instruction to the types
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_type(spv::Op op, const OperandList& operands) {
-        types_.push_back(Instruction{op, operands});
-    }
+    void push_type(spv::Op op, OperandSpan operands) { types_.push_back(op, operands); }
     /// @returns the type instructions
     const InstructionList& types() const { return types_; }
     /// Adds an instruction to the annotations
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_annot(spv::Op op, const OperandList& operands) {
-        annotations_.push_back(Instruction{op, operands});
-    }
+    void push_annot(spv::Op op, OperandSpan operands) { annotations_.push_back(op, operands); }
     /// @returns the annotations
     const InstructionList& annots() const { return annotations_; }
 
     /// Adds a function to the builder
     /// @param func the function to add
-    void push_function(const Function& func) {
-        functions_.push_back(func);
+    void push_function(Function func) {
         current_label_id_ = func.label_id();
+        functions_.push_back(std::move(func));
     }
     /// @returns the functions
     const std::vector<Function>& functions() const { return functions_; }
@@ -188,10 +176,10 @@ class Builder {
     /// @param op the operation
     /// @param operands the operands
     /// @returns true if we succeeded
-    bool push_function_inst(spv::Op op, const OperandList& operands);
+    bool push_function_inst(spv::Op op, OperandSpan operands);
     /// Pushes a variable to the current function
     /// @param operands the variable operands
-    void push_function_var(const OperandList& operands) {
+    void push_function_var(OperandSpan operands) {
         if (functions_.empty()) {
             TINT_ICE(Writer, builder_.Diagnostics())
                 << "push_function_var() called without a function";
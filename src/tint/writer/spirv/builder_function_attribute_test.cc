@@ -76,7 +76,7 @@ TEST_P(Attribute_StageTest, Emit) {
     }
     ASSERT_TRUE(b.GenerateFunction(func)) << b.error();
 
-    auto preamble = b.entry_points();
+    auto preamble = b.entry_points().Decode();
     ASSERT_GE(preamble.size(), 1u);
     EXPECT_EQ(preamble[0].opcode(), spv::Op::OpEntryPoint);
 
@@ -129,7 +129,7 @@ TEST_F(BuilderTest_Type, GenerateBool) {
     EXPECT_EQ(id, 1u);
 
     ASSERT_EQ(b.types().size(), 1u);
-    EXPECT_EQ(DumpInstruction(b.types()[0]), R"(%1 = OpTypeBool
+    EXPECT_EQ(DumpInstruction(b.types().Decode()[0]), R"(%1 = OpTypeBool
 )");
 }
 
@@ -157,7 +157,7 @@ TEST_F(BuilderTest_Type, GenerateF32) {
     EXPECT_EQ(id, 1u);
 
     ASSERT_EQ(b.types().size(), 1u);
-    EXPECT_EQ(DumpInstruction(b.types()[0]), R"(%1 = OpTypeFloat 32
+    EXPECT_EQ(DumpInstruction(b.types().Decode()[0]), R"(%1 = OpTypeFloat 32
 )");
 }
 
@@ -185,7 +185,7 @@ TEST_F(BuilderTest_Type, GenerateF16) {
     EXPECT_EQ(id, 1u);
 
     ASSERT_EQ(b.types().size(), 1u);
-    EXPECT_EQ(DumpInstruction(b.types()[0]), R"(%1 = OpTypeFloat 16
+    EXPECT_EQ(DumpInstruction(b.types().Decode()[0]), R"(%1 = OpTypeFloat 16
 )");
 }
 
@@ -213,7 +213,7 @@ TEST_F(BuilderTest_Type, GenerateI32) {
     EXPECT_EQ(id, 1u);
 
     ASSERT_EQ(b.types().size(), 1u);
-    EXPECT_EQ(DumpInstruction(b.types()[0]), R"(%1 = OpTypeInt 32 1
+    EXPECT_EQ(DumpInstruction(b.types().Decode()[0]), R"(%1 = OpTypeInt 32 1
 )");
 }
 
@@ -506,7 +506,7 @@ TEST_F(BuilderTest_Type, GenerateU32) {
     EXPECT_EQ(id, 1u);
 
     ASSERT_EQ(b.types().size(), 1u);
-    EXPECT_EQ(DumpInstruction(b.types()[0]), R"(%1 = OpTypeInt 32 0
+    EXPECT_EQ(DumpInstruction(b.types().Decode()[0]), R"(%1 = OpTypeInt 32 0
 )");
 }
 
@@ -563,7 +563,7 @@ TEST_F(BuilderTest_Type, GenerateVoid) {
     EXPECT_EQ(id, 1u);
 
     ASSERT_EQ(b.types().size(), 1u);
-    EXPECT_EQ(DumpInstruction(b.types()[0]), R"(%1 = OpTypeVoid
+    EXPECT_EQ(DumpInstruction(b.types().Decode()[0]), R"(%1 = OpTypeVoid
 )");
 }
 
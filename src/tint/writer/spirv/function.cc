@@ -14,36 +14,21 @@
 
 #include "src/tint/writer/spirv/function.h"
 
+#include <utility>
+
 namespace tint::writer::spirv {
 
-Function::Function() : declaration_(Instruction{spv::Op::OpNop, {}}), label_op_(Operand(0u)) {}
+Function::Function() : label_op_(Operand(0u)) {
+    declaration_.push_back(spv::Op::OpNop, {});
+}
 
-Function::Function(const Instruction& declaration,
-                   const Operand& label_op,
-                   const InstructionList& params)
-    : declaration_(declaration), label_op_(label_op), params_(params) {}
+Function::Function(InstructionList declaration, Operand label_op)
+    : declaration_(std::move(declaration)), label_op_(std::move(label_op)) {}
 
 Function::Function(const Function& other) = default;
 
 Function::~Function() = default;
 
-void Function::iterate(std::function<void(const Instruction&)> cb) const {
-    cb(declaration_);
-
-    for (const auto& param : params_) {
-        cb(param);
-    }
-
-    cb(Instruction{spv::Op::OpLabel, {label_op_}});
-
-    for (const auto& var : vars_) {
-        cb(var);
-    }
-    for (const auto& inst : instructions_) {
-        cb(inst);
-    }
-
-    cb(Instruction{spv::Op::OpFunctionEnd, {}});
-}
+Function& Function::operator=(const Function& other) = default;
 
 }  // namespace tint::writer::spirv
@@ -15,7 +15,7 @@
 #ifndef SRC_TINT_WRITER_SPIRV_FUNCTION_H_
 #define SRC_TINT_WRITER_SPIRV_FUNCTION_H_
 
-#include <functional>
+#include <utility>
 
 #include "src/tint/writer/spirv/instruction.h"
 
@@ -29,23 +29,29 @@ class Function {
     Function();
 
     /// Constructor
-    /// @param declaration the function declaration
+    /// @param declaration the OpFunction instruction, followed by the OpFunctionParameter
+    /// instructions of the function parameters
     /// @param label_op the operand for function's entry block label
-    /// @param params the function parameters
-    Function(const Instruction& declaration,
-             const Operand& label_op,
-             const InstructionList& params);
+    Function(InstructionList declaration, Operand label_op);
     /// Copy constructor
     /// @param other the function to copy
     Function(const Function& other);
+    /// Move constructor
+    /// @param other the function to move
+    Function(Function&& other) = default;
     ~Function();
 
-    /// Iterates over the function call the cb on each instruction
-    /// @param cb the callback to call
-    void iterate(std::function<void(const Instruction&)> cb) const;
+    /// Copy assignment
+    /// @param other the function to copy
+    /// @returns this function
+    Function& operator=(const Function& other);
+    /// Move assignment
+    /// @param other the function to move
+    /// @returns this function
+    Function& operator=(Function&& other) = default;
 
-    /// @returns the declaration
-    const Instruction& declaration() const { return declaration_; }
+    /// @returns the OpFunction instruction and the function parameters
+    const InstructionList& declaration() const { return declaration_; }
 
     /// @returns the label ID for the function entry block
     uint32_t label_id() const { return std::get<uint32_t>(label_op_); }
@@ -53,41 +59,25 @@ class Function {
     /// Adds an instruction to the instruction list
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_inst(spv::Op op, const OperandList& operands) {
-        instructions_.push_back(Instruction{op, operands});
-    }
+    void push_inst(spv::Op op, OperandSpan operands) { instructions_.push_back(op, operands); }
     /// @returns the instruction list
     const InstructionList& instructions() const { return instructions_; }
 
     /// Adds a variable to the variable list
     /// @param operands the operands for the variable
-    void push_var(const OperandList& operands) {
-        vars_.push_back(Instruction{spv::Op::OpVariable, operands});
-    }
+    void push_var(OperandSpan operands) { vars_.push_back(spv::Op::OpVariable, operands); }
     /// @returns the variable list
     const InstructionList& variables() const { return vars_; }
 
     /// @returns the word length of the function
     uint32_t word_length() const {
-        // 1 for the Label and 1 for the FunctionEnd
-        uint32_t size = 2 + declaration_.word_length();
-
-        for (const auto& param : params_) {
-            size += param.word_length();
-        }
-        for (const auto& var : vars_) {
-            size += var.word_length();
-        }
-        for (const auto& inst : instructions_) {
-            size += inst.word_length();
-        }
-        return size;
+        // 2 for the Label and 1 for the FunctionEnd
+        return 3 + declaration_.word_length() + vars_.word_length() + instructions_.word_length();
     }
 
   private:
-    Instruction declaration_;
+    InstructionList declaration_;
     Operand label_op_;
-    InstructionList params_;
     InstructionList vars_;
     InstructionList instructions_;
 };
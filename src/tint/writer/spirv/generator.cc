@@ -33,6 +33,7 @@ Result Generate(const Program* program, const Options& options) {
 
     // Sanitize the program.
     auto sanitized_result = Sanitize(program, options);
+    result.transform_statistics = std::move(sanitized_result.transform_statistics);
     if (!sanitized_result.program.IsValid()) {
         result.success = false;
         result.error = sanitized_result.program.Diagnostics().str();
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "src/tint/transform/manager.h"
 #include "src/tint/writer/writer.h"
 
 // Forward declarations
@@ -47,6 +48,10 @@ struct Options {
     /// Set to `true` to initialize workgroup memory with OpConstantNull when
     /// VK_KHR_zero_initialize_workgroup_memory is enabled.
     bool use_zero_initialize_workgroup_memory_extension = false;
+
+    /// Set to `true` to collect the statistics of the transforms run to sanitize the program,
+    /// which are returned in Result::transform_statistics.
+    bool collect_transform_statistics = false;
 };
 
 /// The result produced when generating SPIR-V.
@@ -68,6 +73,10 @@ struct Result {
 
     /// The generated SPIR-V.
     std::vector<uint32_t> spirv;
+
+    /// The statistics of the transforms run to sanitize the program before generating it, if
+    /// Options::collect_transform_statistics was set.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Generate SPIR-V for a program, according to a set of configuration options.
@@ -14,6 +14,7 @@
 
 #include "src/tint/writer/spirv/generator_impl.h"
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include "src/tint/transform/disable_uniformity_analysis.h"
 #include "src/tint/transform/expand_compound_assignment.h"
 #include "src/tint/transform/for_loop_to_loop.h"
+#include "src/tint/transform/fused.h"
 #include "src/tint/transform/manager.h"
 #include "src/tint/transform/promote_side_effects_to_decl.h"
 #include "src/tint/transform/remove_phonies.h"
@@ -76,10 +78,14 @@ SanitizedResult Sanitize(const Program* in, const Options& options) {
     manager.Add<transform::PromoteSideEffectsToDecl>();
     manager.Add<transform::UnwindDiscardFunctions>();
     manager.Add<transform::SimplifyPointers>();  // Required for arrayLength()
-    manager.Add<transform::RemovePhonies>();
-    manager.Add<transform::VectorizeScalarMatrixConstructors>();
-    manager.Add<transform::ForLoopToLoop>();  // Must come after
-    manager.Add<transform::WhileToLoop>();    // ZeroInitWorkgroupMemory
+    {  // Applied with a single clone of the program
+        auto fused = std::make_unique<transform::Fused>();
+        fused->Add<transform::RemovePhonies>();
+        fused->Add<transform::VectorizeScalarMatrixConstructors>();
+        fused->Add<transform::ForLoopToLoop>();  // Must come after
+        fused->Add<transform::WhileToLoop>();    // ZeroInitWorkgroupMemory
+        manager.append(std::move(fused));
+    }
     manager.Add<transform::CanonicalizeEntryPointIO>();
     manager.Add<transform::AddEmptyEntryPoint>();
     manager.Add<transform::AddSpirvBlockAttribute>();
@@ -90,8 +96,17 @@ SanitizedResult Sanitize(const Program* in, const Options& options) {
             transform::CanonicalizeEntryPointIO::ShaderStyle::kSpirv, 0xFFFFFFFF,
             options.emit_vertex_point_size));
 
+    if (options.collect_transform_statistics) {
+        data.Add<transform::Manager::Config>(/* collect_statistics */ true);
+    }
+
+    auto out = manager.Run(in, data);
+
     SanitizedResult result;
-    result.program = std::move(manager.Run(in, data).program);
+    result.program = std::move(out.program);
+    if (auto* statistics = out.data.Get<transform::Manager::Statistics>()) {
+        result.transform_statistics = std::move(statistics->transforms);
+    }
     return result;
 }
 
@@ -29,6 +29,8 @@ namespace tint::writer::spirv {
 struct SanitizedResult {
     /// The sanitized program.
     Program program;
+    /// The statistics of the transforms run to sanitize the program.
+    std::vector<transform::Manager::TransformStatistics> transform_statistics;
 };
 
 /// Sanitize a program in preparation for generating SPIR-V.
@@ -14,8 +14,11 @@
 
 #include "src/tint/writer/spirv/instruction.h"
 
+#include <cstring>
 #include <utility>
 
+#include "src/tint/utils/bitcast.h"
+
 namespace tint::writer::spirv {
 
 Instruction::Instruction(spv::Op op, OperandList operands)
@@ -25,6 +28,8 @@ Instruction::Instruction(const Instruction&) = default;
 
 Instruction::~Instruction() = default;
 
+Instruction& Instruction::operator=(const Instruction&) = default;
+
 uint32_t Instruction::word_length() const {
     uint32_t size = 1;  // Initial 1 for the op and size
     for (const auto& op : operands_) {
@@ -33,4 +38,56 @@ uint32_t Instruction::word_length() const {
     return size;
 }
 
+InstructionList::InstructionList() = default;
+
+InstructionList::InstructionList(const InstructionList&) = default;
+
+InstructionList::InstructionList(InstructionList&&) = default;
+
+InstructionList::~InstructionList() = default;
+
+InstructionList& InstructionList::operator=(const InstructionList&) = default;
+
+InstructionList& InstructionList::operator=(InstructionList&&) = default;
+
+void InstructionList::push_back(spv::Op op, OperandSpan operands) {
+    uint32_t length = 1;  // Initial 1 for the op and size
+    for (const auto& operand : operands) {
+        length += OperandLength(operand);
+    }
+
+    back_ = words_.size();
+    count_++;
+    words_.push_back(length << 16 | static_cast<uint32_t>(op));
+    for (const auto& operand : operands) {
+        if (auto* i = std::get_if<uint32_t>(&operand)) {
+            words_.push_back(*i);
+        } else if (auto* f = std::get_if<float>(&operand)) {
+            words_.push_back(utils::Bitcast<uint32_t>(*f));
+        } else if (auto* str = std::get_if<std::string>(&operand)) {
+            // The string is nul-terminated, and padded with zeros to a whole number of words.
+            auto idx = words_.size();
+            words_.resize(idx + OperandLength(operand), 0);
+            memcpy(words_.data() + idx, str->c_str(), str->size() + 1);
+        }
+    }
+}
+
+std::vector<Instruction> InstructionList::Decode() const {
+    std::vector<Instruction> instructions;
+    instructions.reserve(count_);
+    for (size_t offset = 0; offset < words_.size();) {
+        uint32_t length = words_[offset] >> 16;
+        OperandList operands;
+        operands.reserve(length - 1);
+        for (uint32_t i = 1; i < length; i++) {
+            operands.push_back(Operand(words_[offset + i]));
+        }
+        instructions.emplace_back(static_cast<spv::Op>(words_[offset] & 0xFFFF),
+                                  std::move(operands));
+        offset += length;
+    }
+    return instructions;
+}
+
 }  // namespace tint::writer::spirv
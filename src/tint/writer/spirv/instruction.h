@@ -31,8 +31,19 @@ class Instruction {
     Instruction(spv::Op op, OperandList operands);
     /// Copy Constructor
     Instruction(const Instruction&);
+    /// Move Constructor
+    Instruction(Instruction&&) = default;
     ~Instruction();
 
+    /// Copy assignment
+    /// @param other the instruction to copy
+    /// @returns this instruction
+    Instruction& operator=(const Instruction& other);
+    /// Move assignment
+    /// @param other the instruction to move
+    /// @returns this instruction
+    Instruction& operator=(Instruction&& other) = default;
+
     /// @returns the instructions op
     spv::Op opcode() const { return op_; }
 
@@ -47,8 +58,67 @@ class Instruction {
     OperandList operands_;
 };
 
-/// A list of instructions
-using InstructionList = std::vector<Instruction>;
+/// A list of SPIR-V instructions. The instructions are encoded into SPIR-V words as they are
+/// appended, so the list does not allocate for each instruction or operand, and its words are
+/// copied as-is into the SPIR-V binary.
+class InstructionList {
+  public:
+    /// Constructor
+    InstructionList();
+    /// Copy constructor
+    InstructionList(const InstructionList&);
+    /// Move constructor
+    InstructionList(InstructionList&&);
+    /// Destructor
+    ~InstructionList();
+
+    /// Copy assignment
+    /// @param other the list to copy
+    /// @returns this list
+    InstructionList& operator=(const InstructionList& other);
+    /// Move assignment
+    /// @param other the list to move
+    /// @returns this list
+    InstructionList& operator=(InstructionList&& other);
+
+    /// Encodes an instruction and appends it to the list
+    /// @param op the op of the instruction
+    /// @param operands the operands of the instruction
+    void push_back(spv::Op op, OperandSpan operands);
+
+    /// Encodes an instruction and appends it to the list
+    /// @param inst the instruction to append
+    void push_back(const Instruction& inst) { push_back(inst.opcode(), inst.operands()); }
+
+    /// @returns the number of instructions in the list
+    size_t size() const { return count_; }
+
+    /// @returns true if the list holds no instructions
+    bool empty() const { return count_ == 0; }
+
+    /// @returns the op of the last instruction of the list. The list must not be empty.
+    spv::Op back_opcode() const { return static_cast<spv::Op>(words_[back_] & 0xFFFF); }
+
+    /// Decodes all the instructions of the list, in a single pass over the words.
+    /// The decode is lossy: every operand of the returned instructions is a uint32_t word, so
+    /// float operands are returned as their bit pattern, and string operands as the words that
+    /// hold their nul-terminated, zero-padded characters. The returned instructions encode to the
+    /// same words as the original instructions.
+    /// @returns the decoded instructions
+    std::vector<Instruction> Decode() const;
+
+    /// @returns the encoded instructions
+    const std::vector<uint32_t>& words() const { return words_; }
+
+    /// @returns the number of uint32_t's needed to hold the instructions
+    uint32_t word_length() const { return static_cast<uint32_t>(words_.size()); }
+
+  private:
+    std::vector<uint32_t> words_;
+    size_t count_ = 0;
+    /// The index of the first word of the last instruction
+    size_t back_ = 0;
+};
 
 }  // namespace tint::writer::spirv
 
@@ -44,5 +44,36 @@ TEST_F(InstructionTest, Length) {
     EXPECT_EQ(i.word_length(), 5u);
 }
 
+TEST_F(InstructionTest, ListEncodesInstructions) {
+    InstructionList list;
+    EXPECT_TRUE(list.empty());
+
+    list.push_back(spv::Op::OpEntryPoint, {Operand(1.2f), Operand(1u), Operand("my_str")});
+    list.push_back(spv::Op::OpReturn, {});
+    EXPECT_FALSE(list.empty());
+    EXPECT_EQ(list.size(), 2u);
+    EXPECT_EQ(list.word_length(), 6u);
+    EXPECT_EQ(list.back_opcode(), spv::Op::OpReturn);
+
+    auto insts = list.Decode();
+    ASSERT_EQ(insts.size(), 2u);
+    auto& i = insts[0];
+    EXPECT_EQ(i.opcode(), spv::Op::OpEntryPoint);
+    EXPECT_EQ(i.word_length(), 5u);
+    ASSERT_EQ(i.operands().size(), 4u);
+    EXPECT_EQ(std::get<uint32_t>(i.operands()[0]), 0x3f99999au);
+    EXPECT_EQ(std::get<uint32_t>(i.operands()[1]), 1u);
+    EXPECT_EQ(std::get<uint32_t>(i.operands()[2]), 0x735f796du);  // "my_s"
+    EXPECT_EQ(std::get<uint32_t>(i.operands()[3]), 0x00007274u);  // "tr\0\0"
+
+    EXPECT_EQ(insts[1].opcode(), spv::Op::OpReturn);
+    EXPECT_EQ(insts[1].word_length(), 1u);
+}
+
+TEST_F(InstructionTest, ListDecodeEmpty) {
+    InstructionList list;
+    EXPECT_TRUE(list.Decode().empty());
+}
+
 }  // namespace
 }  // namespace tint::writer::spirv
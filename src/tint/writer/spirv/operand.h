@@ -16,6 +16,8 @@
 #define SRC_TINT_WRITER_SPIRV_OPERAND_H_
 
 #include <cstring>
+#include <initializer_list>
+#include <iterator>
 #include <string>
 #include <variant>
 #include <vector>
@@ -39,6 +41,31 @@ uint32_t OperandLength(const Operand& o);
 /// A list of operands
 using OperandList = std::vector<Operand>;
 
+/// OperandSpan is a view of a contiguous sequence of operands, used to pass the operands of an
+/// instruction that is encoded immediately. It is implicitly constructed from a braced list of
+/// operands, or from an OperandList, so that neither has to be copied into a new list.
+/// As the span does not own the operands, it should only be used as a function parameter.
+class OperandSpan {
+  public:
+    /// Constructor
+    /// @param operands the operands
+    OperandSpan(std::initializer_list<Operand> operands)  // NOLINT(runtime/explicit)
+        : begin_(std::data(operands)), end_(begin_ + operands.size()) {}
+    /// Constructor
+    /// @param operands the operands
+    OperandSpan(const OperandList& operands)  // NOLINT(runtime/explicit)
+        : begin_(operands.data()), end_(operands.data() + operands.size()) {}
+
+    /// @returns a pointer to the first operand
+    const Operand* begin() const { return begin_; }
+    /// @returns a pointer past the last operand
+    const Operand* end() const { return end_; }
+
+  private:
+    const Operand* begin_;
+    const Operand* end_;
+};
+
 using OperandListKey = utils::UnorderedKeyWrapper<OperandList>;
 
 }  // namespace tint::writer::spirv
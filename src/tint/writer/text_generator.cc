@@ -16,10 +16,40 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "src/tint/utils/map.h"
 
 namespace tint::writer {
+namespace {
+
+/// The streams of destructed LineWriters, available for reuse by this thread.
+thread_local std::vector<std::unique_ptr<std::ostringstream>> free_line_streams;
+
+/// @returns an empty stream with the default formatting, for a LineWriter to write to
+std::unique_ptr<std::ostringstream> AcquireLineStream() {
+    if (free_line_streams.empty()) {
+        return std::make_unique<std::ostringstream>();
+    }
+    auto os = std::move(free_line_streams.back());
+    free_line_streams.pop_back();
+    return os;
+}
+
+/// Clears the content and formatting of `os`, which may have been changed with stream
+/// manipulators, and returns it to the pool.
+/// @param os the stream of a destructed LineWriter
+void ReleaseLineStream(std::unique_ptr<std::ostringstream> os) {
+    os->str(std::string());
+    os->clear();
+    os->flags(std::ios_base::skipws | std::ios_base::dec);
+    os->precision(6);
+    os->width(0);
+    os->fill(' ');
+    free_line_streams.emplace_back(std::move(os));
+}
+
+}  // namespace
 
 TextGenerator::TextGenerator(const Program* program)
     : program_(program), builder_(ProgramBuilder::Wrap(program)) {}
@@ -48,17 +78,22 @@ std::string TextGenerator::TrimSuffix(std::string str, const std::string& suffix
     return str;
 }
 
-TextGenerator::LineWriter::LineWriter(TextBuffer* buf) : buffer(buf) {}
+TextGenerator::LineWriter::LineWriter(TextBuffer* buf) : os(AcquireLineStream()), buffer(buf) {}
 
 TextGenerator::LineWriter::LineWriter(LineWriter&& other) {
+    os = std::move(other.os);
     buffer = other.buffer;
     other.buffer = nullptr;
 }
 
 TextGenerator::LineWriter::~LineWriter() {
+    if (!os) {
+        return;
+    }
     if (buffer) {
-        buffer->Append(os.str());
+        buffer->Append(os->str());
     }
+    ReleaseLineStream(std::move(os));
 }
 
 TextGenerator::TextBuffer::TextBuffer() = default;
@@ -76,6 +111,10 @@ void TextGenerator::TextBuffer::Append(const std::string& line) {
     lines.emplace_back(Line{current_indent, line});
 }
 
+void TextGenerator::TextBuffer::Append(std::string&& line) {
+    lines.emplace_back(Line{current_indent, std::move(line)});
+}
+
 void TextGenerator::TextBuffer::Insert(const std::string& line, size_t before, uint32_t indent) {
     if (before >= lines.size()) {
         diag::List d;
@@ -89,8 +128,8 @@ void TextGenerator::TextBuffer::Insert(const std::string& line, size_t before, u
 }
 
 void TextGenerator::TextBuffer::Append(const TextBuffer& tb) {
+    lines.reserve(lines.size() + tb.lines.size());
     for (auto& line : tb.lines) {
-        // TODO(bclayton): inefficient, consider optimizing
         lines.emplace_back(Line{current_indent + line.indent, line.content});
     }
 }
@@ -103,28 +142,34 @@ void TextGenerator::TextBuffer::Insert(const TextBuffer& tb, size_t before, uint
                             << "  lines.size(): " << lines.size();
         return;
     }
-    size_t idx = 0;
-    for (auto& line : tb.lines) {
-        // TODO(bclayton): inefficient, consider optimizing
-        using DT = decltype(lines)::difference_type;
-        lines.insert(lines.begin() + static_cast<DT>(before + idx),
-                     Line{indent + line.indent, line.content});
-        idx++;
+    // Shift the lines after `before` once, rather than once per inserted line.
+    using DT = decltype(lines)::difference_type;
+    auto inserted = lines.insert(lines.begin() + static_cast<DT>(before), tb.lines.begin(),
+                                 tb.lines.end());
+    for (auto it = inserted; it != inserted + static_cast<DT>(tb.lines.size()); it++) {
+        it->indent += indent;
     }
 }
 
 std::string TextGenerator::TextBuffer::String(uint32_t indent /* = 0 */) const {
-    std::stringstream ss;
+    size_t size = 0;
+    for (auto& line : lines) {
+        if (!line.content.empty()) {
+            size += indent + line.indent + line.content.size();
+        }
+        size++;  // '\n'
+    }
+
+    std::string out;
+    out.reserve(size);
     for (auto& line : lines) {
         if (!line.content.empty()) {
-            for (uint32_t i = 0; i < indent + line.indent; i++) {
-                ss << " ";
-            }
-            ss << line.content;
+            out.append(indent + line.indent, ' ');
+            out += line.content;
         }
-        ss << std::endl;
+        out += '\n';
     }
-    return ss.str();
+    return out;
 }
 
 TextGenerator::ScopedParen::ScopedParen(std::ostream& stream) : s(stream) {
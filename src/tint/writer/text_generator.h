@@ -15,6 +15,7 @@
 #ifndef SRC_TINT_WRITER_TEXT_GENERATOR_H_
 #define SRC_TINT_WRITER_TEXT_GENERATOR_H_
 
+#include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -57,6 +58,10 @@ class TextGenerator {
         /// @param line the line to append to the TextBuffer
         void Append(const std::string& line);
 
+        /// Appends the line to the end of the TextBuffer
+        /// @param line the line to append to the TextBuffer
+        void Append(std::string&& line);
+
         /// Inserts the line to the TextBuffer before the line with index `before`
         /// @param line the line to append to the TextBuffer
         /// @param before the zero-based index of the line to insert the text before
@@ -140,20 +145,22 @@ class TextGenerator {
         ~LineWriter();
 
         /// @returns the ostringstream
-        operator std::ostream&() { return os; }
+        operator std::ostream&() { return *os; }
 
         /// @param rhs the value to write to the line
         /// @returns the ostream so calls can be chained
         template <typename T>
         std::ostream& operator<<(T&& rhs) {
-            return os << std::forward<T>(rhs);
+            return *os << std::forward<T>(rhs);
         }
 
       private:
         LineWriter(const LineWriter&) = delete;
         LineWriter& operator=(const LineWriter&) = delete;
 
-        std::ostringstream os;
+        /// The stream holding the line. Streams are expensive to construct, so they are taken
+        /// from a per-thread pool, and returned to it on destruction.
+        std::unique_ptr<std::ostringstream> os;
         TextBuffer* buffer;
     };
 
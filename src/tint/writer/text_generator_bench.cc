@@ -0,0 +1,61 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iomanip>
+
+#include "src/tint/writer/text_generator.h"
+
+// Included after the internal headers, as it includes tint/tint.h.
+#include "src/tint/bench/benchmark.h"
+
+namespace tint::writer {
+namespace {
+
+class BenchTextGenerator : public TextGenerator {
+  public:
+    using TextGenerator::line;
+    using TextGenerator::TextGenerator;
+
+    /// @returns the buffer that the generator is appending lines to
+    TextBuffer* buffer() { return current_buffer_; }
+};
+
+// Emits the given number of short, formatted lines, as the backends do for statements, then
+// inserts a buffer of helper functions before them and builds the result.
+void TextGeneratorLines(benchmark::State& state) {
+    Program program(ProgramBuilder{});
+    auto num_lines = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        BenchTextGenerator gen(&program);
+        TextGenerator::TextBuffer helpers;
+        for (int i = 0; i < 16; i++) {
+            BenchTextGenerator::line(&helpers) << "float helper_" << i << "(float x) {";
+            helpers.IncrementIndent();
+            BenchTextGenerator::line(&helpers) << "return x * " << std::setprecision(9) << 1.5f;
+            helpers.DecrementIndent();
+            BenchTextGenerator::line(&helpers) << "}";
+        }
+        for (int i = 0; i < num_lines; i++) {
+            gen.line() << "float x_" << i << " = helper_" << (i % 16) << "(" << i << ".0f);";
+        }
+        gen.buffer()->Insert(helpers, 0, 0);
+        auto result = gen.result();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(TextGeneratorLines)->Arg(100)->Arg(5000);
+
+}  // namespace
+}  // namespace tint::writer
@@ -14,6 +14,8 @@
 
 #include "src/tint/writer/text_generator.h"
 
+#include <iomanip>
+
 #include "gtest/gtest.h"
 
 namespace tint::writer {
@@ -42,5 +44,44 @@ TEST(TextGeneratorTest, UniqueIdentifier_ConflictWithExisting) {
     ASSERT_EQ(gen.UniqueIdentifier("ident"), "ident_5");
 }
 
+TEST(TextGeneratorTest, TextBuffer_InsertBuffer) {
+    TextGenerator::TextBuffer outer;
+    outer.Append("a");
+    outer.Append("d");
+
+    TextGenerator::TextBuffer inner;
+    inner.Append("b");
+    inner.IncrementIndent();
+    inner.Append("c");
+    inner.Append("");
+
+    outer.Insert(inner, 1, 2);
+    EXPECT_EQ(outer.String(), "a\n  b\n    c\n\nd\n");
+    EXPECT_EQ(outer.String(1), " a\n   b\n     c\n\n d\n");
+}
+
+class TestTextGenerator : public TextGenerator {
+  public:
+    using TextGenerator::line;
+    using TextGenerator::TextGenerator;
+};
+
+TEST(TextGeneratorTest, LineWriter_StreamStateIsNotShared) {
+    Program program(ProgramBuilder{});
+
+    TestTextGenerator gen(&program);
+    {
+        auto outer = gen.line();
+        outer << std::setprecision(20) << std::hex << 0.1f << " " << 255;
+        gen.line() << 0.1f << " " << 255;
+    }
+    gen.line() << 0.1f << " " << 255;
+
+    EXPECT_EQ(gen.result(), R"(0.1 255
+0.10000000149011611938 ff
+0.1 255
+)");
+}
+
 }  // namespace
 }  // namespace tint::writer
@@ -300,6 +300,7 @@ func (g *generator) bindAndParse(t *template.Template, text string) error {
 	_, err := t.Funcs(map[string]interface{}{
 		"Map":                   newMap,
 		"Iterate":               iterate,
+		"PerfectHash":           perfectHash,
 		"Title":                 strings.Title,
 		"PascalCase":            pascalCase,
 		"SplitDisplayName":      gen.SplitDisplayName,
@@ -477,6 +478,73 @@ func iterate(n int) []int {
 	return out
 }
 
+// perfectHashTable is a hash table without collisions for a fixed set of names,
+// returned by perfectHash().
+type perfectHashTable struct {
+	// The hash seed for which no two names hash to the same slot
+	Seed uint32
+	// The mask applied to the hash to obtain the slot index. There are Mask+1 slots.
+	Mask uint32
+	// The index of the name held by each slot, or -1 for empty slots
+	Slots []int
+}
+
+// hashName returns the seeded 32-bit FNV-1a hash of name, with the high bits
+// folded into the low bits.
+// Must be kept in sync with tint::utils::PerfectHash() in src/tint/utils/perfect_hash.h.
+func hashName(name string, seed uint32) uint32 {
+	hash := uint32(2166136261) ^ seed
+	for i := 0; i < len(name); i++ {
+		hash ^= uint32(name[i])
+		hash *= 16777619
+	}
+	return hash ^ (hash >> 16)
+}
+
+// perfectHash builds a perfectHashTable for the names of the elements of the
+// given slice, which must hold strings or sem.Named values. The table size is
+// the smallest power of two that is at least twice the number of names and for
+// which a seed can be found.
+// Useful for: {{- $table := PerfectHash $enum.PublicEntries -}}
+func perfectHash(slice interface{}) (*perfectHashTable, error) {
+	s := reflect.ValueOf(slice)
+	names := make([]string, s.Len())
+	for i := range names {
+		switch v := s.Index(i).Interface().(type) {
+		case string:
+			names[i] = v
+		case sem.Named:
+			names[i] = v.GetName()
+		default:
+			return nil, fmt.Errorf("PerfectHash: unsupported element type %T", v)
+		}
+	}
+
+	const maxSeeds = 1 << 20
+	size := uint32(1)
+	for size < 2*uint32(len(names)) {
+		size *= 2
+	}
+	for ; size <= 1<<16; size *= 2 {
+		slots := make([]int, size)
+	seeds:
+		for seed := uint32(0); seed < maxSeeds; seed++ {
+			for i := range slots {
+				slots[i] = -1
+			}
+			for i, name := range names {
+				slot := hashName(name, seed) & (size - 1)
+				if slots[slot] >= 0 {
+					continue seeds
+				}
+				slots[slot] = i
+			}
+			return &perfectHashTable{Seed: seed, Mask: size - 1, Slots: slots}, nil
+		}
+	}
+	return nil, fmt.Errorf("PerfectHash: no perfect hash found for %v", names)
+}
+
 // pascalCase returns the snake-case string s transformed into 'PascalCase',
 // Rules:
 // * The first letter of the string is capitalized